@@ -138,7 +138,9 @@ public:
 	inline NameInfo GetNameCollisionInfoUnchecked(UEStruct Struct, UEType Member)
 	{
 		CollisionManager::NameContainer& InfosForStruct = NameInfos.at(Struct.GetIndex());
-		uint64 NameInfoIndex = TranslationMap[KeyFunctions::GetKeyForCollisionInfo(Struct, Member)];
+		/* Lookup without operator[], this function is called from multiple threads during generation and must not modify the map */
+		auto It = TranslationMap.find(KeyFunctions::GetKeyForCollisionInfo(Struct, Member));
+		uint64 NameInfoIndex = It != TranslationMap.end() ? It->second : 0x0;
 
 		return InfosForStruct.at(NameInfoIndex);
 	}
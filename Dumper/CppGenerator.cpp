@@ -1,13 +1,17 @@
 #include <vector>
+#include <numeric>
 
 #include "CppGenerator.h"
 #include "ObjectArray.h"
 #include "MemberWrappers.h"
 #include "MemberManager.h"
+#include "ParallelUtils.h"
+#include "Profiler.h"
+#include "TextBuffer.h"
 
 #include "Settings.h"
 
-constexpr std::string GetTypeFromSize(uint8 Size)
+constexpr const char* GetTypeFromSize(uint8 Size)
 {
 	switch (Size)
 	{
@@ -25,34 +29,51 @@ constexpr std::string GetTypeFromSize(uint8 Size)
 	}
 }
 
-std::string CppGenerator::MakeMemberString(const std::string& Type, const std::string& Name, std::string&& Comment)
+void CppGenerator::AppendMemberString(std::string& Out, std::string_view Type, std::string_view Name, std::string_view Comment)
 {
-	return std::format("\t{:{}} {:{}} // {}\n", Type, 45, Name + ";", 50, std::move(Comment));
+	TextBuffer::ScratchString NameWithSemicolon;
+	NameWithSemicolon->append(Name).push_back(';');
+
+	TextBuffer::AppendFormat(Out, "\t{:{}} {:{}} // {}\n", Type, 45, NameWithSemicolon.Get(), 50, Comment);
 }
 
-std::string CppGenerator::MakeMemberStringWithoutName(const std::string& Type, std::string&& Comment)
+void CppGenerator::AppendMemberStringWithoutName(std::string& Out, std::string_view Type, std::string_view Comment)
 {
-	return std::format("\t{:{}} // {}\n", Type + ";", 96, std::move(Comment));
+	TextBuffer::ScratchString TypeWithSemicolon;
+	TypeWithSemicolon->append(Type).push_back(';');
+
+	TextBuffer::AppendFormat(Out, "\t{:{}} // {}\n", TypeWithSemicolon.Get(), 96, Comment);
 }
 
-std::string CppGenerator::GenerateBytePadding(const int32 Offset, const int32 PadSize, std::string&& Reason)
+void CppGenerator::AppendBytePadding(std::string& Out, const int32 Offset, const int32 PadSize, std::string_view Reason)
 {
-	return MakeMemberString("uint8", std::format("Pad_{:X}[0x{:X}]", Offset, PadSize), std::format("0x{:04X} (0x{:04X}) ({})", Offset, PadSize, std::move(Reason)));
+	TextBuffer::ScratchString Name;
+	TextBuffer::ScratchString Comment;
+
+	TextBuffer::AppendFormat(*Name, "Pad_{:X}[0x{:X}]", Offset, PadSize);
+	TextBuffer::AppendFormat(*Comment, "0x{:04X} (0x{:04X}) ({})", Offset, PadSize, Reason);
+
+	AppendMemberString(Out, "uint8", Name, Comment);
 }
 
-std::string CppGenerator::GenerateBitPadding(uint8 UnderlayingSizeBytes, const uint8 PrevBitPropertyEndBit, const int32 Offset, const int32 PadSize, std::string&& Reason)
+void CppGenerator::AppendBitPadding(std::string& Out, uint8 UnderlayingSizeBytes, const uint8 PrevBitPropertyEndBit, const int32 Offset, const int32 PadSize, std::string_view Reason)
 {
-	return MakeMemberString(GetTypeFromSize(UnderlayingSizeBytes), std::format("BitPad_{:X}_{:X} : {:X}", Offset, PrevBitPropertyEndBit, PadSize), std::format("0x{:04X} (0x{:04X}) ({})", Offset, UnderlayingSizeBytes, std::move(Reason)));
+	TextBuffer::ScratchString Name;
+	TextBuffer::ScratchString Comment;
+
+	TextBuffer::AppendFormat(*Name, "BitPad_{:X}_{:X} : {:X}", Offset, PrevBitPropertyEndBit, PadSize);
+	TextBuffer::AppendFormat(*Comment, "0x{:04X} (0x{:04X}) ({})", Offset, UnderlayingSizeBytes, Reason);
+
+	AppendMemberString(Out, GetTypeFromSize(UnderlayingSizeBytes), Name, Comment);
 }
 
-std::string CppGenerator::GenerateMembers(const StructWrapper& Struct, const MemberManager& Members, int32 SuperSize, int32 SuperLastMemberEnd, int32 SuperAlign, int32 PackageIndex)
+void CppGenerator::GenerateMembers(std::string& OutMembers, const StructWrapper& Struct, const MemberManager& Members, int32 SuperSize, int32 SuperLastMemberEnd, int32 SuperAlign, int32 PackageIndex)
 {
 	constexpr uint64 EstimatedCharactersPerLine = 0x80;
 
 	const bool bIsUnion = Struct.IsUnion();
 
-	std::string OutMembers;
-	OutMembers.reserve(Members.GetNumMembers() * EstimatedCharactersPerLine);
+	OutMembers.reserve(OutMembers.size() + (Members.GetNumMembers() * EstimatedCharactersPerLine));
 
 	bool bEncounteredZeroSizedVariable = false;
 	bool bEncounteredStaticVariable = false;
@@ -90,6 +111,11 @@ std::string CppGenerator::GenerateMembers(const StructWrapper& Struct, const Mem
 	const int32 SuperTrailingPaddingSize = SuperSize - SuperLastMemberEnd;
 	bool bIsFirstSizedMember = true;
 
+	/* Reused for every member, to avoid allocating temporary strings per member */
+	TextBuffer::ScratchString Comment;
+	TextBuffer::ScratchString MemberName;
+	TextBuffer::ScratchString MemberType;
+
 	for (const PropertyWrapper& Member : Members.IterateMembers())
 	{
 		AddSpaceBetweenSticAndNormalMembers(Member);
@@ -99,23 +125,22 @@ std::string CppGenerator::GenerateMembers(const StructWrapper& Struct, const Mem
 
 		const int32 CurrentPropertyEnd = MemberOffset + MemberSize;
 
-		std::string Comment = std::format("0x{:04X} (0x{:04X}) ({})", MemberOffset, MemberSize, Member.GetFlagsOrCustomComment());
-
-
 		const bool bIsBitField = Member.IsBitField();
 
 		/* Padding between two bitfields at different byte-offsets */
 		if (CurrentPropertyEnd > PrevPropertyEnd && bLastPropertyWasBitField && bIsBitField && PrevBitPropertyEndBit < PrevNumBitsInUnderlayingType && !bIsUnion)
 		{
-			OutMembers += GenerateBitPadding(PrevBitPropertySize, PrevBitPropertyEndBit, PrevBitPropertyOffset, PrevNumBitsInUnderlayingType - PrevBitPropertyEndBit, "Fixing Bit-Field Size For New Byte [ Dumper-7 ]");
+			AppendBitPadding(OutMembers, PrevBitPropertySize, PrevBitPropertyEndBit, PrevBitPropertyOffset, PrevNumBitsInUnderlayingType - PrevBitPropertyEndBit, "Fixing Bit-Field Size For New Byte [ Dumper-7 ]");
 			PrevBitPropertyEndBit = 0;
 		}
 
 		if (MemberOffset > PrevPropertyEnd && !bIsUnion)
-			OutMembers += GenerateBytePadding(PrevPropertyEnd, MemberOffset - PrevPropertyEnd, "Fixing Size After Last Property [ Dumper-7 ]");
+			AppendBytePadding(OutMembers, PrevPropertyEnd, MemberOffset - PrevPropertyEnd, "Fixing Size After Last Property [ Dumper-7 ]");
 
 		bIsFirstSizedMember = Member.IsZeroSizedMember() || Member.IsStatic();
 
+		Comment->clear();
+
 		if (bIsBitField)
 		{
 			uint8 BitFieldIndex = Member.GetBitIndex();
@@ -124,14 +149,13 @@ std::string CppGenerator::GenerateMembers(const StructWrapper& Struct, const Mem
 			if (CurrentPropertyEnd > PrevPropertyEnd)
 				PrevBitPropertyEndBit = 0x0;
 
-			std::string BitfieldInfoComment = std::format("BitIndex: 0x{:02X}, PropSize: 0x{:04X} ({})", BitFieldIndex, MemberSize, Member.GetFlagsOrCustomComment());
-			Comment = std::format("0x{:04X} (0x{:04X}) ({})", MemberOffset, MemberSize, BitfieldInfoComment);
+			TextBuffer::AppendFormat(*Comment, "0x{:04X} (0x{:04X}) (BitIndex: 0x{:02X}, PropSize: 0x{:04X} ({}))", MemberOffset, MemberSize, BitFieldIndex, MemberSize, Member.GetFlagsOrCustomComment());
 
 			if (PrevBitPropertyEnd < MemberOffset)
 				PrevBitPropertyEndBit = 0;
 
 			if (PrevBitPropertyEndBit < BitFieldIndex && !bIsUnion)
-				OutMembers += GenerateBitPadding(MemberSize, PrevBitPropertyEndBit, MemberOffset, BitFieldIndex - PrevBitPropertyEndBit, "Fixing Bit-Field Size Between Bits [ Dumper-7 ]");
+				AppendBitPadding(OutMembers, MemberSize, PrevBitPropertyEndBit, MemberOffset, BitFieldIndex - PrevBitPropertyEndBit, "Fixing Bit-Field Size Between Bits [ Dumper-7 ]");
 
 			PrevBitPropertyEndBit = BitFieldIndex + BitSize;
 			PrevBitPropertyEnd = MemberOffset  + MemberSize;
@@ -141,45 +165,51 @@ std::string CppGenerator::GenerateMembers(const StructWrapper& Struct, const Mem
 
 			PrevNumBitsInUnderlayingType = (MemberSize * 0x8);
 		}
+		else
+		{
+			TextBuffer::AppendFormat(*Comment, "0x{:04X} (0x{:04X}) ({})", MemberOffset, MemberSize, Member.GetFlagsOrCustomComment());
+		}
 
 		bLastPropertyWasBitField = bIsBitField;
 
 		if (!Member.IsStatic()) [[likely]]
 			PrevPropertyEnd = MemberOffset + (MemberSize * Member.GetArrayDim());
 
-		std::string MemberName = Member.GetName();
+		MemberName->clear();
+		MemberName->append(Member.GetName());
 
 		if (Member.GetArrayDim() > 1)
 		{
-			MemberName += std::format("[0x{:X}]", Member.GetArrayDim());
+			TextBuffer::AppendFormat(*MemberName, "[0x{:X}]", Member.GetArrayDim());
 		}
 		else if (bIsBitField)
 		{
-			MemberName += (" : " + std::to_string(Member.GetBitCount()));
+			TextBuffer::AppendFormat(*MemberName, " : {}", Member.GetBitCount());
 		}
 
 		if (Member.HasDefaultValue()) [[unlikely]]
-			MemberName += (" = " + Member.GetDefaultValue());
+			MemberName->append(" = ").append(Member.GetDefaultValue());
 
 		const bool bAllowForConstPtrMembers = Struct.IsFunction();
 
+		MemberType->clear();
+		AppendMemberTypeString(*MemberType, Member, PackageIndex, bAllowForConstPtrMembers);
+
 		/* using directives */
 		if (Member.IsZeroSizedMember()) [[unlikely]]
 		{
-			OutMembers += MakeMemberStringWithoutName(GetMemberTypeString(Member, PackageIndex, bAllowForConstPtrMembers), std::move(Comment));
+			AppendMemberStringWithoutName(OutMembers, MemberType, Comment);
 		}
 		else [[likely]]
 		{
-			OutMembers += MakeMemberString(GetMemberTypeString(Member, PackageIndex, bAllowForConstPtrMembers), MemberName, std::move(Comment));
+			AppendMemberString(OutMembers, MemberType, MemberName, Comment);
 		}
 	}
 
 	const int32 MissingByteCount = Struct.GetUnalignedSize() - PrevPropertyEnd;
 
 	if (MissingByteCount > 0x0 /* >=Struct.GetAlignment()*/)
-		OutMembers += GenerateBytePadding(PrevPropertyEnd, MissingByteCount, "Fixing Struct Size After Last Property [ Dumper-7 ]");
-
-	return OutMembers;
+		AppendBytePadding(OutMembers, PrevPropertyEnd, MissingByteCount, "Fixing Struct Size After Last Property [ Dumper-7 ]");
 }
 
 std::string CppGenerator::GenerateFunctionInHeader(const MemberManager& Members)
@@ -383,12 +413,10 @@ CppGenerator::FunctionInfo CppGenerator::GenerateFunctionInfo(const FunctionWrap
 	return RetFuncInfo;
 }
 
-std::string CppGenerator::GenerateSingleFunction(const FunctionWrapper& Func, const std::string& StructName, StreamType& FunctionFile, StreamType& ParamFile)
+void CppGenerator::GenerateSingleFunction(std::string& InHeaderFunctionText, const FunctionWrapper& Func, const std::string& StructName, StreamType& FunctionFile, StreamType& ParamFile)
 {
 	namespace CppSettings = Settings::CppGenerator;
 
-	std::string InHeaderFunctionText;
-
 	FunctionInfo FuncInfo = GenerateFunctionInfo(Func);
 
 	const bool bHasInlineBody = Func.HasInlineBody();
@@ -397,17 +425,24 @@ std::string CppGenerator::GenerateSingleFunction(const FunctionWrapper& Func, co
 	const bool bIsConstFunc = Func.IsConst() && !Func.IsStatic();
 
 	// Function declaration and inline-body generation
-	InHeaderFunctionText += std::format("\t{}{}{} {}{}", TemplateText, (Func.IsStatic() ? "static " : ""), FuncInfo.RetType, FuncInfo.FuncNameWithParams, bIsConstFunc ? " const" : "");
-	InHeaderFunctionText += (bHasInlineBody ? ("\n\t" + Func.GetPredefFunctionInlineBody()) : ";") + "\n";
+	TextBuffer::AppendFormat(InHeaderFunctionText, "\t{}{}{} {}{}", TemplateText, (Func.IsStatic() ? "static " : ""), FuncInfo.RetType, FuncInfo.FuncNameWithParams, bIsConstFunc ? " const" : "");
 
 	if (bHasInlineBody)
-		return InHeaderFunctionText;
+	{
+		InHeaderFunctionText += "\n\t";
+		InHeaderFunctionText += Func.GetPredefFunctionInlineBody();
+		InHeaderFunctionText += '\n';
+
+		return;
+	}
+
+	InHeaderFunctionText += ";\n";
 
 	if (Func.IsPredefined())
 	{
 		std::string CustomComment = Func.GetPredefFunctionCustomComment();
 
-		FunctionFile << std::format(R"(
+		TextBuffer::AppendFormat(FunctionFile.GetBuffer(), R"(
 // Predefined Function
 {}
 {} {}::{}{}
@@ -421,7 +456,7 @@ std::string CppGenerator::GenerateSingleFunction(const FunctionWrapper& Func, co
 , bIsConstFunc ? " const" : ""
 , Func.GetPredefFunctionBody());
 
-		return InHeaderFunctionText;
+		return;
 	}
 
 	std::string ParamStructName = Func.GetParamStructName();
@@ -431,19 +466,27 @@ std::string CppGenerator::GenerateSingleFunction(const FunctionWrapper& Func, co
 		GenerateStruct(Func.AsStruct(), ParamFile, FunctionFile, ParamFile, -1, ParamStructName);
 
 
-	std::string ParamVarCreationString = std::format(R"(
-	{}{} Parms{{}};
-)", CppSettings::ParamNamespaceName ? std::format("{}::", CppSettings::ParamNamespaceName) : "", ParamStructName);
+	TextBuffer::ScratchString ParamVarCreationString;
+	TextBuffer::AppendFormat(*ParamVarCreationString, R"(
+	{}{}{} Parms{{}};
+)", CppSettings::ParamNamespaceName ? CppSettings::ParamNamespaceName : "", CppSettings::ParamNamespaceName ? "::" : "", ParamStructName);
 
 	constexpr const char* StoreFunctionFlagsString = R"(
 	auto Flgs = Func->FunctionFlags;
 	Func->FunctionFlags |= 0x400;
 )";
 
-	std::string ParamDescriptionCommentString = "// Parameters:\n";
-	std::string ParamAssignments;
-	std::string OutPtrAssignments;
-	std::string OutRefAssignments;
+	/* Reused per thread, Functions are the most common kind of output */
+	TextBuffer::ScratchString ParamDescriptionCommentString;
+	TextBuffer::ScratchString ParamAssignments;
+	TextBuffer::ScratchString OutPtrAssignments;
+	TextBuffer::ScratchString OutRefAssignments;
+
+	ParamDescriptionCommentString->append("// Parameters:\n");
+
+	/* Start with a newline, if any assignments are generated */
+	ParamAssignments->push_back('\n');
+	OutRefAssignments->push_back('\n');
 
 	const bool bHasParams = !FuncInfo.UnrealFuncParams.empty();
 	bool bHasParamsToInit = false;
@@ -452,38 +495,59 @@ std::string CppGenerator::GenerateSingleFunction(const FunctionWrapper& Func, co
 
 	for (const ParamInfo& PInfo : FuncInfo.UnrealFuncParams)
 	{
-		ParamDescriptionCommentString += std::format("// {:{}}{:{}}({})\n", PInfo.Type, 40, PInfo.Name, 55, StringifyPropertyFlags(PInfo.PropFlags));
+		TextBuffer::AppendFormat(*ParamDescriptionCommentString, "// {:{}}{:{}}({})\n", PInfo.Type, 40, PInfo.Name, 55, StringifyPropertyFlags(PInfo.PropFlags));
 
 		if (PInfo.bIsRetParam)
 			continue;
 
 		if (PInfo.bIsOutPtr)
 		{
-			OutPtrAssignments += !PInfo.bIsMoveParam ? std::format(R"(
+			if (!PInfo.bIsMoveParam)
+			{
+				TextBuffer::AppendFormat(*OutPtrAssignments, R"(
 
 	if ({0} != nullptr)
-		*{0} = Parms.{0};)", PInfo.Name) : std::format(R"(
+		*{0} = Parms.{0};)", PInfo.Name);
+			}
+			else
+			{
+				TextBuffer::AppendFormat(*OutPtrAssignments, R"(
 
 	if ({0} != nullptr)
 		*{0} = std::move(Parms.{0});)", PInfo.Name);
+			}
+
 			bHasOutPtrParamsToInit = true;
 		}
 		else
 		{
-			ParamAssignments += PInfo.bIsMoveParam ? std::format("\tParms.{0} = std::move({0});\n", PInfo.Name) : std::format("\tParms.{0} = {0};\n", PInfo.Name);
+			if (PInfo.bIsMoveParam)
+			{
+				TextBuffer::AppendFormat(*ParamAssignments, "\tParms.{0} = std::move({0});\n", PInfo.Name);
+			}
+			else
+			{
+				TextBuffer::AppendFormat(*ParamAssignments, "\tParms.{0} = {0};\n", PInfo.Name);
+			}
+
 			bHasParamsToInit = true;
 		}
 
 		if (PInfo.bIsOutRef && !PInfo.bIsConst)
 		{
-			OutRefAssignments += PInfo.bIsMoveParam ? std::format("\n\t{0} = std::move(Parms.{0});", PInfo.Name) : std::format("\n\t{0} = Parms.{0};", PInfo.Name);
+			if (PInfo.bIsMoveParam)
+			{
+				TextBuffer::AppendFormat(*OutRefAssignments, "\n\t{0} = std::move(Parms.{0});", PInfo.Name);
+			}
+			else
+			{
+				TextBuffer::AppendFormat(*OutRefAssignments, "\n\t{0} = Parms.{0};", PInfo.Name);
+			}
+
 			bHasOutRefParamsToInit = true;
 		}
 	}
 
-	ParamAssignments = '\n' + ParamAssignments;
-	OutRefAssignments = '\n' + OutRefAssignments;
-
 	constexpr const char* RestoreFunctionFlagsString = R"(
 
 	Func->FunctionFlags = Flgs;)";
@@ -496,6 +560,24 @@ std::string CppGenerator::GenerateSingleFunction(const FunctionWrapper& Func, co
 
 	const bool bIsNativeFunc = Func.HasFunctionFlag(EFunctionFlags::Native);
 
+	/* RPCs need ProcessEvent to be routed to the server/clients, events may be overriden by blueprints */
+	bool bCallExecFunctionDirectly = CppSettings::bCallNativeFunctionsDirectly && bIsNativeFunc && !Func.HasFunctionFlag(EFunctionFlags::Net)
+		&& !Func.HasFunctionFlag(EFunctionFlags::Event) && !Func.HasFunctionFlag(EFunctionFlags::BlueprintEvent);
+
+	/* NativeCall::Invoke passes the out-parameters to the thunk in a fixed-size list, functions with more of them stay on ProcessEvent */
+	if (bCallExecFunctionDirectly && Func.HasFunctionFlag(EFunctionFlags::HasOutParms))
+	{
+		int32 NumOutParms = 0x0;
+
+		for (UEProperty Param : UnrealFunc.GetProperties())
+		{
+			if (Param.HasPropertyFlags(EPropertyFlags::OutParm))
+				NumOutParms++;
+		}
+
+		bCallExecFunctionDirectly = NumOutParms <= NativeCallMaxOutParms;
+	}
+
 	static auto PrefixQuotsWithBackslash = [](std::string&& Str) -> std::string
 	{
 		for (int i = 0; i < Str.size(); i++)
@@ -513,52 +595,74 @@ std::string CppGenerator::GenerateSingleFunction(const FunctionWrapper& Func, co
 	std::string FixedOuterName = PrefixQuotsWithBackslash(UnrealFunc.GetOuter().GetName());
 	std::string FixedFunctionName = PrefixQuotsWithBackslash(UnrealFunc.GetName());
 
-	// Function implementation generation
-	std::string FunctionImplementation = std::format(R"(
+	TextBuffer::ScratchString FuncLookupString;
+
+	/* Functions of packages are looked up by their index in the package's function table, see GenerateFunctionTable */
+	if (CppSettings::bAddFunctionTables && CurrentFunctionTable)
+	{
+		TextBuffer::AppendFormat(*FuncLookupString, "\tclass UFunction* Func = {}::Get({}, {});\n", CurrentFunctionTable->Name, CurrentFunctionTable->Entries.size(), Func.IsStatic() ? "StaticClass()" : "Class");
+
+		CurrentFunctionTable->Entries.emplace_back(std::move(FixedOuterName), std::move(FixedFunctionName));
+	}
+	else
+	{
+		TextBuffer::AppendFormat(*FuncLookupString, R"(	static class UFunction* Func = nullptr;
+
+	if (Func == nullptr)
+		Func = {}->GetFunction("{}", "{}");
+)", Func.IsStatic() ? "StaticClass()" : "Class", FixedOuterName, FixedFunctionName);
+	}
+
+	TextBuffer::ScratchString CallString;
+
+	if (bCallExecFunctionDirectly)
+	{
+		TextBuffer::AppendFormat(*CallString, "NativeCall::Invoke({}, Func, {}, {});", Func.IsStatic() ? "GetDefaultObj()" : "this", bHasParams ? "&Parms" : "nullptr", !FuncInfo.bIsReturningVoid ? "&Parms.ReturnValue" : "nullptr");
+	}
+	else
+	{
+		TextBuffer::AppendFormat(*CallString, "{}ProcessEvent(Func, {});", Func.IsStatic() ? "GetDefaultObj()->" : "UObject::", bHasParams ? "&Parms" : "nullptr");
+	}
+
+	/* The 'Native' flag is only set temporarily when calling through ProcessEvent */
+	const bool bStoreFunctionFlags = bIsNativeFunc && !bCallExecFunctionDirectly;
+
+	// Function implementation generation, written straight into the file-buffer
+	TextBuffer::AppendFormat(FunctionFile.GetBuffer(), R"(
 // {}
 // ({})
 {}
 {} {}::{}{}
 {{
-	static class UFunction* Func = nullptr;
-
-	if (Func == nullptr)
-		Func = {}->GetFunction("{}", "{}");
-{}{}{}
-	{}ProcessEvent(Func, {});{}{}{}{}
+{}{}{}{}
+	{}{}{}{}{}
 }}
 
 )", UnrealFunc.GetFullName()
 , StringifyFunctionFlags(FuncInfo.FuncFlags)
-, bHasParams ? ParamDescriptionCommentString : ""
+, bHasParams ? std::string_view(ParamDescriptionCommentString) : ""
 , FuncInfo.RetType
 , StructName
 , FuncInfo.FuncNameWithParams
 , bIsConstFunc ? " const" : ""
-, Func.IsStatic() ? "StaticClass()" : "Class"
-, FixedOuterName
-, FixedFunctionName
-, bHasParams ? ParamVarCreationString : ""
-, bHasParamsToInit ? ParamAssignments : ""
-, bIsNativeFunc ? StoreFunctionFlagsString : ""
-, Func.IsStatic() ? "GetDefaultObj()->" : "UObject::"
-, bHasParams ? "&Parms" : "nullptr"
-, bIsNativeFunc ? RestoreFunctionFlagsString : ""
-, bHasOutRefParamsToInit ? OutRefAssignments : ""
-, bHasOutPtrParamsToInit ? OutPtrAssignments : ""
+, std::string_view(FuncLookupString)
+, bHasParams ? std::string_view(ParamVarCreationString) : ""
+, bHasParamsToInit ? std::string_view(ParamAssignments) : ""
+, bStoreFunctionFlags ? StoreFunctionFlagsString : ""
+, std::string_view(CallString)
+, bStoreFunctionFlags ? RestoreFunctionFlagsString : ""
+, bHasOutRefParamsToInit ? std::string_view(OutRefAssignments) : ""
+, bHasOutPtrParamsToInit ? std::string_view(OutPtrAssignments) : ""
 , !FuncInfo.bIsReturningVoid ? ReturnValueString : "");
-
-	FunctionFile << FunctionImplementation;
-
-	return InHeaderFunctionText;
 }
 
-std::string CppGenerator::GenerateFunctions(const StructWrapper& Struct, const MemberManager& Members, const std::string& StructName, StreamType& FunctionFile, StreamType& ParamFile)
+void CppGenerator::GenerateFunctions(std::string& InHeaderFunctionText, const StructWrapper& Struct, const MemberManager& Members, const std::string& StructName, StreamType& FunctionFile, StreamType& ParamFile)
 {
 	namespace CppSettings = Settings::CppGenerator;
 
-	static PredefinedFunction StaticClass;
-	static PredefinedFunction GetDefaultObj;
+	/* thread_local, the bodies of these functions are modified for every class and packages may be generated in parallel */
+	thread_local PredefinedFunction StaticClass;
+	thread_local PredefinedFunction GetDefaultObj;
 
 	if (StaticClass.NameWithParams.empty())
 		StaticClass = {
@@ -581,8 +685,6 @@ std::string CppGenerator::GenerateFunctions(const StructWrapper& Struct, const M
 		.bIsBodyInline = true,
 	};
 
-	std::string InHeaderFunctionText;
-
 	bool bIsFirstIteration = true;
 	bool bDidSwitch = false;
 	bool bWasLastFuncStatic = false;
@@ -607,12 +709,12 @@ std::string CppGenerator::GenerateFunctions(const StructWrapper& Struct, const M
 		bIsFirstIteration = false;
 		bDidSwitch = false;
 
-		InHeaderFunctionText += GenerateSingleFunction(Func, StructName, FunctionFile, ParamFile);
+		GenerateSingleFunction(InHeaderFunctionText, Func, StructName, FunctionFile, ParamFile);
 	}
 
 	/* Skip predefined classes, all structs and classes which don't inherit from UObject (very rare). */
 	if (!Struct.IsUnrealStruct() || !Struct.IsClass() || !Struct.GetSuper().IsValid())
-		return InHeaderFunctionText;
+		return;
 
 	/* Special spacing for UClass specific functions 'StaticClass' and 'GetDefaultObj' */
 	if (bWasLastFuncInline != StaticClass.bIsBodyInline && !bIsFirstIteration)
@@ -628,12 +730,12 @@ std::string CppGenerator::GenerateFunctions(const StructWrapper& Struct, const M
 
 	std::string Name = !bIsNameUnique ? Struct.GetFullName() : Struct.GetRawName();
 	std::string NameText = CppSettings::XORString ? std::format("{}(\"{}\")", CppSettings::XORString, Name) : std::format("\"{}\"", Name);
-	
 
-	static UEClass BPGeneratedClass = nullptr;
+	if (CurrentStaticClasses)
+		CurrentStaticClasses->emplace_back(Name, !bIsNameUnique);
 	
-	if (BPGeneratedClass == nullptr)
-		BPGeneratedClass = ObjectArray::FindClassFast("BlueprintGeneratedClass");
+
+	static const UEClass BPGeneratedClass = ObjectArray::FindClassFast("BlueprintGeneratedClass");
 
 
 	const char* StaticClassImplFunctionName = "StaticClassImpl";
@@ -667,10 +769,27 @@ R"({{
 
 
 	std::shared_ptr<StructWrapper> CurrentStructPtr = std::make_shared<StructWrapper>(Struct);
-	InHeaderFunctionText += GenerateSingleFunction(FunctionWrapper(CurrentStructPtr, &StaticClass), StructName, FunctionFile, ParamFile);
-	InHeaderFunctionText += GenerateSingleFunction(FunctionWrapper(CurrentStructPtr, &GetDefaultObj), StructName, FunctionFile, ParamFile);
+	GenerateSingleFunction(InHeaderFunctionText, FunctionWrapper(CurrentStructPtr, &StaticClass), StructName, FunctionFile, ParamFile);
+	GenerateSingleFunction(InHeaderFunctionText, FunctionWrapper(CurrentStructPtr, &GetDefaultObj), StructName, FunctionFile, ParamFile);
+
+	if constexpr (CppSettings::bAddClassBaseChains)
+	{
+		const UEClass Class = Struct.GetUnrealStruct().Cast<UEClass>();
+		const UEClass SuperClass = Struct.GetSuper().GetUnrealStruct().Cast<UEClass>();
+
+		int32 Depth = 0x0;
 
-	return InHeaderFunctionText;
+		for (UEStruct Super = Class.GetSuper(); Super; Super = Super.GetSuper())
+			Depth++;
+
+		/* Only the cast-flags this class adds, if any. Subclasses inherit all of them. */
+		const uint64 OwnCastFlags = static_cast<uint64>(Class.GetCastFlags()) & ~static_cast<uint64>(SuperClass.GetCastFlags());
+
+		TextBuffer::AppendFormat(InHeaderFunctionText, R"(
+	static constexpr int32 ClassDepth = 0x{:X};
+	static constexpr EClassCastFlags ClassCastFlag = static_cast<EClassCastFlags>(0x{:X});
+)", Depth, OwnCastFlags);
+	}
 }
 
 void CppGenerator::GenerateStruct(const StructWrapper& Struct, StreamType& StructFile, StreamType& FunctionFile, StreamType& ParamFile, int32 PackageIndex, const std::string& StructNameOverride)
@@ -715,10 +834,18 @@ void CppGenerator::GenerateStruct(const StructWrapper& Struct, StreamType& Struc
 	const bool bHasReusedTrailingPadding = Struct.HasReusedTrailingPadding();
 
 
-	StructFile << std::format(R"(
+	/* The struct is written straight into the file-buffer, no intermediate strings are created for members or functions */
+	std::string& StructText = StructFile.GetBuffer();
+
+	TextBuffer::ScratchString AlignasText;
+
+	if (Struct.ShouldUseExplicitAlignment() || bHasReusedTrailingPadding)
+		TextBuffer::AppendFormat(*AlignasText, "alignas(0x{:02X}) ", Struct.GetAlignment());
+
+	TextBuffer::AppendFormat(StructText, R"(
 // {}
 // Size -> 0x{:04X} (FullSize[0x{:04X}] - InheritedSize[0x{:04X}])
-{}{}{} {}{}{}{}
+{}{}{} {}{}{}{}{}
 {{
 )", Struct.GetFullName()
   , StructSizeWithoutSuper
@@ -727,10 +854,11 @@ void CppGenerator::GenerateStruct(const StructWrapper& Struct, StreamType& Struc
   , bHasReusedTrailingPadding ? "#pragma pack(push, 0x1)\n" : ""
   , Struct.HasCustomTemplateText() ? (Struct.GetCustomTemplateText() + "\n") : ""
   , bIsClass ? "class" : (bIsUnion ? "union" : "struct")
-  , Struct.ShouldUseExplicitAlignment() || bHasReusedTrailingPadding ? std::format("alignas(0x{:02X}) ", Struct.GetAlignment()) : ""
+  , AlignasText.Get()
   , UniqueName
   , Struct.IsFinal() ? " final" : ""
-  , bHasValidSuper ? (" : public " + UniqueSuperName) : "");
+  , bHasValidSuper ? " : public " : ""
+  , UniqueSuperName);
 
 	MemberManager Members = Struct.GetMembers();
 
@@ -740,23 +868,30 @@ void CppGenerator::GenerateStruct(const StructWrapper& Struct, StreamType& Struc
 	const bool bHasFunctions = (Members.HasFunctions() && !Struct.IsFunction()) || bHasStaticClass;
 
 	if (bHasMembers || bHasFunctions)
-		StructFile << "public:\n";
+		StructText += "public:\n";
 
 	if (bHasMembers)
 	{
-		StructFile << GenerateMembers(Struct, Members, bIsReusingTrailingPaddingFromSuper ? UnalignedSuperSize : SuperSize, SuperLastMemberEnd, SuperAlignment, PackageIndex);
+		GenerateMembers(StructText, Struct, Members, bIsReusingTrailingPaddingFromSuper ? UnalignedSuperSize : SuperSize, SuperLastMemberEnd, SuperAlignment, PackageIndex);
 
 		if (bHasFunctions)
-			StructFile << "\npublic:\n";
+			StructText += "\npublic:\n";
 	}
 
+	/* Parameter-structs are written to 'ParamFile' while the in-header declarations are appended here, these are never the same file for structs with functions */
 	if (bHasFunctions)
-		StructFile << GenerateFunctions(Struct, Members, UniqueName, FunctionFile, ParamFile);
+		GenerateFunctions(StructText, Struct, Members, UniqueName, FunctionFile, ParamFile);
+
+	if constexpr (Settings::CppGenerator::bAddMemberReflection)
+	{
+		if (Struct.IsUnrealStruct())
+			GenerateMemberReflection(StructText, Struct, Members, PackageIndex);
+	}
 
-	StructFile << "};\n";
+	StructText += "};\n";
 
 	if (bHasReusedTrailingPadding)
-		StructFile << "#pragma pack(pop)\n";
+		StructText += "#pragma pack(pop)\n";
 
 	if constexpr (Settings::Debug::bGenerateInlineAssertionsForStructSize)
 	{
@@ -768,10 +903,10 @@ void CppGenerator::GenerateStruct(const StructWrapper& Struct, StreamType& Struc
 		const int32 StructSize = Struct.GetSize();
 
 		// Alignment assertions
-		StructFile << std::format("static_assert(alignof({}) == 0x{:06X}, \"Wrong alignment on {}\");\n", UniquePrefixedName, Struct.GetAlignment(), UniquePrefixedName);
+		TextBuffer::AppendFormat(StructText, "static_assert(alignof({}) == 0x{:06X}, \"Wrong alignment on {}\");\n", UniquePrefixedName, Struct.GetAlignment(), UniquePrefixedName);
 
 		// Size assertions
-		StructFile << std::format("static_assert(sizeof({}) == 0x{:06X}, \"Wrong size on {}\");\n", UniquePrefixedName, (StructSize > 0x0 ? StructSize : 0x1), UniquePrefixedName);
+		TextBuffer::AppendFormat(StructText, "static_assert(sizeof({}) == 0x{:06X}, \"Wrong size on {}\");\n", UniquePrefixedName, (StructSize > 0x0 ? StructSize : 0x1), UniquePrefixedName);
 	}
 
 
@@ -786,11 +921,234 @@ void CppGenerator::GenerateStruct(const StructWrapper& Struct, StreamType& Struc
 
 			std::string MemberName = Member.GetName();
 
-			StructFile << std::format("static_assert(offsetof({0}, {1}) == 0x{2:06X}, \"Member '{0}::{1}' has a wrong offset!\");\n", StructName, Member.GetName(), Member.GetOffset());
+			TextBuffer::AppendFormat(StructText, "static_assert(offsetof({0}, {1}) == 0x{2:06X}, \"Member '{0}::{1}' has a wrong offset!\");\n", StructName, Member.GetName(), Member.GetOffset());
 		}
 	}
 }
 
+CppGenerator::EMemberKind CppGenerator::GetMemberKind(const PropertyWrapper& Member)
+{
+	/* Predefined members only have a type-string */
+	if (!Member.IsUnrealProperty())
+		return EMemberKind::Unknown;
+
+	const UEProperty Property = Member.GetUnrealProperty();
+	const EClassCastFlags Flags = Property.GetCastFlags();
+
+	/* ClassProperty is also an ObjectProperty and SoftClassProperty a ClassProperty, the specialized kinds are checked first */
+	if (Flags & EClassCastFlags::BoolProperty)
+	{
+		return EMemberKind::Bool;
+	}
+	else if (Flags & EClassCastFlags::ByteProperty)
+	{
+		return Property.Cast<UEByteProperty>().GetEnum() ? EMemberKind::Enum : EMemberKind::UInt8;
+	}
+	else if (Flags & EClassCastFlags::EnumProperty)
+	{
+		return EMemberKind::Enum;
+	}
+	else if (Flags & EClassCastFlags::Int8Property)
+	{
+		return EMemberKind::Int8;
+	}
+	else if (Flags & EClassCastFlags::Int16Property)
+	{
+		return EMemberKind::Int16;
+	}
+	else if (Flags & EClassCastFlags::IntProperty)
+	{
+		return EMemberKind::Int32;
+	}
+	else if (Flags & EClassCastFlags::Int64Property)
+	{
+		return EMemberKind::Int64;
+	}
+	else if (Flags & EClassCastFlags::UInt16Property)
+	{
+		return EMemberKind::UInt16;
+	}
+	else if (Flags & EClassCastFlags::UInt32Property)
+	{
+		return EMemberKind::UInt32;
+	}
+	else if (Flags & EClassCastFlags::UInt64Property)
+	{
+		return EMemberKind::UInt64;
+	}
+	else if (Flags & EClassCastFlags::FloatProperty)
+	{
+		return EMemberKind::Float;
+	}
+	else if (Flags & EClassCastFlags::DoubleProperty)
+	{
+		return EMemberKind::Double;
+	}
+	else if (Flags & EClassCastFlags::NameProperty)
+	{
+		return EMemberKind::Name;
+	}
+	else if (Flags & EClassCastFlags::StrProperty)
+	{
+		return EMemberKind::String;
+	}
+	else if (Flags & EClassCastFlags::TextProperty)
+	{
+		return EMemberKind::Text;
+	}
+	else if (Flags & EClassCastFlags::WeakObjectProperty)
+	{
+		return EMemberKind::WeakObject;
+	}
+	else if (Flags & EClassCastFlags::LazyObjectProperty)
+	{
+		return EMemberKind::LazyObject;
+	}
+	else if ((Flags & EClassCastFlags::SoftObjectProperty) || (Flags & EClassCastFlags::SoftClassProperty))
+	{
+		return EMemberKind::SoftObject;
+	}
+	else if (Flags & EClassCastFlags::InterfaceProperty)
+	{
+		return EMemberKind::Interface;
+	}
+	else if ((Flags & EClassCastFlags::ObjectProperty) || (Flags & EClassCastFlags::ClassProperty))
+	{
+		return EMemberKind::Object;
+	}
+	else if (Flags & EClassCastFlags::StructProperty)
+	{
+		return EMemberKind::Struct;
+	}
+	else if (Flags & EClassCastFlags::ArrayProperty)
+	{
+		return EMemberKind::Array;
+	}
+	else if (Flags & EClassCastFlags::MapProperty)
+	{
+		return EMemberKind::Map;
+	}
+	else if (Flags & EClassCastFlags::SetProperty)
+	{
+		return EMemberKind::Set;
+	}
+	else if (Flags & EClassCastFlags::OptionalProperty)
+	{
+		return EMemberKind::Optional;
+	}
+	else if (Flags & EClassCastFlags::MulticastDelegateProperty)
+	{
+		return EMemberKind::MulticastDelegate;
+	}
+	else if (Flags & EClassCastFlags::DelegateProperty)
+	{
+		return EMemberKind::Delegate;
+	}
+	else if (Flags & EClassCastFlags::FieldPathProperty)
+	{
+		return EMemberKind::FieldPath;
+	}
+
+	return EMemberKind::Unknown;
+}
+
+uint64 CppGenerator::GetMemberTypeId(UEProperty Property)
+{
+	const EClassCastFlags Flags = Property.GetCastFlags();
+
+	auto GetTypeIdOf = [](UEObject Type) -> uint64
+	{
+		return Type ? HashReflectedTypeName(Type.GetFullName()) : 0x0;
+	};
+
+	if (Flags & EClassCastFlags::StructProperty)
+	{
+		return GetTypeIdOf(Property.Cast<UEStructProperty>().GetUnderlayingStruct());
+	}
+	else if (Flags & EClassCastFlags::ByteProperty)
+	{
+		return GetTypeIdOf(Property.Cast<UEByteProperty>().GetEnum());
+	}
+	else if (Flags & EClassCastFlags::EnumProperty)
+	{
+		return GetTypeIdOf(Property.Cast<UEEnumProperty>().GetEnum());
+	}
+	else if ((Flags & EClassCastFlags::ClassProperty) || (Flags & EClassCastFlags::SoftClassProperty))
+	{
+		/* TSubclassOf<T> refers to T, not to UClass */
+		return GetTypeIdOf(Property.Cast<UEClassProperty>().GetMetaClass());
+	}
+	else if (Property.IsType(EClassCastFlags::ObjectProperty | EClassCastFlags::WeakObjectProperty | EClassCastFlags::LazyObjectProperty | EClassCastFlags::SoftObjectProperty | EClassCastFlags::InterfaceProperty))
+	{
+		return GetTypeIdOf(Property.Cast<UEObjectProperty>().GetPropertyClass());
+	}
+	else if (Flags & EClassCastFlags::ArrayProperty)
+	{
+		return GetMemberTypeId(Property.Cast<UEArrayProperty>().GetInnerProperty());
+	}
+	else if (Flags & EClassCastFlags::SetProperty)
+	{
+		return GetMemberTypeId(Property.Cast<UESetProperty>().GetElementProperty());
+	}
+	else if (Flags & EClassCastFlags::MapProperty)
+	{
+		return GetMemberTypeId(Property.Cast<UEMapProperty>().GetValueProperty());
+	}
+	else if (Flags & EClassCastFlags::OptionalProperty)
+	{
+		return GetMemberTypeId(Property.Cast<UEOptionalProperty>().GetValueProperty());
+	}
+
+	return 0x0;
+}
+
+void CppGenerator::GenerateMemberReflection(std::string& OutText, const StructWrapper& Struct, const MemberManager& Members, int32 PackageIndex)
+{
+	const StructWrapper Super = Struct.GetSuper();
+
+	/* A cyclic Super is only a fixup-type in this package, its members are not visited */
+	const bool bHasReflectedSuper = Super.IsValid() && !Struct.IsFunction() && !Super.IsCyclicWithPackage(PackageIndex);
+
+	TextBuffer::ScratchString Descriptors;
+	int32 NumDescriptors = 0x0;
+
+	for (const PropertyWrapper& Member : Members.IterateMembers())
+	{
+		if (Member.IsStatic() || Member.IsZeroSizedMember())
+			continue;
+
+		uint8 BitMask = 0xFF;
+
+		if (Member.IsBitField())
+			BitMask = static_cast<uint8>(((0x1 << Member.GetBitCount()) - 1) << Member.GetBitIndex());
+
+		const uint64 TypeId = Member.IsUnrealProperty() ? GetMemberTypeId(Member.GetUnrealProperty()) : 0x0;
+
+		TextBuffer::AppendFormat(*Descriptors, "\t\tMemberReflection::FMemberDescriptor{{ \"{}\", 0x{:04X}, 0x{:04X}, 0x{:X}, MemberReflection::EMemberKind::{}, 0x{:02X}, 0x{:016X} }},\n"
+			, Member.GetName()
+			, Member.GetOffset()
+			, Member.GetSize()
+			, Member.GetArrayDim()
+			, MemberKindNames[static_cast<uint8>(GetMemberKind(Member))]
+			, BitMask
+			, TypeId);
+
+		NumDescriptors++;
+	}
+
+	TextBuffer::AppendFormat(OutText, R"(
+public:
+	using ReflectedSuper = {};
+	static constexpr uint64 ReflectedTypeId = 0x{:016X};
+	static constexpr std::array<MemberReflection::FMemberDescriptor, 0x{:X}> ReflectedMembers =
+	{{{{
+{}	}}}};
+)", bHasReflectedSuper ? GetStructPrefixedName(Super) : "void"
+  , HashReflectedTypeName(Struct.GetUnrealStruct().GetFullName())
+  , NumDescriptors
+  , Descriptors.Get());
+}
+
 void CppGenerator::GenerateEnum(const EnumWrapper& Enum, StreamType& StructFile)
 {
 	if (!Enum.IsValid())
@@ -799,18 +1157,18 @@ void CppGenerator::GenerateEnum(const EnumWrapper& Enum, StreamType& StructFile)
 	CollisionInfoIterator EnumValueIterator = Enum.GetMembers();
 
 	int32 NumValues = 0x0;
-	std::string MemberString;
+	TextBuffer::ScratchString MemberString;
 
 	for (const EnumCollisionInfo& Info : EnumValueIterator)
 	{
 		NumValues++;
-		MemberString += std::format("\t{:{}} = {},\n", Info.GetUniqueName(), 40, Info.GetValue());
+		TextBuffer::AppendFormat(*MemberString, "\t{:{}} = {},\n", Info.GetUniqueName(), 40, Info.GetValue());
 	}
 
-	if (!MemberString.empty()) [[likely]]
-		MemberString.pop_back();
+	if (!MemberString->empty()) [[likely]]
+		MemberString->pop_back();
 
-	StructFile << std::format(R"(
+	TextBuffer::AppendFormat(StructFile.GetBuffer(), R"(
 // {}
 // NumValues: 0x{:04X}
 enum class {} : {}
@@ -821,7 +1179,7 @@ enum class {} : {}
   , NumValues
   , GetEnumPrefixedName(Enum)
   , GetEnumUnderlayingType(Enum)
-  , MemberString);
+  , MemberString.Get());
 }
 
 std::string CppGenerator::GetStructPrefixedName(const StructWrapper& Struct)
@@ -867,14 +1225,9 @@ std::string CppGenerator::GetEnumUnderlayingType(const EnumWrapper& Enum)
 
 std::string CppGenerator::GetCycleFixupType(const StructWrapper& Struct, bool bIsForInheritance)
 {
-	static int32 UObjectSize = 0x0;
-	static int32 AActorSize = 0x0;
-
-	if (UObjectSize == 0x0 || AActorSize == 0x0)
-	{
-		UObjectSize = StructWrapper(ObjectArray::FindClassFast("Object")).GetSize();
-		AActorSize = StructWrapper(ObjectArray::FindClassFast("Actor")).GetSize();
-	}
+	/* Initialized once in a thread-safe manner, read-only afterwards */
+	static const int32 UObjectSize = StructWrapper(ObjectArray::FindClassFast("Object")).GetSize();
+	static const int32 AActorSize = StructWrapper(ObjectArray::FindClassFast("Actor")).GetSize();
 
 	/* Predefined structs can not be cyclic, unless you did something horribly wrong when defining the predefined struct! */
 	if (!Struct.IsUnrealStruct())
@@ -899,19 +1252,44 @@ std::string CppGenerator::GetCycleFixupType(const StructWrapper& Struct, bool bI
 }
 
 std::string CppGenerator::GetMemberTypeString(const PropertyWrapper& MemberWrapper, int32 PackageIndex, bool bAllowForConstPtrMembers)
+{
+	std::string Type;
+	AppendMemberTypeString(Type, MemberWrapper, PackageIndex, bAllowForConstPtrMembers);
+
+	return Type;
+}
+
+std::string CppGenerator::GetMemberTypeString(UEProperty Member, int32 PackageIndex, bool bAllowForConstPtrMembers)
+{
+	std::string Type;
+	AppendMemberTypeString(Type, Member, PackageIndex, bAllowForConstPtrMembers);
+
+	return Type;
+}
+
+std::string CppGenerator::GetMemberTypeStringWithoutConst(UEProperty Member, int32 PackageIndex)
+{
+	std::string Type;
+	AppendMemberTypeStringWithoutConst(Type, Member, PackageIndex);
+
+	return Type;
+}
+
+void CppGenerator::AppendMemberTypeString(std::string& Out, const PropertyWrapper& MemberWrapper, int32 PackageIndex, bool bAllowForConstPtrMembers)
 {
 	if (!MemberWrapper.IsUnrealProperty())
 	{
 		if (MemberWrapper.IsStatic() && !MemberWrapper.IsZeroSizedMember())
-			return "static " + MemberWrapper.GetType();
+			Out += "static ";
 
-		return MemberWrapper.GetType();
+		Out += MemberWrapper.GetType();
+		return;
 	}
 
-	return GetMemberTypeString(MemberWrapper.GetUnrealProperty(), PackageIndex, bAllowForConstPtrMembers);
+	AppendMemberTypeString(Out, MemberWrapper.GetUnrealProperty(), PackageIndex, bAllowForConstPtrMembers);
 }
 
-std::string CppGenerator::GetMemberTypeString(UEProperty Member, int32 PackageIndex, bool bAllowForConstPtrMembers)
+void CppGenerator::AppendMemberTypeString(std::string& Out, UEProperty Member, int32 PackageIndex, bool bAllowForConstPtrMembers)
 {
 	static auto IsMemberPtr = [](UEProperty Mem) -> bool
 	{
@@ -922,180 +1300,205 @@ std::string CppGenerator::GetMemberTypeString(UEProperty Member, int32 PackageIn
 	};
 
 	if (bAllowForConstPtrMembers && Member.HasPropertyFlags(EPropertyFlags::ConstParm) && IsMemberPtr(Member))
-		return "const " + GetMemberTypeStringWithoutConst(Member, PackageIndex);
+		Out += "const ";
 
-	return GetMemberTypeStringWithoutConst(Member, PackageIndex);
+	AppendMemberTypeStringWithoutConst(Out, Member, PackageIndex);
 }
 
-std::string CppGenerator::GetMemberTypeStringWithoutConst(UEProperty Member, int32 PackageIndex)
+void CppGenerator::AppendMemberTypeStringWithoutConst(std::string& Out, UEProperty Member, int32 PackageIndex)
 {
 	auto [Class, FieldClass] = Member.GetClass();
 
 	EClassCastFlags Flags = Class ? Class.GetCastFlags() : FieldClass.GetCastFlags();
 
+	/* "Template<class Name>", or 'FallbackType' if 'PropertyClass' is invalid */
+	auto AppendClassTemplate = [&Out](const char* TemplateName, UEClass PropertyClass, const char* FallbackType) -> void
+	{
+		if (!PropertyClass)
+		{
+			Out += FallbackType;
+			return;
+		}
+
+		TextBuffer::AppendFormat(Out, "{}<class {}>", TemplateName, GetStructPrefixedName(PropertyClass));
+	};
+
 	if (Flags & EClassCastFlags::ByteProperty)
 	{
 		if (UEEnum Enum = Member.Cast<UEByteProperty>().GetEnum())
-			return GetEnumPrefixedName(Enum);
+		{
+			Out += GetEnumPrefixedName(Enum);
+			return;
+		}
 
-		return "uint8";
+		Out += "uint8";
 	}
 	else if (Flags & EClassCastFlags::UInt16Property)
 	{
-		return "uint16";
+		Out += "uint16";
 	}
 	else if (Flags & EClassCastFlags::UInt32Property)
 	{
-		return "uint32";
+		Out += "uint32";
 	}
 	else if (Flags & EClassCastFlags::UInt64Property)
 	{
-		return "uint64";
+		Out += "uint64";
 	}
 	else if (Flags & EClassCastFlags::Int8Property)
 	{
-		return "int8";
+		Out += "int8";
 	}
 	else if (Flags & EClassCastFlags::Int16Property)
 	{
-		return "int16";
+		Out += "int16";
 	}
 	else if (Flags & EClassCastFlags::IntProperty)
 	{
-		return "int32";
+		Out += "int32";
 	}
 	else if (Flags & EClassCastFlags::Int64Property)
 	{
-		return "int64";
+		Out += "int64";
 	}
 	else if (Flags & EClassCastFlags::FloatProperty)
 	{
-		return "float";
+		Out += "float";
 	}
 	else if (Flags & EClassCastFlags::DoubleProperty)
 	{
-		return "double";
+		Out += "double";
 	}
 	else if (Flags & EClassCastFlags::ClassProperty)
 	{
 		if (Member.HasPropertyFlags(EPropertyFlags::UObjectWrapper))
-			return std::format("TSubclassOf<class {}>", GetStructPrefixedName(Member.Cast<UEClassProperty>().GetMetaClass()));
+		{
+			TextBuffer::AppendFormat(Out, "TSubclassOf<class {}>", GetStructPrefixedName(Member.Cast<UEClassProperty>().GetMetaClass()));
+			return;
+		}
 
-		return "class UClass*";
+		Out += "class UClass*";
 	}
 	else if (Flags & EClassCastFlags::NameProperty)
 	{
-		return "class FName";
+		Out += "class FName";
 	}
 	else if (Flags & EClassCastFlags::StrProperty)
 	{
-		return "class FString";
+		Out += "class FString";
 	}
 	else if (Flags & EClassCastFlags::TextProperty)
 	{
-		return "class FText";
+		Out += "class FText";
 	}
 	else if (Flags & EClassCastFlags::BoolProperty)
 	{
-		return Member.Cast<UEBoolProperty>().IsNativeBool() ? "bool" : "uint8";
+		Out += Member.Cast<UEBoolProperty>().IsNativeBool() ? "bool" : "uint8";
 	}
 	else if (Flags & EClassCastFlags::StructProperty)
 	{
 		const StructWrapper& UnderlayingStruct = Member.Cast<UEStructProperty>().GetUnderlayingStruct();
 
 		if (UnderlayingStruct.IsCyclicWithPackage(PackageIndex)) [[unlikely]]
-			return std::format("{}", GetCycleFixupType(UnderlayingStruct, false));
+		{
+			Out += GetCycleFixupType(UnderlayingStruct, false);
+			return;
+		}
 
-		return std::format("struct {}", GetStructPrefixedName(UnderlayingStruct));
+		Out += "struct ";
+		Out += GetStructPrefixedName(UnderlayingStruct);
 	}
 	else if (Flags & EClassCastFlags::ArrayProperty)
 	{
-		return std::format("TArray<{}>", GetMemberTypeStringWithoutConst(Member.Cast<UEArrayProperty>().GetInnerProperty(), PackageIndex));
+		Out += "TArray<";
+		AppendMemberTypeStringWithoutConst(Out, Member.Cast<UEArrayProperty>().GetInnerProperty(), PackageIndex);
+		Out += '>';
 	}
 	else if (Flags & EClassCastFlags::WeakObjectProperty)
 	{
-		if (UEClass PropertyClass = Member.Cast<UEWeakObjectProperty>().GetPropertyClass())
-			return std::format("TWeakObjectPtr<class {}>", GetStructPrefixedName(PropertyClass));
-
-		return "TWeakObjectPtr<class UObject>";
+		AppendClassTemplate("TWeakObjectPtr", Member.Cast<UEWeakObjectProperty>().GetPropertyClass(), "TWeakObjectPtr<class UObject>");
 	}
 	else if (Flags & EClassCastFlags::LazyObjectProperty)
 	{
-		if (UEClass PropertyClass = Member.Cast<UELazyObjectProperty>().GetPropertyClass())
-			return std::format("TLazyObjectPtr<class {}>", GetStructPrefixedName(PropertyClass));
-
-		return "TLazyObjectPtr<class UObject>";
+		AppendClassTemplate("TLazyObjectPtr", Member.Cast<UELazyObjectProperty>().GetPropertyClass(), "TLazyObjectPtr<class UObject>");
 	}
 	else if (Flags & EClassCastFlags::SoftClassProperty)
 	{
-		if (UEClass PropertyClass = Member.Cast<UESoftClassProperty>().GetPropertyClass())
-			return std::format("TSoftClassPtr<class {}>", GetStructPrefixedName(PropertyClass));
-
-		return "TSoftClassPtr<class UObject>";
+		AppendClassTemplate("TSoftClassPtr", Member.Cast<UESoftClassProperty>().GetPropertyClass(), "TSoftClassPtr<class UObject>");
 	}
 	else if (Flags & EClassCastFlags::SoftObjectProperty)
 	{
-		if (UEClass PropertyClass = Member.Cast<UESoftObjectProperty>().GetPropertyClass())
-			return std::format("TSoftObjectPtr<class {}>", GetStructPrefixedName(PropertyClass));
-
-		return "TSoftObjectPtr<class UObject>";
+		AppendClassTemplate("TSoftObjectPtr", Member.Cast<UESoftObjectProperty>().GetPropertyClass(), "TSoftObjectPtr<class UObject>");
 	}
 	else if (Flags & EClassCastFlags::ObjectProperty)
 	{
 		if (UEClass PropertyClass = Member.Cast<UEObjectProperty>().GetPropertyClass())
-			return std::format("class {}*", GetStructPrefixedName(PropertyClass));
+		{
+			TextBuffer::AppendFormat(Out, "class {}*", GetStructPrefixedName(PropertyClass));
+			return;
+		}
 
-		return "class UObject*";
+		Out += "class UObject*";
 	}
 	else if (Flags & EClassCastFlags::MapProperty)
 	{
 		UEMapProperty MemberAsMapProperty = Member.Cast<UEMapProperty>();
 
-		return std::format("TMap<{}, {}>", GetMemberTypeStringWithoutConst(MemberAsMapProperty.GetKeyProperty(), PackageIndex), GetMemberTypeStringWithoutConst(MemberAsMapProperty.GetValueProperty(), PackageIndex));
+		Out += "TMap<";
+		AppendMemberTypeStringWithoutConst(Out, MemberAsMapProperty.GetKeyProperty(), PackageIndex);
+		Out += ", ";
+		AppendMemberTypeStringWithoutConst(Out, MemberAsMapProperty.GetValueProperty(), PackageIndex);
+		Out += '>';
 	}
 	else if (Flags & EClassCastFlags::SetProperty)
 	{
-		return std::format("TSet<{}>", GetMemberTypeStringWithoutConst(Member.Cast<UESetProperty>().GetElementProperty(), PackageIndex));
+		Out += "TSet<";
+		AppendMemberTypeStringWithoutConst(Out, Member.Cast<UESetProperty>().GetElementProperty(), PackageIndex);
+		Out += '>';
 	}
 	else if (Flags & EClassCastFlags::EnumProperty)
 	{
 		if (UEEnum Enum = Member.Cast<UEEnumProperty>().GetEnum())
-			return GetEnumPrefixedName(Enum);
+		{
+			Out += GetEnumPrefixedName(Enum);
+			return;
+		}
 
-		return GetMemberTypeStringWithoutConst(Member.Cast<UEEnumProperty>().GetUnderlayingProperty(), PackageIndex);
+		AppendMemberTypeStringWithoutConst(Out, Member.Cast<UEEnumProperty>().GetUnderlayingProperty(), PackageIndex);
 	}
 	else if (Flags & EClassCastFlags::InterfaceProperty)
 	{
-		if (UEClass PropertyClass = Member.Cast<UEInterfaceProperty>().GetPropertyClass())
-			return std::format("TScriptInterface<class {}>", GetStructPrefixedName(PropertyClass));
-
-		return "TScriptInterface<class IInterface>";
+		AppendClassTemplate("TScriptInterface", Member.Cast<UEInterfaceProperty>().GetPropertyClass(), "TScriptInterface<class IInterface>");
 	}
 	else if (Flags & EClassCastFlags::DelegateProperty)
 	{
 		if (UEFunction SignatureFunc = Member.Cast<UEDelegateProperty>().GetSignatureFunction()) [[likely]]
-			return std::format("TDelegate<{}>", GetFunctionSignature(SignatureFunc));
+		{
+			TextBuffer::AppendFormat(Out, "TDelegate<{}>", GetFunctionSignature(SignatureFunc));
+			return;
+		}
 
-		return "TDelegate<void()>";
+		Out += "TDelegate<void()>";
 	}
 	else if (Flags & EClassCastFlags::FieldPathProperty)
 	{
-		return std::format("TFieldPath<struct {}>", Member.Cast<UEFieldPathProperty>().GetFielClass().GetCppName());
+		TextBuffer::AppendFormat(Out, "TFieldPath<struct {}>", Member.Cast<UEFieldPathProperty>().GetFielClass().GetCppName());
 	}
 	else if (Flags & EClassCastFlags::OptionalProperty)
 	{
 		UEProperty ValueProperty = Member.Cast<UEOptionalProperty>().GetValueProperty();
 
-		/* Check if there is an additional 'bool' flag in the TOptional to check if the value is set */
-		if (Member.GetSize() > ValueProperty.GetSize()) [[likely]]
-			return std::format("TOptional<{}>", GetMemberTypeStringWithoutConst(ValueProperty, PackageIndex));
+		Out += "TOptional<";
+		AppendMemberTypeStringWithoutConst(Out, ValueProperty, PackageIndex);
 
-		return std::format("TOptional<{}, true>", GetMemberTypeStringWithoutConst(ValueProperty, PackageIndex));
+		/* Check if there is an additional 'bool' flag in the TOptional to check if the value is set */
+		Out += Member.GetSize() > ValueProperty.GetSize() ? ">" : ", true>";
 	}
 	else
 	{
 		/* When changing this also change 'GetUnknownProperties()' */
-		return (Class ? Class.GetCppName() : FieldClass.GetCppName()) + "_";
+		Out += (Class ? Class.GetCppName() : FieldClass.GetCppName());
+		Out += '_';
 	}
 }
 
@@ -1163,9 +1566,9 @@ std::string CppGenerator::GetFunctionSignature(UEFunction Func)
 }
 
 
-std::unordered_map<std::string, UEProperty> CppGenerator::GetUnknownProperties()
+std::map<std::string, UEProperty> CppGenerator::GetUnknownProperties()
 {
-	std::unordered_map<std::string, UEProperty> PropertiesWithNames;
+	std::map<std::string, UEProperty> PropertiesWithNames;
 
 	for (UEObject Obj : ObjectArray())
 	{
@@ -1187,11 +1590,406 @@ std::unordered_map<std::string, UEProperty> CppGenerator::GetUnknownProperties()
 	return PropertiesWithNames;
 }
 
+void CppGenerator::GenerateFunctionTable(StreamType& FunctionFile, PackageInfoHandle Package, const FunctionTable& Table)
+{
+	std::string& Out = FunctionFile.GetBuffer();
+
+	/* Name of the package-object, not the (unique) name of the package-files */
+	const std::string PackageObjectName = ObjectArray::GetByIndex(Package.GetIndex()).GetName();
+
+	TextBuffer::AppendFormat(Out, R"(
+/*
+* Resolved with a single pass over GObjects on the first call. GObjects is only scanned again once it has grown, functions that
+* are still missing are looked up in their class with UClass::GetFunction.
+*/
+namespace {}
+{{
+	static constexpr const char* PackageName = "{}";
+
+	static constexpr BasicFilesImpleUtils::FunctionTableKey Keys[] = {{
+)", Table.Name, PackageObjectName);
+
+	for (const FunctionTableEntry& Entry : Table.Entries)
+		TextBuffer::AppendFormat(Out, "\t\t{{ \"{}\", \"{}\" }},\n", Entry.OuterName, Entry.FunctionName);
+
+	Out += R"(	};
+
+	static constexpr int32 NumFunctions = sizeof(Keys) / sizeof(Keys[0]);
+
+	static std::atomic<class UFunction*> Functions[NumFunctions] = {};
+
+	/* GObjects->Num() at the last pass over GObjects */
+	static std::atomic<int32> NumScannedObjects = -1;
+
+	class UFunction* Get(int32 Index, const class UClass* Class)
+	{
+		class UFunction* Func = Functions[Index].load(std::memory_order_acquire);
+
+		if (Func == nullptr) [[unlikely]]
+		{
+			if (UObject::GObjects->Num() > NumScannedObjects.load(std::memory_order_acquire))
+			{
+				BasicFilesImpleUtils::ResolveFunctionTable(PackageName, Keys, Functions, NumFunctions, NumScannedObjects);
+				Func = Functions[Index].load(std::memory_order_acquire);
+			}
+
+			if (Func == nullptr)
+			{
+				Func = Class->GetFunction(Keys[Index].OuterName, Keys[Index].FunctionName);
+
+				if (Func)
+					Functions[Index].store(Func, std::memory_order_release);
+			}
+		}
+
+		return Func;
+	}
+}
+
+)";
+}
+
+bool CppGenerator::BuildStaticClassPerfectHash(std::vector<StaticClassTableEntry>& Entries, StaticClassPerfectHash& OutHash)
+{
+	ProfilerScope Scope("CppGenerator::BuildStaticClassPerfectHash");
+
+	/* Average number of names per bucket, higher values make the table smaller but the construction slower */
+	constexpr uint32 NamesPerBucket = 0x4;
+
+	constexpr uint64 MaxSeeds = 0x20;
+	constexpr uint64 MaxTriesPerBucket = 0x1000000;
+
+	const uint32 NumSlots = static_cast<uint32>(Entries.size());
+	const uint32 NumBuckets = std::max((NumSlots + NamesPerBucket - 1) / NamesPerBucket, 1u);
+
+	std::vector<uint64> Hashes(NumSlots);
+	std::vector<uint32> BucketOrder(NumBuckets);
+	std::vector<std::vector<uint32>> Buckets(NumBuckets);
+
+	/* Entry placed into each slot, -1 if the slot is free */
+	std::vector<int32> SlotEntries(NumSlots);
+
+	/* Slots of the bucket that is currently placed, marked with the number of the current try so they don't need to be cleared */
+	std::vector<uint64> SlotTries(NumSlots);
+	std::vector<uint32> BucketSlots;
+
+	for (uint64 Seed = 0x0; Seed < MaxSeeds; Seed++)
+	{
+		for (uint32 i = 0; i < NumSlots; i++)
+			Hashes[i] = HashStaticClassName(Entries[i].Name, Entries[i].bIsFullName, Seed);
+
+		/* The full hash is used to verify lookups in the SDK, so it has to be unique */
+		std::vector<uint64> SortedHashes = Hashes;
+		std::sort(SortedHashes.begin(), SortedHashes.end());
+
+		if (std::adjacent_find(SortedHashes.begin(), SortedHashes.end()) != SortedHashes.end())
+			continue;
+
+		for (std::vector<uint32>& Bucket : Buckets)
+			Bucket.clear();
+
+		for (uint32 i = 0; i < NumSlots; i++)
+			Buckets[static_cast<uint32>(Hashes[i] >> 32) % NumBuckets].push_back(i);
+
+		/* Largest buckets first, while most slots are still free */
+		std::iota(BucketOrder.begin(), BucketOrder.end(), 0);
+		std::stable_sort(BucketOrder.begin(), BucketOrder.end(), [&Buckets](uint32 Left, uint32 Right) -> bool
+		{
+			return Buckets[Left].size() > Buckets[Right].size();
+		});
+
+		std::fill(SlotEntries.begin(), SlotEntries.end(), -1);
+		std::fill(SlotTries.begin(), SlotTries.end(), 0x0);
+
+		OutHash.Seed = Seed;
+		OutHash.Displacements.assign(NumBuckets, StaticClassDisplacement{ 0x0, 0x0 });
+
+		uint64 TryCounter = 0x0;
+		bool bPlacedAllBuckets = true;
+
+		for (const uint32 BucketIdx : BucketOrder)
+		{
+			const std::vector<uint32>& Bucket = Buckets[BucketIdx];
+
+			if (Bucket.empty())
+				break;
+
+			bool bPlacedBucket = false;
+
+			/* Displacements are tried in order, the same input always results in the same table */
+			for (uint64 Try = 0x0; Try < MaxTriesPerBucket && !bPlacedBucket; Try++)
+			{
+				const uint32 D0 = static_cast<uint32>(Try / NumSlots);
+				const uint32 D1 = static_cast<uint32>(Try % NumSlots);
+
+				TryCounter++;
+				BucketSlots.clear();
+
+				bPlacedBucket = true;
+
+				for (const uint32 EntryIdx : Bucket)
+				{
+					const uint32 Slot = GetStaticClassSlot(Hashes[EntryIdx], StaticClassDisplacement{ D0, D1 }, NumSlots);
+
+					if (SlotEntries[Slot] != -1 || SlotTries[Slot] == TryCounter)
+					{
+						bPlacedBucket = false;
+						break;
+					}
+
+					SlotTries[Slot] = TryCounter;
+					BucketSlots.push_back(Slot);
+				}
+
+				if (!bPlacedBucket)
+					continue;
+
+				for (uint32 i = 0; i < Bucket.size(); i++)
+					SlotEntries[BucketSlots[i]] = static_cast<int32>(Bucket[i]);
+
+				OutHash.Displacements[BucketIdx] = StaticClassDisplacement{ D0, D1 };
+			}
+
+			if (!bPlacedBucket)
+			{
+				bPlacedAllBuckets = false;
+				break;
+			}
+		}
+
+		if (!bPlacedAllBuckets)
+			continue;
+
+		/* Reorder the entries by slot, the SDK verifies a lookup by comparing the hash of the entry in the slot */
+		std::vector<StaticClassTableEntry> EntriesBySlot(NumSlots);
+
+		for (uint32 i = 0; i < NumSlots; i++)
+			EntriesBySlot[i] = std::move(Entries[SlotEntries[i]]);
+
+		Entries = std::move(EntriesBySlot);
+
+		return true;
+	}
+
+	OutHash.Seed = 0x0;
+	OutHash.Displacements.clear();
+
+	return false;
+}
+
+void CppGenerator::GenerateStaticClassTable(StreamType& BasicCpp)
+{
+	std::string& Out = BasicCpp.GetBuffer();
+
+	const bool bHasFullNames = std::any_of(StaticClassTable.begin(), StaticClassTable.end(), [](const StaticClassTableEntry& Entry) -> bool { return Entry.bIsFullName; });
+
+	Out += R"(
+namespace StaticClassTable
+{
+	struct FEntry
+	{
+		const char* Name;
+		uint64 Hash;
+		bool bIsFullName;
+	};
+
+	struct FDisplacement
+	{
+		uint32 D0;
+		uint32 D1;
+	};
+
+)";
+
+	TextBuffer::AppendFormat(Out, "\t/* Seed of 'HashClassName', chosen by the generator so the hashes of all names are unique */\n\tconstexpr uint64 Seed = 0x{:X};\n\n", StaticClassHash.Seed);
+	TextBuffer::AppendFormat(Out, "\t/* Whether any StaticClass() uses the full name, InitAll() only builds full names if one does */\n\tconstexpr bool bHasFullNames = {};\n", bHasFullNames);
+
+	Out += R"(
+	/* Names of all StaticClass() functions, every name is in the slot it hashes to */
+	static constexpr std::array Entries = {
+)";
+
+	for (const StaticClassTableEntry& Entry : StaticClassTable)
+		TextBuffer::AppendFormat(Out, "\t\tFEntry{{ \"{}\", 0x{:X}, {} }},\n", Entry.Name, HashStaticClassName(Entry.Name, Entry.bIsFullName, StaticClassHash.Seed), Entry.bIsFullName);
+
+	/* std::array can't deduce its type from an empty initializer-list */
+	if (StaticClassTable.empty())
+		Out += "\t\tFEntry{ \"\", 0x0, false },\n";
+
+	Out += R"(	};
+
+	/* One per bucket of names, moves all names of the bucket into free slots */
+	static constexpr std::array Displacements = {
+)";
+
+	for (const StaticClassDisplacement& Displacement : StaticClassHash.Displacements)
+		TextBuffer::AppendFormat(Out, "\t\tFDisplacement{{ 0x{:X}, 0x{:X} }},\n", Displacement.D0, Displacement.D1);
+
+	if (StaticClassHash.Displacements.empty())
+		Out += "\t\tFDisplacement{ 0x0, 0x0 },\n";
+
+	Out += R"(	};
+
+	/* Must match 'CppGenerator::HashStaticClassName' in Dumper-7 */
+	constexpr uint64 HashClassName(const char* Name, bool bIsFullName)
+	{
+		uint64 Hash = (0xCBF29CE484222325 ^ Seed) + (bIsFullName ? 0x1 : 0x0);
+
+		for (; *Name; Name++)
+		{
+			Hash ^= static_cast<uint8>(*Name);
+			Hash *= 0x100000001B3;
+		}
+
+		Hash ^= Hash >> 33;
+		Hash *= 0xFF51AFD7ED558CCD;
+		Hash ^= Hash >> 33;
+		Hash *= 0xC4CEB9FE1A85EC53;
+		Hash ^= Hash >> 33;
+
+		return Hash;
+	}
+
+	/* Minimal perfect hash, every name in the table has its own slot. Names that aren't in the table get the slot of another name. */
+	constexpr int32 GetSlot(uint64 NameHash)
+	{
+		const FDisplacement& Displacement = Displacements[static_cast<uint32>(NameHash >> 32) % Displacements.size()];
+
+		const uint32 F0 = static_cast<uint32>(NameHash);
+		const uint32 F1 = static_cast<uint32>((NameHash * 0x9E3779B97F4A7C15) >> 32);
+
+		return static_cast<int32>((F0 + (Displacement.D0 * F1) + Displacement.D1) % Entries.size());
+	}
+
+	/* The 64-bit hashes in the table are unique, comparing them replaces comparing the names */
+	constexpr int32 FindEntry(uint64 NameHash)
+	{
+		const int32 Slot = GetSlot(NameHash);
+
+		return Entries[Slot].Hash == NameHash ? Slot : -1;
+	}
+
+	/* Every name hashes to its own slot, so no two names share a slot */
+	constexpr bool IsTableValid(int32 Begin, int32 End)
+	{
+		for (int32 i = Begin; i < End; i++)
+		{
+			if (HashClassName(Entries[i].Name, Entries[i].bIsFullName) != Entries[i].Hash || FindEntry(Entries[i].Hash) != i)
+				return false;
+		}
+
+		return true;
+	}
+
+)";
+
+	/*
+	* BuildStaticClassPerfectHash already checked the table, this re-validates it while the SDK is compiled. Every character of a name costs
+	* a few constexpr steps, so the ranges are limited by the length of their names to stay below the step-limits of the compilers
+	* (eg. MSVC's default /constexpr:steps of 100000).
+	*/
+	if constexpr (Settings::Debug::bValidateStaticClassTableAtCompileTime)
+	{
+		constexpr int32 MaxCharactersPerAssert = 0x2000;
+
+		const int32 NumEntries = static_cast<int32>(StaticClassTable.size());
+
+		for (int32 Begin = 0x0; Begin < NumEntries;)
+		{
+			int32 End = Begin;
+			int32 NumCharacters = 0x0;
+
+			/* At least one entry per assert, even if its name is longer than the limit */
+			while (End < NumEntries && (End == Begin || (NumCharacters + static_cast<int32>(StaticClassTable[End].Name.size())) <= MaxCharactersPerAssert))
+				NumCharacters += static_cast<int32>(StaticClassTable[End++].Name.size());
+
+			TextBuffer::AppendFormat(Out, "\tstatic_assert(IsTableValid(0x{:X}, 0x{:X}), \"StaticClassTable: Name doesn't hash to its own slot!\");\n", Begin, End);
+
+			Begin = End;
+		}
+	}
+
+	Out += R"(
+	/* Index in GObjects and pointer of every entry, the index is used to check if the class is still loaded */
+	static std::array<std::atomic<int32>, Entries.size()> ClassIndices = {};
+	static std::array<std::atomic<class UClass*>, Entries.size()> Classes = {};
+
+	static std::mutex InitLock;
+}
+
+int32 InitAll()
+{
+	using namespace StaticClassTable;
+
+	std::scoped_lock Lock(InitLock);
+
+	int32 NumFound = 0x0;
+
+	/* Like FindClassFast/FindClass, the first class in GObjects with a matching name is used */
+	std::vector<bool> WasFound(Entries.size(), false);
+
+	auto SetEntry = [&](const char* Name, bool bIsFullName, UObject* Object) -> void
+	{
+		const int32 EntryIdx = FindEntry(HashClassName(Name, bIsFullName));
+
+		if (EntryIdx == -1 || WasFound[EntryIdx])
+			return;
+
+		WasFound[EntryIdx] = true;
+		NumFound++;
+
+		/* Index first, FindClassInTable() validates the pointer with it */
+		ClassIndices[EntryIdx].store(Object->Index, std::memory_order_relaxed);
+		Classes[EntryIdx].store(static_cast<UClass*>(Object), std::memory_order_release);
+	};
+
+	/* Longer full names are truncated and not found, StaticClass() finds those classes with UObject::FindClass */
+	char NameBuffer[0x1000];
+
+	for (UObject* Object : UObject::GObjects)
+	{
+		if (!Object->HasTypeFlag(EClassCastFlags::Class))
+			continue;
+
+		Object->GetName(NameBuffer, sizeof(NameBuffer));
+		SetEntry(NameBuffer, false, Object);
+
+		if constexpr (bHasFullNames)
+		{
+			Object->GetFullName(NameBuffer, sizeof(NameBuffer));
+			SetEntry(NameBuffer, true, Object);
+		}
+	}
+
+	return NumFound;
+}
+
+class UClass* BasicFilesImpleUtils::FindClassInTable(const std::string& Name, bool bIsFullName)
+{
+	using namespace StaticClassTable;
+
+	const int32 EntryIdx = FindEntry(HashClassName(Name.c_str(), bIsFullName));
+
+	if (EntryIdx == -1)
+		return nullptr;
+
+	UClass* Class = Classes[EntryIdx].load(std::memory_order_acquire);
+
+	/* Blueprint classes may have been unloaded since InitAll() */
+	if (!Class || BasicFilesImpleUtils::GetObjectByIndex(ClassIndices[EntryIdx].load(std::memory_order_relaxed)) != Class)
+		return nullptr;
+
+	return Class;
+}
+
+)";
+}
+
 void CppGenerator::GeneratePropertyFixupFile(StreamType& PropertyFixup)
 {
 	WriteFileHead(PropertyFixup, nullptr, EFileType::PropertyFixup, "PROPERTY-FIXUP");
 
-	std::unordered_map<std::string, UEProperty> UnknownProperties = GetUnknownProperties();
+	std::map<std::string, UEProperty> UnknownProperties = GetUnknownProperties();
 
 	for (const auto& [Name, Property] : UnknownProperties)
 	{
@@ -1226,7 +2024,8 @@ void CppGenerator::GenerateNameCollisionsInl(StreamType& NameCollisionsFile)
 	const StructManager::OverrideMaptType& StructInfoMap = StructManager::GetStructInfos();
 	const EnumManager::OverrideMaptType& EnumInfoMap = EnumManager::GetEnumInfos();
 
-	std::unordered_map<int32 /* PackageIdx */, std::pair<std::string, int32>> PackagesAndForwardDeclarations;
+	/* Ordered by package- and object-index, StructInfoMap and EnumInfoMap are unordered */
+	std::map<int32 /* PackageIdx */, std::map<int32 /* ObjectIdx */, std::string>> PackagesAndForwardDeclarations;
 
 	for (const auto& [Index, Info] : StructInfoMap)
 	{
@@ -1238,10 +2037,7 @@ void CppGenerator::GenerateNameCollisionsInl(StreamType& NameCollisionsFile)
 		if (Struct.IsA(EClassCastFlags::Function))
 			continue;
 
-		auto& [ForwardDeclarations, Count] = PackagesAndForwardDeclarations[Struct.GetPackageIndex()];
-
-		ForwardDeclarations += std::format("\t{} {};\n", Struct.IsA(EClassCastFlags::Class) ? "class" : "struct", Struct.GetCppName());
-		Count++;
+		PackagesAndForwardDeclarations[Struct.GetPackageIndex()][Index] = std::format("\t{} {};\n", Struct.IsA(EClassCastFlags::Class) ? "class" : "struct", Struct.GetCppName());
 	}
 
 	for (const auto& [Index, Info] : EnumInfoMap)
@@ -1251,21 +2047,28 @@ void CppGenerator::GenerateNameCollisionsInl(StreamType& NameCollisionsFile)
 
 		UEEnum Enum = ObjectArray::GetByIndex<UEEnum>(Index);
 
-		auto& [ForwardDeclarations, Count] = PackagesAndForwardDeclarations[Enum.GetPackageIndex()];
-
-		ForwardDeclarations += std::format("\tenum class {} : {};\n", Enum.GetEnumPrefixedName(), GetEnumUnderlayingType(Enum));
-		Count++;
+		PackagesAndForwardDeclarations[Enum.GetPackageIndex()][Index] = std::format("\tenum class {} : {};\n", Enum.GetEnumPrefixedName(), GetEnumUnderlayingType(Enum));
 	}
 
 	bool bHasSingleLineForwardDeclarations = false;
 
+	auto JoinForwardDeclarations = [](const std::map<int32, std::string>& ForwardDeclarations) -> std::string
+	{
+		std::string Joined;
+
+		for (const auto& [Index, Declaration] : ForwardDeclarations)
+			Joined += Declaration;
+
+		return Joined.substr(0, Joined.size() - 1);
+	};
+
 	for (const auto& [PackageIndex, ForwardDeclarations] : PackagesAndForwardDeclarations)
 	{
-		std::string ForwardDeclString = ForwardDeclarations.first.substr(0, ForwardDeclarations.first.size() - 1);
+		std::string ForwardDeclString = JoinForwardDeclarations(ForwardDeclarations);
 		std::string PackageName = PackageManager::GetName(PackageIndex);
 
 		/* Only print packages with a single forward declaration at first */
-		if (ForwardDeclarations.second > 1)
+		if (ForwardDeclarations.size() > 1)
 			continue;
 
 		bHasSingleLineForwardDeclarations = true;
@@ -1278,11 +2081,11 @@ void CppGenerator::GenerateNameCollisionsInl(StreamType& NameCollisionsFile)
 
 	for (const auto& [PackageIndex, ForwardDeclarations] : PackagesAndForwardDeclarations)
 	{
-		std::string ForwardDeclString = ForwardDeclarations.first.substr(0, ForwardDeclarations.first.size() - 1);
+		std::string ForwardDeclString = JoinForwardDeclarations(ForwardDeclarations);
 		std::string PackageName = PackageManager::GetName(PackageIndex);
 
 		/* Now print all packages with several forward declarations */
-		if (ForwardDeclarations.second <= 1)
+		if (ForwardDeclarations.size() <= 1)
 			continue;
 
 		NameCollisionsFile << std::format(R"(
@@ -1354,6 +2157,8 @@ void CppGenerator::GenerateDebugAssertions(StreamType& AssertionStream)
 
 void CppGenerator::GenerateSDKHeader(StreamType& SdkHpp)
 {
+	ProfilerScope Scope("CppGenerator::GenerateSDKHeader");
+
 	WriteFileHead(SdkHpp, nullptr, EFileType::SdkHpp, "Includes the entire SDK, include files directly for faster compilation!");
 
 
@@ -1497,146 +2302,217 @@ void CppGenerator::WriteFileEnd(StreamType& File, EFileType Type)
 	}
 }
 
-void CppGenerator::Generate()
+void CppGenerator::GeneratePackage(PackageInfoHandle Package, std::vector<StaticClassTableEntry>& OutStaticClasses)
 {
-	// Generate SDK.hpp with sorted packages
-	StreamType SdkHpp(MainFolder / "SDK.hpp");
-	GenerateSDKHeader(SdkHpp);
+	ProfilerScope Scope("CppGenerator::GeneratePackage", [&]() { return Package.GetName(); });
 
-	// Generate PropertyFixup.hpp
-	StreamType PropertyFixup(MainFolder / "PropertyFixup.hpp");
-	GeneratePropertyFixupFile(PropertyFixup);
+	std::string FileName = Settings::CppGenerator::FilePrefix + Package.GetName();
 
-	// Generate NameCollisions.inl file containing forward declarations for classes in namespaces (potentially requires lock)
-	StreamType NameCollisionsInl(MainFolder / "NameCollisions.inl");
-	GenerateNameCollisionsInl(NameCollisionsInl);
+	StreamType ClassesFile;
+	StreamType StructsFile;
+	StreamType ParametersFile;
+	StreamType FunctionsFile;
 
-	// Generate UnrealContainers.hpp
-	StreamType UnrealContainers(MainFolder / "UnrealContainers.hpp");
-	GenerateUnrealContainers(UnrealContainers);
+	/* Create files and handles namespaces and includes */
+	if (Package.HasClasses())
+	{
+		ClassesFile = StreamType(Subfolder / (FileName + "_classes.hpp"));
 
-	// Generate Basic.hpp and Basic.cpp files
-	StreamType BasicHpp(Subfolder / "Basic.hpp");
-	StreamType BasicCpp(Subfolder / "Basic.cpp");
-	GenerateBasicFiles(BasicHpp, BasicCpp);
+		if (!ClassesFile.is_open())
+			std::cout << "Error opening file \"" << (FileName + "_classes.hpp") << "\"" << std::endl;
 
+		WriteFileHead(ClassesFile, Package, EFileType::Classes);
 
-	if constexpr (Settings::Debug::bGenerateAssertionFile)
-	{
-		// Generate Assertions.inl file containing assertions on struct-size, struct-align and member offsets
-		StreamType DebugAssertions(MainFolder / "Assertions.inl");
-		GenerateDebugAssertions(DebugAssertions);
+		/* Write enum foward declarations before all of the classes */
+		GenerateEnumFwdDeclarations(ClassesFile, Package, true);
 	}
 
-	// Generates all packages and writes them to files
-	for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
+	if (Package.HasStructs() || Package.HasEnums())
 	{
-		if (Package.IsEmpty())
-			continue;
+		StructsFile = StreamType(Subfolder / (FileName + "_structs.hpp"));
 
-		std::string FileName = Settings::CppGenerator::FilePrefix + Package.GetName();
+		if (!StructsFile.is_open())
+			std::cout << "Error opening file \"" << (FileName + "_structs.hpp") << "\"" << std::endl;
 
-		StreamType ClassesFile;
-		StreamType StructsFile;
-		StreamType ParametersFile;
-		StreamType FunctionsFile;
+		WriteFileHead(StructsFile, Package, EFileType::Structs);
 
-		/* Create files and handles namespaces and includes */
-		if (Package.HasClasses())
-		{
-			ClassesFile = StreamType(Subfolder / (FileName + "_classes.hpp"));
+		/* Write enum foward declarations before all of the structs */
+		GenerateEnumFwdDeclarations(StructsFile, Package, false);
+	}
 
-			if (!ClassesFile.is_open())
-				std::cout << "Error opening file \"" << (FileName + "_classes.hpp") << "\"" << std::endl;
+	if (Package.HasParameterStructs())
+	{
+		ParametersFile = StreamType(Subfolder / (FileName + "_parameters.hpp"));
 
-			WriteFileHead(ClassesFile, Package, EFileType::Classes);
+		if (!ParametersFile.is_open())
+			std::cout << "Error opening file \"" << (FileName + "_parameters.hpp") << "\"" << std::endl;
 
-			/* Write enum foward declarations before all of the classes */
-			GenerateEnumFwdDeclarations(ClassesFile, Package, true);
-		}
+		WriteFileHead(ParametersFile, Package, EFileType::Parameters);
+	}
 
-		if (Package.HasStructs() || Package.HasEnums())
-		{
-			StructsFile = StreamType(Subfolder / (FileName + "_structs.hpp"));
+	if (Package.HasFunctions())
+	{
+		FunctionsFile = StreamType(Subfolder / (FileName + "_functions.cpp"));
 
-			if (!StructsFile.is_open())
-				std::cout << "Error opening file \"" << (FileName + "_structs.hpp") << "\"" << std::endl;
+		if (!FunctionsFile.is_open())
+			std::cout << "Error opening file \"" << (FileName + "_functions.cpp") << "\"" << std::endl;
 
-			WriteFileHead(StructsFile, Package, EFileType::Structs);
+		WriteFileHead(FunctionsFile, Package, EFileType::Functions);
+	}
 
-			/* Write enum foward declarations before all of the structs */
-			GenerateEnumFwdDeclarations(StructsFile, Package, false);
-		}
+	const int32 PackageIndex = Package.GetIndex();
 
-		if (Package.HasParameterStructs())
-		{
-			ParametersFile = StreamType(Subfolder / (FileName + "_parameters.hpp"));
+	/* Filled by GenerateSingleFunction, one entry per unreal-function generated into this package */
+	FunctionTable PackageFunctionTable = { .Name = Package.GetName() + "_FunctionTable" };
 
-			if (!ParametersFile.is_open())
-				std::cout << "Error opening file \"" << (FileName + "_parameters.hpp") << "\"" << std::endl;
+	const size_t FunctionTableDeclarationPos = FunctionsFile.GetBuffer().size();
 
-			WriteFileHead(ParametersFile, Package, EFileType::Parameters);
-		}
+	if constexpr (Settings::CppGenerator::bAddFunctionTables)
+		CurrentFunctionTable = &PackageFunctionTable;
 
-		if (Package.HasFunctions())
-		{
-			FunctionsFile = StreamType(Subfolder / (FileName + "_functions.cpp"));
+	CurrentStaticClasses = &OutStaticClasses;
 
-			if (!FunctionsFile.is_open())
-				std::cout << "Error opening file \"" << (FileName + "_functions.cpp") << "\"" << std::endl;
-
-			WriteFileHead(FunctionsFile, Package, EFileType::Functions);
-		}
+	/* 
+	* Generate classes/structs/enums/functions directly into the respective files
+	* 
+	* Note: Some filestreams aren't opened but passed as parameters anyway because the function demands it, they are not used if they are closed
+	*/
+	for (int32 EnumIdx : Package.GetEnums())
+	{
+		GenerateEnum(ObjectArray::GetByIndex<UEEnum>(EnumIdx), StructsFile);
+	}
 
-		const int32 PackageIndex = Package.GetIndex();
+	if (Package.HasStructs())
+	{
+		const DependencyManager& Structs = Package.GetSortedStructs();
 
-		/* 
-		* Generate classes/structs/enums/functions directly into the respective files
-		* 
-		* Note: Some filestreams aren't opened but passed as parameters anyway because the function demands it, they are not used if they are closed
-		*/
-		for (int32 EnumIdx : Package.GetEnums())
+		DependencyManager::OnVisitCallbackType GenerateStructCallback = [&](int32 Index) -> void
 		{
-			GenerateEnum(ObjectArray::GetByIndex<UEEnum>(EnumIdx), StructsFile);
-		}
+			GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index), StructsFile, FunctionsFile, ParametersFile, PackageIndex);
+		};
 
-		if (Package.HasStructs())
+		Structs.VisitAllNodesWithCallback(GenerateStructCallback);
+	}
+
+	if (Package.HasClasses())
+	{
+		const DependencyManager& Classes = Package.GetSortedClasses();
+
+		DependencyManager::OnVisitCallbackType GenerateClassCallback = [&](int32 Index) -> void
 		{
-			const DependencyManager& Structs = Package.GetSortedStructs();
+			GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index), ClassesFile, FunctionsFile, ParametersFile, PackageIndex);
+		};
 
-			DependencyManager::OnVisitCallbackType GenerateStructCallback = [&](int32 Index) -> void
-			{
-				GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index), StructsFile, FunctionsFile, ParametersFile, PackageIndex);
-			};
+		Classes.VisitAllNodesWithCallback(GenerateClassCallback);
+	}
 
-			Structs.VisitAllNodesWithCallback(GenerateStructCallback);
-		}
+	CurrentFunctionTable = nullptr;
+	CurrentStaticClasses = nullptr;
 
-		if (Package.HasClasses())
-		{
-			const DependencyManager& Classes = Package.GetSortedClasses();
+	if (!PackageFunctionTable.Entries.empty())
+	{
+		/* The functions refer to the table by index, so it's declared before them and defined once all of its entries are known */
+		FunctionsFile.GetBuffer().insert(FunctionTableDeclarationPos, std::format(R"(
+/* UFunctions called by the functions in this file, defined at the end of the file */
+namespace {}
+{{
+	class UFunction* Get(int32 Index, const class UClass* Class);
+}}
+)", PackageFunctionTable.Name));
 
-			DependencyManager::OnVisitCallbackType GenerateClassCallback = [&](int32 Index) -> void
-			{
-				GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index), ClassesFile, FunctionsFile, ParametersFile, PackageIndex);
-			};
+		GenerateFunctionTable(FunctionsFile, Package, PackageFunctionTable);
+	}
 
-			Classes.VisitAllNodesWithCallback(GenerateClassCallback);
-		}
+	/* Closes any namespaces if required */
+	if (Package.HasClasses())
+		WriteFileEnd(ClassesFile, EFileType::Classes);
 
+	if (Package.HasStructs() || Package.HasEnums())
+		WriteFileEnd(StructsFile, EFileType::Structs);
 
-		/* Closes any namespaces if required */
-		if (Package.HasClasses())
-			WriteFileEnd(ClassesFile, EFileType::Classes);
+	if (Package.HasParameterStructs())
+		WriteFileEnd(ParametersFile, EFileType::Parameters);
 
-		if (Package.HasStructs() || Package.HasEnums())
-			WriteFileEnd(StructsFile, EFileType::Structs);
+	if (Package.HasFunctions())
+		WriteFileEnd(FunctionsFile, EFileType::Functions);
+}
 
-		if (Package.HasParameterStructs())
-			WriteFileEnd(ParametersFile, EFileType::Parameters);
+void CppGenerator::Generate()
+{
+	/* Collect all packages up front, 'IterateOverPackageInfos()' must not be used from multiple threads */
+	std::vector<PackageInfoHandle> Packages;
+	Packages.reserve(PackageManager::GetPackageInfos().size());
+
+	for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
+	{
+		if (!Package.IsEmpty())
+			Packages.push_back(Package);
+	}
+
+	/* Every package writes to its own files, so packages can be generated independently from eachother */
+	const uint32 NumThreads = Settings::CppGenerator::bGeneratePackagesInParallel ? Settings::CppGenerator::NumGeneratorThreads : 1;
+
+	/* One list per package, merged afterwards so the table doesn't depend on the order the packages were generated in */
+	std::vector<std::vector<StaticClassTableEntry>> StaticClassesPerPackage(Packages.size());
+
+	ParallelUtils::ParallelFor(static_cast<int32>(Packages.size()), [&Packages, &StaticClassesPerPackage](int32 Index) -> void
+	{
+		GeneratePackage(Packages[Index], StaticClassesPerPackage[Index]);
+	}, NumThreads);
+
+	StaticClassTable.clear();
+
+	for (std::vector<StaticClassTableEntry>& StaticClasses : StaticClassesPerPackage)
+		std::move(StaticClasses.begin(), StaticClasses.end(), std::back_inserter(StaticClassTable));
+
+	/* Sorted first, the perfect hash only depends on the names and not on the order the packages were generated in */
+	std::sort(StaticClassTable.begin(), StaticClassTable.end(), [](const StaticClassTableEntry& Left, const StaticClassTableEntry& Right) -> bool
+	{
+		return Left.bIsFullName != Right.bIsFullName ? !Left.bIsFullName : Left.Name < Right.Name;
+	});
+
+	StaticClassTable.erase(std::unique(StaticClassTable.begin(), StaticClassTable.end(), [](const StaticClassTableEntry& Left, const StaticClassTableEntry& Right) -> bool
+	{
+		return Left.bIsFullName == Right.bIsFullName && Left.Name == Right.Name;
+	}), StaticClassTable.end());
+
+	if (!BuildStaticClassPerfectHash(StaticClassTable, StaticClassHash))
+	{
+		/* StaticClass() still works without the table, it just finds every class with UObject::FindClassFast/FindClass */
+		std::cout << "Failed to build the perfect hash for the StaticClass() table, InitAll() won't find any classes!" << std::endl;
+		StaticClassTable.clear();
+	}
+
+
+	/* Global files are generated on this thread, after all packages, to keep their content and order deterministic */
+
+	// Generate SDK.hpp with sorted packages
+	StreamType SdkHpp(MainFolder / "SDK.hpp");
+	GenerateSDKHeader(SdkHpp);
+
+	// Generate PropertyFixup.hpp
+	StreamType PropertyFixup(MainFolder / "PropertyFixup.hpp");
+	GeneratePropertyFixupFile(PropertyFixup);
 
-		if (Package.HasFunctions())
-			WriteFileEnd(FunctionsFile, EFileType::Functions);
+	// Generate NameCollisions.inl file containing forward declarations for classes in namespaces (potentially requires lock)
+	StreamType NameCollisionsInl(MainFolder / "NameCollisions.inl");
+	GenerateNameCollisionsInl(NameCollisionsInl);
+
+	// Generate UnrealContainers.hpp
+	StreamType UnrealContainers(MainFolder / "UnrealContainers.hpp");
+	GenerateUnrealContainers(UnrealContainers);
+
+	// Generate Basic.hpp and Basic.cpp files
+	StreamType BasicHpp(Subfolder / "Basic.hpp");
+	StreamType BasicCpp(Subfolder / "Basic.cpp");
+	GenerateBasicFiles(BasicHpp, BasicCpp);
+
+
+	if constexpr (Settings::Debug::bGenerateAssertionFile)
+	{
+		// Generate Assertions.inl file containing assertions on struct-size, struct-align and member offsets
+		StreamType DebugAssertions(MainFolder / "Assertions.inl");
+		GenerateDebugAssertions(DebugAssertions);
 	}
 }
 
@@ -1685,7 +2561,7 @@ void CppGenerator::InitPredefinedMembers()
 	UDataTablePredefs.Members =
 	{
 		PredefinedMember {
-			.Comment = "So, here's a RowMap. Good luck with it.",
+			.Comment = "So, here's a RowMap. Use RowMap.Find(RowName) for a hashed lookup.",
 			.Type = "TMap<class FName, uint8*>", .Name = "RowMap", .Offset = Off::InSDK::UDataTable::RowMap, .Size = 0x50, .ArrayDim = 0x1, .Alignment = 0x8,
 			.bIsStatic = false, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF
 		},
@@ -2216,6 +3092,9 @@ void CppGenerator::InitPredefinedMembers()
 
 void CppGenerator::InitPredefinedFunctions()
 {
+	/* Same condition as in GenerateBasicFiles, the table contains the plain class-names */
+	constexpr bool bAddStaticClassTable = Settings::CppGenerator::bAddStaticClassTable && !Settings::CppGenerator::XORString;
+
 	static auto SortFunctions = [](std::vector<PredefinedFunction>& Functions) -> void
 	{
 		std::sort(Functions.begin(), Functions.end(), ComparePredefinedFunctions);
@@ -2229,15 +3108,13 @@ void CppGenerator::InitPredefinedFunctions()
 		PredefinedFunction {
 			.CustomComment = "Finds a UObject in the global object array by full-name, optionally with ECastFlags to reduce heavy string comparison",
 			.ReturnType = "class UObject*", .NameWithParams = "FindObjectImpl(const std::string& FullName, EClassCastFlags RequiredType = EClassCastFlags::None)",
-			.NameWithParamsWithoutDefaults = "FindObjectImpl(const std::string& FullName, EClassCastFlags RequiredType)", .Body =
+			.NameWithParamsWithoutDefaults = "FindObjectImpl(const std::string& FullName, EClassCastFlags RequiredType)", .Body = Settings::CppGenerator::bAddObjectNameIndex ?
 R"({
-	for (int i = 0; i < GObjects->Num(); ++i)
+	return ObjectNameIndex::FindObject(FullName, RequiredType, true);
+})" :
+R"({
+	for (UObject* Object : GObjects)
 	{
-		UObject* Object = GObjects->GetByIndex(i);
-	
-		if (!Object)
-			continue;
-		
 		if (Object->HasTypeFlag(RequiredType) && Object->GetFullName() == FullName)
 			return Object;
 	}
@@ -2249,15 +3126,13 @@ R"({
 		PredefinedFunction {
 			.CustomComment = "Finds a UObject in the global object array by name, optionally with ECastFlags to reduce heavy string comparison",
 			.ReturnType = "class UObject*", .NameWithParams = "FindObjectFastImpl(const std::string& Name, EClassCastFlags RequiredType = EClassCastFlags::None)",
-			.NameWithParamsWithoutDefaults = "FindObjectFastImpl(const std::string& Name, EClassCastFlags RequiredType)", .Body =
+			.NameWithParamsWithoutDefaults = "FindObjectFastImpl(const std::string& Name, EClassCastFlags RequiredType)", .Body = Settings::CppGenerator::bAddObjectNameIndex ?
 R"({
-	for (int i = 0; i < GObjects->Num(); ++i)
+	return ObjectNameIndex::FindObject(Name, RequiredType, false);
+})" :
+R"({
+	for (UObject* Object : GObjects)
 	{
-		UObject* Object = GObjects->GetByIndex(i);
-	
-		if (!Object)
-			continue;
-		
 		if (Object->HasTypeFlag(RequiredType) && Object->GetName() == Name)
 			return Object;
 	}
@@ -2275,13 +3150,8 @@ R"({
 			.NameWithParamsWithoutDefaults = "FindObjects(const std::string& FullName, EClassCastFlags RequiredType)", .Body =
 R"({
 	std::vector<UEType*> ret;
-	for (int i = 0; i < GObjects->Num(); ++i)
+	for (UObject* Object : GObjects)
 	{
-		UObject* Object = GObjects->GetByIndex(i);
-	
-		if (!Object)
-			continue;
-		
 		if (Object->HasTypeFlag(RequiredType) && Object->GetFullName() == FullName)
 			ret.push_back(static_cast<UEType*>(Object));
 	}
@@ -2298,13 +3168,8 @@ R"({
 			.NameWithParamsWithoutDefaults = "FindObjectsFast(const std::string& Name, EClassCastFlags RequiredType)", .Body =
 R"({
 	std::vector<UEType*> ret;
-	for (int i = 0; i < GObjects->Num(); ++i)
+	for (UObject* Object : GObjects)
 	{
-		UObject* Object = GObjects->GetByIndex(i);
-	
-		if (!Object)
-			continue;
-		
 		if (Object->HasTypeFlag(RequiredType) && Object->GetName() == Name)
 			ret.push_back(static_cast<UEType*>(Object));
 	}
@@ -2320,13 +3185,8 @@ R"({
 			.ReturnType = "UEType*", .NameWithParams = "FindObject(EClassCastFlags RequiredType = EClassCastFlags::None)", .Body =
 R"({
 	auto v = UEType::StaticClass();
-	for (int i = 0; i < GObjects->Num(); ++i)
+	for (UObject* Object : GObjects)
 	{
-		UObject* Object = GObjects->GetByIndex(i);
-	
-		if (!Object)
-			continue;
-		
 		if (Object->HasTypeFlag(RequiredType) && Object->IsA(v))
 			return static_cast<UEType*>(Object);
 	}
@@ -2343,13 +3203,8 @@ R"({
 R"({
 	auto v = UEType::StaticClass();
 	std::vector<UEType*> ret;
-	for (int i = 0; i < GObjects->Num(); ++i)
+	for (UObject* Object : GObjects)
 	{
-		UObject* Object = GObjects->GetByIndex(i);
-	
-		if (!Object)
-			continue;
-		
 		if (Object->HasTypeFlag(RequiredType) && Object->IsA(v))
 			ret.push_back(static_cast<UEType*>(Object));
 	}
@@ -2359,6 +3214,59 @@ R"({
 			.bIsStatic = true, .bIsConst = false, .bIsBodyInline = true
 		},
 
+		PredefinedFunction {
+			.CustomComment = "Calls Callback for every object of type UEType, including default-objects. Callback takes a UEType* and returns void, or false to stop. With NumThreads != 1 GObjects is split into chunks that are iterated in parallel (0 for one thread per core), Callback has to be thread-safe then.",
+			.CustomTemplateText = "template<typename UEType = UObject, typename CallbackType>",
+			.ReturnType = "bool", .NameWithParams = "ForEachObjectOfClass(CallbackType&& Callback, int32 NumThreads = 0x1)", .Body = Settings::CppGenerator::bAddClassBaseChains ?
+R"({
+	if (!UEType::StaticClass())
+		return true;
+
+	auto Filter = [&Callback](UObject* Object) -> bool
+	{
+		if (!Object->IsA<UEType>())
+			return true;
+
+		if constexpr (std::is_void_v<std::invoke_result_t<CallbackType&, UEType*>>)
+		{
+			Callback(static_cast<UEType*>(Object));
+			return true;
+		}
+		else
+		{
+			return Callback(static_cast<UEType*>(Object));
+		}
+	};
+
+	return NumThreads == 0x1 ? GObjects->ForEachObject(Filter) : GObjects->ForEachObjectParallel(Filter, NumThreads);
+})" :
+R"({
+	class UClass* TypeClass = UEType::StaticClass();
+
+	if (!TypeClass)
+		return true;
+
+	auto Filter = [&Callback, TypeClass](UObject* Object) -> bool
+	{
+		if (!Object->IsA(TypeClass))
+			return true;
+
+		if constexpr (std::is_void_v<std::invoke_result_t<CallbackType&, UEType*>>)
+		{
+			Callback(static_cast<UEType*>(Object));
+			return true;
+		}
+		else
+		{
+			return Callback(static_cast<UEType*>(Object));
+		}
+	};
+
+	return NumThreads == 0x1 ? GObjects->ForEachObject(Filter) : GObjects->ForEachObjectParallel(Filter, NumThreads);
+})",
+			.bIsStatic = true, .bIsConst = false, .bIsBodyInline = true
+		},
+
 		/* static inline functions */
 		PredefinedFunction {
 			.CustomComment = "",
@@ -2380,7 +3288,14 @@ R"({
 		},
 		PredefinedFunction {
 			.CustomComment = "",
-			.ReturnType = "class UClass*", .NameWithParams = "FindClass(const std::string& ClassFullName)", .Body =
+			.ReturnType = "class UClass*", .NameWithParams = "FindClass(const std::string& ClassFullName)", .Body = bAddStaticClassTable ?
+R"({
+	/* One hash and one load for classes resolved by InitAll() */
+	if (class UClass* Class = BasicFilesImpleUtils::FindClassInTable(ClassFullName, true))
+		return Class;
+
+	return FindObject<class UClass>(ClassFullName, EClassCastFlags::Class);
+})" :
 R"({
 	return FindObject<class UClass>(ClassFullName, EClassCastFlags::Class);
 })",
@@ -2388,7 +3303,15 @@ R"({
 		},
 		PredefinedFunction {
 			.CustomComment = "",
-			.ReturnType = "class UClass*", .NameWithParams = "FindClassFast(const std::string& ClassName)", .Body =
+			.ReturnType = "class UClass*", .NameWithParams = "FindClassFast(const std::string& ClassName)", .Body = bAddStaticClassTable ?
+R"({
+	/* One hash and one load for classes resolved by InitAll() */
+	if (class UClass* Class = BasicFilesImpleUtils::FindClassInTable(ClassName, false))
+		return Class;
+
+	return FindObjectFast<class UClass>(ClassName, EClassCastFlags::Class);
+}
+)" :
 R"({
 	return FindObjectFast<class UClass>(ClassName, EClassCastFlags::Class);
 }
@@ -2403,6 +3326,25 @@ R"({
 			.ReturnType = "std::string", .NameWithParams = "GetName()", .Body =
 R"({
 	return this ? Name.ToString() : "None";
+})",
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = false
+		},
+		PredefinedFunction {
+			.CustomComment = "Writes the name of this object as null-terminated UTF-8 into Buffer and returns its length. Doesn't allocate.",
+			.ReturnType = "int32", .NameWithParams = "GetName(char* Buffer, int32 BufferSize)", .Body =
+R"({
+	if (this)
+		return Name.ToString(Buffer, BufferSize);
+
+	if (BufferSize <= 0)
+		return 0;
+
+	const int32 Length = BufferSize > 0x4 ? 0x4 : BufferSize - 1;
+
+	memcpy(Buffer, "None", Length);
+	Buffer[Length] = '\0';
+
+	return Length;
 })",
 			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = false
 		},
@@ -2412,22 +3354,142 @@ R"({
 R"({
 	if (this && Class)
 	{
-		std::string Temp;
+		/* Outers are collected first, so the name can be appended front to back. Outers of chains deeper than 'Outers' continue in 'MoreOuters'. */
+		const UObject* Outers[0x40];
+		std::vector<const UObject*> MoreOuters;
+		int32 NumOuters = 0x0;
 
 		for (UObject* NextOuter = Outer; NextOuter; NextOuter = NextOuter->Outer)
 		{
-			Temp = NextOuter->GetName() + "." + Temp;
+			if (NumOuters < 0x40)
+			{
+				Outers[NumOuters++] = NextOuter;
+			}
+			else
+			{
+				MoreOuters.push_back(NextOuter);
+			}
 		}
 
-		std::string Name = Class->GetName();
-		Name += " ";
-		Name += Temp;
-		Name += GetName();
+		char NameBuffer[FName::MaxStringLength];
 
-		return Name;
+		std::string FullName;
+		FullName.reserve(0x100);
+
+		FullName.append(NameBuffer, Class->Name.ToString(NameBuffer, sizeof(NameBuffer)));
+		FullName += ' ';
+
+		for (auto It = MoreOuters.rbegin(); It != MoreOuters.rend(); ++It)
+		{
+			FullName.append(NameBuffer, (*It)->Name.ToString(NameBuffer, sizeof(NameBuffer)));
+			FullName += '.';
+		}
+
+		for (int32 i = NumOuters - 1; i >= 0; i--)
+		{
+			FullName.append(NameBuffer, Outers[i]->Name.ToString(NameBuffer, sizeof(NameBuffer)));
+			FullName += '.';
+		}
+
+		FullName.append(NameBuffer, Name.ToString(NameBuffer, sizeof(NameBuffer)));
+
+		return FullName;
 	}
 
 	return "None";
+})",
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = false
+		},
+		PredefinedFunction {
+			.CustomComment = "Same as GetFullName(), written into Buffer. Doesn't allocate, truncates the name if the buffer is too small.",
+			.ReturnType = "int32", .NameWithParams = "GetFullName(char* Buffer, int32 BufferSize)", .Body =
+R"({
+	if (BufferSize <= 0)
+		return 0;
+
+	char NameBuffer[FName::MaxStringLength];
+
+	int32 Length = 0x0;
+	bool bIsTruncated = false;
+
+	Buffer[0] = '\0';
+
+	/* Stops at the first string that doesn't fit, the output is always the start of GetFullName() */
+	auto Append = [&](const char* String, int32 StringLength) -> void
+	{
+		if (bIsTruncated)
+			return;
+
+		int32 NumToCopy = StringLength;
+
+		if ((Length + NumToCopy) >= BufferSize)
+		{
+			bIsTruncated = true;
+			NumToCopy = BufferSize - 1 - Length;
+
+			/* Don't split a UTF-8 character */
+			while (NumToCopy > 0 && (static_cast<uint8>(String[NumToCopy]) & 0xC0) == 0x80)
+				NumToCopy--;
+		}
+
+		memcpy(Buffer + Length, String, NumToCopy);
+		Length += NumToCopy;
+		Buffer[Length] = '\0';
+	};
+
+	if (!this || !Class)
+	{
+		Append("None", 0x4);
+		return Length;
+	}
+
+	/* The innermost 0x40 outers are collected while counting the chain */
+	const UObject* Outers[0x40];
+	int32 NumOuters = 0x0;
+
+	for (UObject* NextOuter = Outer; NextOuter; NextOuter = NextOuter->Outer)
+	{
+		if (NumOuters < 0x40)
+			Outers[NumOuters] = NextOuter;
+
+		NumOuters++;
+	}
+
+	Append(NameBuffer, Class->Name.ToString(NameBuffer, sizeof(NameBuffer)));
+	Append(" ", 0x1);
+
+	/* Deeper chains are appended outermost first in windows of 0x40 outers, each collected by walking the chain again, to not allocate */
+	for (int32 WindowEnd = NumOuters; WindowEnd > 0x40 && !bIsTruncated;)
+	{
+		const int32 WindowBegin = (WindowEnd - 0x40) > 0x40 ? (WindowEnd - 0x40) : 0x40;
+
+		const UObject* WindowOuters[0x40];
+		const UObject* NextOuter = Outer;
+
+		for (int32 i = 0; i < WindowBegin; i++)
+			NextOuter = NextOuter->Outer;
+
+		for (int32 i = 0; i < (WindowEnd - WindowBegin); i++, NextOuter = NextOuter->Outer)
+			WindowOuters[i] = NextOuter;
+
+		for (int32 i = (WindowEnd - WindowBegin) - 1; i >= 0; i--)
+		{
+			Append(NameBuffer, WindowOuters[i]->Name.ToString(NameBuffer, sizeof(NameBuffer)));
+			Append(".", 0x1);
+		}
+
+		WindowEnd = WindowBegin;
+	}
+
+	for (int32 i = (NumOuters < 0x40 ? NumOuters : 0x40) - 1; i >= 0; i--)
+	{
+		Append(NameBuffer, Outers[i]->Name.ToString(NameBuffer, sizeof(NameBuffer)));
+		Append(".", 0x1);
+	}
+
+	Append(NameBuffer, Name.ToString(NameBuffer, sizeof(NameBuffer)));
+
+	return Length;
 })",
 			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = false
 		},
@@ -2475,6 +3537,19 @@ R"({
 		},
 	};
 
+	if constexpr (Settings::CppGenerator::bAddClassBaseChains)
+	{
+		UObjectPredefs.Functions.push_back(PredefinedFunction {
+			.CustomComment = "Checks a UObjects' type by class, in constant time. Uses T's cast-flag if it has one, its ancestor-chain otherwise.",
+			.CustomTemplateText = "template<typename ClassType>",
+			.ReturnType = "bool", .NameWithParams = "IsA()", .Body =
+R"({
+	return ClassBaseChain::IsA<ClassType>(this);
+})",
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+		});
+	}
+
 	UEClass Struct = ObjectArray::FindClassFast("Struct");
 
 	const int32 UStructIdx = Struct ? Struct.GetIndex() : ObjectArray::FindClassFast("struct").GetIndex(); // misspelled on some UE versions.
@@ -2485,7 +3560,10 @@ R"({
 	{
 		PredefinedFunction {
 			.CustomComment = "Checks if this class has a certain base",
-			.ReturnType = "bool", .NameWithParams = "IsSubclassOf(const UStruct* Base)", .Body =
+			.ReturnType = "bool", .NameWithParams = "IsSubclassOf(const UStruct* Base)", .Body = Settings::CppGenerator::bAddClassBaseChains ?
+R"({
+	return ClassBaseChain::IsSubclassOf(this, Base);
+})" :
 R"({
 	if (!Base)
 		return false;
@@ -2545,19 +3623,14 @@ R"({
 		return GEngine;
 	
 	/* (Re-)Initialize if GEngine is nullptr */
-	for (int i = 0; i < UObject::GObjects->Num(); i++)
+	UObject::ForEachObjectOfClass<UEngine>([](UEngine* Engine) -> bool
 	{
-		UObject* Obj = UObject::GObjects->GetByIndex(i);
-
-		if (!Obj)
-			continue;
+		if (Engine->IsDefaultObject())
+			return true;
 
-		if (Obj->IsA(UEngine::StaticClass()) && !Obj->IsDefaultObject())
-		{
-			GEngine = static_cast<UEngine*>(Obj);
-			break;
-		}
-	}
+		GEngine = Engine;
+		return false;
+	});
 
 	return GEngine; 
 })",
@@ -2963,8 +4036,13 @@ R"({
 
 void CppGenerator::GenerateBasicFiles(StreamType& BasicHpp, StreamType& BasicCpp)
 {
+	ProfilerScope Scope("CppGenerator::GenerateBasicFiles");
+
 	namespace CppSettings = Settings::CppGenerator;
 
+	/* The table contains every class-name in plain text, which is what XORString is meant to avoid */
+	constexpr bool bAddStaticClassTable = CppSettings::bAddStaticClassTable && !CppSettings::XORString;
+
 	static auto SortMembers = [](std::vector<PredefinedMember>& Members) -> void
 	{
 		std::sort(Members.begin(), Members.end(), ComparePredefinedMembers);
@@ -2975,10 +4053,40 @@ void CppGenerator::GenerateBasicFiles(StreamType& BasicHpp, StreamType& BasicCpp
 #include <Windows.h>
 #include <functional>
 #include <type_traits>
+#include <atomic>
+#include <string_view>
+#include <charconv>
+#include <iterator>
+
+#if defined(_M_X64) || defined(__SSE__)
+#include <xmmintrin.h>
+#endif
 )";
 
+	if constexpr (CppSettings::bAddMemberReflection)
+		CustomIncludes += "#include <array>\n#include <utility>\n";
+
 	WriteFileHead(BasicHpp, nullptr, EFileType::BasicHpp, "Basic file containing structs required by the SDK", CustomIncludes);
-	WriteFileHead(BasicCpp, nullptr, EFileType::BasicCpp, "Basic file containing function-implementations from Basic.hpp");
+
+	/* Includes for TUObjectArray::ForEachObjectParallel, the benchmarks and the lookup-tables implemented in Basic.cpp */
+	std::string BasicCppIncludes = "#include <vector>\n#include <thread>\n";
+
+	if constexpr (CppSettings::bAddObjectNameIndex || CppSettings::bAddFunctionTables || bAddStaticClassTable)
+		BasicCppIncludes += "#include <mutex>\n#include <algorithm>\n#include <unordered_map>\n";
+
+	if constexpr (CppSettings::bAddObjectNameIndex)
+		BasicCppIncludes += "#include <unordered_set>\n";
+
+	if constexpr (CppSettings::bAddObjectNameIndexBenchmark || CppSettings::bAddClassBaseChainBenchmark || CppSettings::bCallNativeFunctionsDirectly || CppSettings::bAddContainerLookupBenchmark || CppSettings::bAddObjectIterationBenchmark)
+		BasicCppIncludes += "#include <chrono>\n";
+
+	if constexpr (bAddStaticClassTable)
+		BasicCppIncludes += "#include <array>\n";
+
+	if constexpr (CppSettings::bAddContainerLookupBenchmark || CppSettings::bAddNameCache || CppSettings::bCallNativeFunctionsDirectly)
+		BasicCppIncludes += "#include <cstring>\n";
+
+	WriteFileHead(BasicCpp, nullptr, EFileType::BasicCpp, "Basic file containing function-implementations from Basic.hpp", BasicCppIncludes);
 
 
 	/* use namespace of UnrealContainers */
@@ -3109,20 +4217,176 @@ namespace BasicFilesImpleUtils
 }
 )";
 
-	BasicCpp << R"(
-class UClass* BasicFilesImpleUtils::FindClassByName(const std::string& Name)
+	if constexpr (bAddStaticClassTable)
+	{
+		BasicHpp << R"(
+namespace BasicFilesImpleUtils
 {
-	return UObject::FindClassFast(Name);
+	/* Class resolved by 'InitAll()', nullptr if InitAll() wasn't called, or the class was not loaded at that time */
+	UClass* FindClassInTable(const std::string& Name, bool bIsFullName);
 }
 
-class UClass* BasicFilesImpleUtils::FindClassByFullName(const std::string& Name)
-{
-	return UObject::FindClass(Name);
-}
+/*
+* Resolves the UClass of every 'StaticClass()' in the SDK with a single pass over GObjects. Thread-safe.
+*
+* Optional, StaticClass() looks its class up on first use if this wasn't called. Calling it again (eg. after a level was loaded)
+* resolves classes that weren't loaded before. Returns the number of classes that were found.
+*/
+int32 InitAll();
+)";
+	}
 
-std::string BasicFilesImpleUtils::GetObjectName(class UClass* Class)
+	if constexpr (Settings::CppGenerator::bAddFunctionTables)
+	{
+		BasicHpp << R"(
+namespace BasicFilesImpleUtils
 {
-	return Class->GetName();
+	// Helpers for the per-package function tables in '*_functions.cpp'
+	struct FunctionTableKey
+	{
+		const char* OuterName;
+		const char* FunctionName;
+	};
+
+	/* Resolves every entry of 'OutFunctions' that is still nullptr with a single pass over GObjects, unless GObjects didn't grow since 'InOutNumScannedObjects' */
+	void ResolveFunctionTable(const char* PackageName, const FunctionTableKey* Keys, std::atomic<UFunction*>* OutFunctions, int32 NumFunctions, std::atomic<int32>& InOutNumScannedObjects);
+}
+)";
+	}
+
+	if constexpr (CppSettings::bAddMemberReflection)
+	{
+		TextBuffer::ScratchString MemberKinds;
+
+		for (const char* KindName : MemberKindNames)
+			TextBuffer::AppendFormat(*MemberKinds, "\t\t{},\n", KindName);
+
+		BasicHpp << std::format(R"(
+namespace MemberReflection
+{{
+	enum class EMemberKind : uint8
+	{{
+{}	}};
+
+	/* A member of a generated struct or class, see 'ReflectedMembers' */
+	struct FMemberDescriptor
+	{{
+		const char* Name;
+		int32 Offset;      // From the start of the struct, including the Super
+		int32 Size;        // Size of a single element, the member takes up 'Size * ArrayDim' bytes
+		int32 ArrayDim;
+		EMemberKind Kind;
+		uint8 BitMask;     // 0xFF, unless the member is a bit-field
+		uint64 TypeId;     // 'ReflectedTypeId' of the struct, class or enum the member refers to (the element-type for containers), 0x0 otherwise
+
+		constexpr bool IsBitField() const
+		{{
+			return BitMask != 0xFF;
+		}}
+	}};
+
+	/* FNV-1a of the full name of a type, as returned by UObject::GetFullName() (eg. "ScriptStruct /Script/CoreUObject.Vector"). Equal to 'ReflectedTypeId' of that type. */
+	constexpr uint64 HashTypeName(std::string_view FullName)
+	{{
+		uint64 Hash = 0xCBF29CE484222325;
+
+		for (const char C : FullName)
+		{{
+			Hash ^= static_cast<uint8>(C);
+			Hash *= 0x100000001B3;
+		}}
+
+		return Hash;
+	}}
+
+	template<typename StructType>
+	concept IsReflected = requires {{ typename StructType::ReflectedSuper; StructType::ReflectedTypeId; StructType::ReflectedMembers; }};
+
+	/*
+	* Calls 'Callback(const FMemberDescriptor& Member)' for every member of 'StructType', starting with the members of its Supers.
+	*
+	* The loop is unrolled at compile-time and every descriptor is a constant. The callback returns either void, or a bool that is false
+	* to stop the iteration. Returns false if the iteration was stopped.
+	*/
+	template<typename StructType, typename CallbackType> requires IsReflected<StructType>
+	constexpr bool ForEachMemberDescriptor(CallbackType&& Callback)
+	{{
+		using SuperType = typename StructType::ReflectedSuper;
+
+		if constexpr (!std::is_void_v<SuperType>)
+		{{
+			if (!ForEachMemberDescriptor<SuperType>(Callback))
+				return false;
+		}}
+
+		auto CallForMember = [&](const FMemberDescriptor& Member) -> bool
+		{{
+			if constexpr (std::is_void_v<std::invoke_result_t<CallbackType&, const FMemberDescriptor&>>)
+			{{
+				Callback(Member);
+				return true;
+			}}
+			else
+			{{
+				return static_cast<bool>(Callback(Member));
+			}}
+		}};
+
+		return [&]<size_t... Indices>(std::index_sequence<Indices...>) -> bool
+		{{
+			return (CallForMember(StructType::ReflectedMembers[Indices]) && ...);
+		}}(std::make_index_sequence<StructType::ReflectedMembers.size()>());
+	}}
+
+	/*
+	* Calls 'Callback(const FMemberDescriptor& Member, uint8* MemberAddress)' for every member of 'Struct', starting with the members of its Supers.
+	* 
+	* 'MemberAddress' is a 'const uint8*' for const structs. The callback returns either void, or a bool that is false to stop the iteration.
+	*/
+	template<typename StructType, typename CallbackType> requires IsReflected<std::remove_const_t<StructType>>
+	inline bool ForEachMember(StructType& Struct, CallbackType&& Callback)
+	{{
+		using BytePtrType = std::conditional_t<std::is_const_v<StructType>, const uint8*, uint8*>;
+
+		BytePtrType StructAddress = reinterpret_cast<BytePtrType>(&Struct);
+
+		return ForEachMemberDescriptor<std::remove_const_t<StructType>>([&](const FMemberDescriptor& Member) -> bool
+		{{
+			if constexpr (std::is_void_v<std::invoke_result_t<CallbackType&, const FMemberDescriptor&, BytePtrType>>)
+			{{
+				Callback(Member, StructAddress + Member.Offset);
+				return true;
+			}}
+			else
+			{{
+				return static_cast<bool>(Callback(Member, StructAddress + Member.Offset));
+			}}
+		}});
+	}}
+}}
+)", MemberKinds.Get());
+	}
+
+	if constexpr (bAddStaticClassTable)
+		GenerateStaticClassTable(BasicCpp);
+
+	/* UObject::FindClassFast/FindClass check the StaticClass() table first, if there is one */
+	BasicCpp << R"(
+class UClass* BasicFilesImpleUtils::FindClassByName(const std::string& Name)
+{
+	return UObject::FindClassFast(Name);
+}
+
+class UClass* BasicFilesImpleUtils::FindClassByFullName(const std::string& Name)
+{
+	return UObject::FindClass(Name);
+}
+)";
+
+	BasicCpp << R"(
+std::string BasicFilesImpleUtils::GetObjectName(class UClass* Class)
+{
+	return Class->GetName();
 }
 
 int32 BasicFilesImpleUtils::GetObjectIndex(class UClass* Class)
@@ -3130,52 +4394,1268 @@ int32 BasicFilesImpleUtils::GetObjectIndex(class UClass* Class)
 	return Class->Index;
 }
 
-uint64 BasicFilesImpleUtils::GetObjFNameAsUInt64(class UClass* Class)
-{
-	return *reinterpret_cast<uint64*>(&Class->Name);
-}
+uint64 BasicFilesImpleUtils::GetObjFNameAsUInt64(class UClass* Class)
+{
+	return *reinterpret_cast<uint64*>(&Class->Name);
+}
+
+class UObject* BasicFilesImpleUtils::GetObjectByIndex(int32 Index)
+{
+	return UObject::GObjects->GetByIndex(Index);
+}
+
+UFunction* BasicFilesImpleUtils::FindFunctionByFName(const FName* Name)
+{
+	for (UObject* Object : UObject::GObjects)
+	{
+		if (Object->Name == *Name)
+			return static_cast<UFunction*>(Object);
+	}
+
+	return nullptr;
+}
+
+)";
+
+	if constexpr (Settings::CppGenerator::bAddFunctionTables)
+	{
+		BasicCpp << R"(
+void BasicFilesImpleUtils::ResolveFunctionTable(const char* PackageName, const FunctionTableKey* Keys, std::atomic<UFunction*>* OutFunctions, int32 NumFunctions, std::atomic<int32>& InOutNumScannedObjects)
+{
+	static std::mutex ResolveLock;
+
+	std::scoped_lock Lock(ResolveLock);
+
+	const int32 NumObjects = UObject::GObjects->Num();
+
+	/* Another thread scanned GObjects while this one was waiting for the lock */
+	if (NumObjects <= InOutNumScannedObjects.load(std::memory_order_relaxed))
+		return;
+
+	InOutNumScannedObjects.store(NumObjects, std::memory_order_release);
+
+	/* Key: "OuterName.FunctionName", value: index into 'Keys' */
+	std::unordered_map<std::string, int32> UnresolvedFunctions;
+
+	for (int32 i = 0; i < NumFunctions; i++)
+	{
+		if (OutFunctions[i].load(std::memory_order_relaxed) == nullptr)
+			UnresolvedFunctions.emplace(std::string(Keys[i].OuterName) + "." + Keys[i].FunctionName, i);
+	}
+
+	/* Another thread resolved the table while this one was waiting for the lock */
+	if (UnresolvedFunctions.empty())
+		return;
+
+	/* Outermost objects that were already compared to 'PackageName', so every package-name is only converted to a string once */
+	std::unordered_map<const UObject*, bool> IsTablePackage;
+
+	for (UObject* Object : UObject::GObjects)
+	{
+		if (!Object->Outer || !Object->HasTypeFlag(EClassCastFlags::Function))
+			continue;
+
+		const UObject* Package = Object->Outer;
+
+		while (Package->Outer)
+			Package = Package->Outer;
+
+		auto [It, bWasInserted] = IsTablePackage.try_emplace(Package, false);
+
+		if (bWasInserted)
+			It->second = Package->GetName() == PackageName;
+
+		if (!It->second)
+			continue;
+
+		auto FuncIt = UnresolvedFunctions.find(Object->Outer->GetName() + "." + Object->GetName());
+
+		if (FuncIt == UnresolvedFunctions.end())
+			continue;
+
+		OutFunctions[FuncIt->second].store(static_cast<UFunction*>(Object), std::memory_order_release);
+		UnresolvedFunctions.erase(FuncIt);
+
+		if (UnresolvedFunctions.empty())
+			break;
+	}
+}
+
+)";
+	}
+
+	if constexpr (Settings::CppGenerator::bAddObjectNameIndex)
+	{
+		/* FName::Number only exists if the number isn't stored in the name-entry */
+		if (!Settings::Internal::bUseUoutlineNumberName)
+		{
+			BasicCpp << R"(
+namespace ObjectNameIndex
+{
+	static constexpr bool bHasNameNumber = true;
+
+	static int32 GetNameNumber(const FName& Name)
+	{
+		return Name.Number;
+	}
+
+	static FName GetNameWithoutNumber(FName Name)
+	{
+		Name.Number = 0;
+		return Name;
+	}
+}
+)";
+		}
+		else
+		{
+			BasicCpp << R"(
+namespace ObjectNameIndex
+{
+	static constexpr bool bHasNameNumber = false;
+
+	static int32 GetNameNumber(const FName& Name)
+	{
+		return 0;
+	}
+
+	static FName GetNameWithoutNumber(FName Name)
+	{
+		return Name;
+	}
+}
+)";
+		}
+
+		BasicCpp << R"(
+namespace ObjectNameIndex
+{
+	struct FIndexedObject
+	{
+		int32 ObjectIndex;
+		int32 Number;
+		class UObject* Object;
+	};
+
+	static std::mutex IndexMutex;
+
+	/* ComparisonIndex -> all objects with this name, ordered by their index in GObjects */
+	static std::unordered_map<int32, std::vector<FIndexedObject>> ObjectsByName;
+
+	/* Name without number (as returned by FName::ToString()) -> ComparisonIndex, one string per unique name */
+	static std::unordered_map<std::string, int32> ComparisonIndexByString;
+
+	/* Lookups that weren't found by the linear search either, valid until the number of objects in GObjects changes */
+	static std::unordered_set<std::string> MissedLookups;
+
+	static int32 NumIndexedObjects = 0;
+
+	static void AddObject(class UObject* Object, int32 ObjectIndex)
+	{
+		std::vector<FIndexedObject>& Objects = ObjectsByName[Object->Name.ComparisonIndex];
+
+		if (Objects.empty())
+			ComparisonIndexByString.emplace(GetNameWithoutNumber(Object->Name).ToString(), Object->Name.ComparisonIndex);
+
+		const FIndexedObject NewEntry = { ObjectIndex, GetNameNumber(Object->Name), Object };
+
+		/* Objects found by the linear fallback live in reused slots, which can be before other entries */
+		auto InsertPos = std::lower_bound(Objects.begin(), Objects.end(), NewEntry, [](const FIndexedObject& Left, const FIndexedObject& Right) { return Left.ObjectIndex < Right.ObjectIndex; });
+
+		/* A slot holds one object at a time, an existing entry is either this object or one that was replaced */
+		if (InsertPos != Objects.end() && InsertPos->ObjectIndex == ObjectIndex)
+		{
+			*InsertPos = NewEntry;
+			return;
+		}
+
+		Objects.insert(InsertPos, NewEntry);
+	}
+
+	static std::string GetLookupKey(const std::string& Name, EClassCastFlags RequiredType, bool bIsFullName)
+	{
+		return std::to_string(static_cast<uint64>(RequiredType)) + (bIsFullName ? "|F|" : "|N|") + Name;
+	}
+
+	/* Indexes everything that was appended to GObjects since the last lookup */
+	static void UpdateIndex()
+	{
+		const int32 NumObjects = UObject::GObjects->Num();
+
+		if (NumObjects != NumIndexedObjects)
+			MissedLookups.clear();
+
+		if (NumObjects < NumIndexedObjects)
+		{
+			ObjectsByName.clear();
+			ComparisonIndexByString.clear();
+			NumIndexedObjects = 0;
+		}
+
+		UObject::GObjects->ForEachObjectInRange(NumIndexedObjects, NumObjects, [](class UObject* Object) -> void
+		{
+			AddObject(Object, Object->Index);
+		});
+
+		NumIndexedObjects = NumObjects;
+	}
+
+	/* "Name_3" can either be the name "Name_3", or "Name" with FName::Number 4 */
+	static bool SplitNameNumber(const std::string& Name, std::string& OutBaseName, int32& OutNumber)
+	{
+		const size_t UnderscorePos = Name.rfind('_');
+
+		if (UnderscorePos == std::string::npos || UnderscorePos == 0 || UnderscorePos == (Name.size() - 1))
+			return false;
+
+		const size_t NumDigits = Name.size() - UnderscorePos - 1;
+
+		/* FName never writes numbers with leading zeros, and numbers need to fit into an int32 */
+		if (NumDigits > 9 || (NumDigits > 1 && Name[UnderscorePos + 1] == '0'))
+			return false;
+
+		int32 Number = 0;
+
+		for (size_t i = UnderscorePos + 1; i < Name.size(); i++)
+		{
+			if (Name[i] < '0' || Name[i] > '9')
+				return false;
+
+			Number = (Number * 10) + (Name[i] - '0');
+		}
+
+		OutBaseName = Name.substr(0, UnderscorePos);
+		OutNumber = Number + 1;
+
+		return true;
+	}
+
+	/* "Class Package.Outer.Name" -> "Name" */
+	static std::string GetNameFromFullName(const std::string& FullName)
+	{
+		const size_t SeparatorPos = FullName.find_last_of(". ");
+
+		return SeparatorPos == std::string::npos ? FullName : FullName.substr(SeparatorPos + 1);
+	}
+
+	/* Returns the first valid object, in GObjects order, named [ComparisonIndex of 'BaseName', Number] */
+	static class UObject* FindInIndex(const std::string& BaseName, int32 Number, EClassCastFlags RequiredType, const std::string* FullName, int32& InOutBestIndex)
+	{
+		auto IndexIt = ComparisonIndexByString.find(BaseName);
+
+		if (IndexIt == ComparisonIndexByString.end())
+			return nullptr;
+
+		auto ObjectsIt = ObjectsByName.find(IndexIt->second);
+
+		if (ObjectsIt == ObjectsByName.end())
+			return nullptr;
+
+		std::vector<FIndexedObject>& Objects = ObjectsIt->second;
+
+		for (auto It = Objects.begin(); It != Objects.end() && It->ObjectIndex < InOutBestIndex;)
+		{
+			class UObject* Object = It->Object;
+
+			/* The slot was reused, or the object was renamed */
+			if (UObject::GObjects->GetByIndex(It->ObjectIndex) != Object || Object->Name.ComparisonIndex != IndexIt->second || GetNameNumber(Object->Name) != It->Number)
+			{
+				It = Objects.erase(It);
+				continue;
+			}
+
+			if (It->Number == Number && Object->HasTypeFlag(RequiredType) && (!FullName || Object->GetFullName() == *FullName))
+			{
+				InOutBestIndex = It->ObjectIndex;
+				return Object;
+			}
+
+			++It;
+		}
+
+		return nullptr;
+	}
+
+	class UObject* FindObject(const std::string& Name, EClassCastFlags RequiredType, bool bIsFullName)
+	{
+		const std::string ObjectName = bIsFullName ? GetNameFromFullName(Name) : Name;
+		const std::string* FullName = bIsFullName ? &Name : nullptr;
+		const std::string LookupKey = GetLookupKey(Name, RequiredType, bIsFullName);
+
+		int32 NumSearchedObjects = 0;
+
+		{
+			std::scoped_lock Lock(IndexMutex);
+
+			UpdateIndex();
+
+			if (MissedLookups.find(LookupKey) != MissedLookups.end())
+				return nullptr;
+
+			NumSearchedObjects = NumIndexedObjects;
+
+			int32 BestIndex = 0x7FFFFFFF;
+			class UObject* Result = FindInIndex(ObjectName, 0, RequiredType, FullName, BestIndex);
+
+			std::string BaseName;
+			int32 Number = 0;
+
+			if (bHasNameNumber && SplitNameNumber(ObjectName, BaseName, Number))
+			{
+				if (class UObject* NumberedResult = FindInIndex(BaseName, Number, RequiredType, FullName, BestIndex))
+					Result = NumberedResult;
+			}
+
+			if (Result)
+				return Result;
+		}
+
+		/* Objects in reused GObjects-slots, or with names the full-name can't be split at, aren't in the index */
+		class UObject* Result = FindObjectLinear(Name, RequiredType, bIsFullName);
+
+		std::scoped_lock Lock(IndexMutex);
+
+		if (!Result)
+		{
+			/* Objects appended during the linear search may not have been searched */
+			if (UObject::GObjects->Num() == NumSearchedObjects && NumIndexedObjects == NumSearchedObjects)
+				MissedLookups.insert(LookupKey);
+		}
+		else if (Result->Index < NumIndexedObjects)
+		{
+			AddObject(Result, Result->Index);
+		}
+
+		return Result;
+	}
+
+	class UObject* FindObjectLinear(const std::string& Name, EClassCastFlags RequiredType, bool bIsFullName)
+	{
+		for (class UObject* Object : UObject::GObjects)
+		{
+			if (!Object->HasTypeFlag(RequiredType))
+				continue;
+
+			if ((bIsFullName ? Object->GetFullName() : Object->GetName()) == Name)
+				return Object;
+		}
+
+		return nullptr;
+	}
+
+	void Invalidate()
+	{
+		std::scoped_lock Lock(IndexMutex);
+
+		ObjectsByName.clear();
+		ComparisonIndexByString.clear();
+		MissedLookups.clear();
+		NumIndexedObjects = 0;
+	}
+}
+
+)";
+
+		if constexpr (Settings::CppGenerator::bAddObjectNameIndexBenchmark)
+		{
+			BasicCpp << R"(
+namespace ObjectNameIndex
+{
+	void Benchmark(const std::string& Name, int32 NumIterations, bool bIsFullName)
+	{
+		using Clock = std::chrono::high_resolution_clock;
+
+		auto GetMicroseconds = [](Clock::time_point Start) -> double
+		{
+			return std::chrono::duration<double, std::micro>(Clock::now() - Start).count();
+		};
+
+		class UObject* LinearResult = nullptr;
+		class UObject* IndexedResult = nullptr;
+
+		auto Start = Clock::now();
+
+		for (int32 i = 0; i < NumIterations; i++)
+			LinearResult = FindObjectLinear(Name, EClassCastFlags::None, bIsFullName);
+
+		const double LinearTime = GetMicroseconds(Start);
+
+		Invalidate();
+
+		Start = Clock::now();
+		IndexedResult = FindObject(Name, EClassCastFlags::None, bIsFullName);
+		const double BuildTime = GetMicroseconds(Start);
+
+		Start = Clock::now();
+
+		for (int32 i = 0; i < NumIterations; i++)
+			IndexedResult = FindObject(Name, EClassCastFlags::None, bIsFullName);
+
+		const double IndexedTime = GetMicroseconds(Start);
+
+		std::cout << "ObjectNameIndex::Benchmark(\"" << Name << "\", " << NumIterations << "):\n";
+		std::cout << "\tObjects:         " << UObject::GObjects->Num() << "\n";
+		std::cout << "\tLinear:          " << (LinearTime / NumIterations) << "us per lookup\n";
+		std::cout << "\tIndex build:     " << (BuildTime / 1000.0) << "ms\n";
+		std::cout << "\tIndexed:         " << (IndexedTime / NumIterations) << "us per lookup\n";
+		std::cout << "\tResults match:   " << (LinearResult == IndexedResult ? "true" : "false") << "\n" << std::endl;
+	}
+}
+
+)";
+		}
+	}
+
+	if constexpr (Settings::CppGenerator::bAddClassBaseChains)
+	{
+		BasicCpp << R"(
+namespace ClassBaseChain
+{
+	/* Chains are cached by object-index, in chunks that are allocated on first use and never freed */
+	static constexpr int32 NumElementsPerChunk = 0x10000;
+	static constexpr int32 MaxChunks = 0x800;
+
+	struct FChainChunk
+	{
+		std::atomic<const FBaseChain*> Chains[NumElementsPerChunk];
+	};
+
+	static std::atomic<FChainChunk*> Chunks[MaxChunks] = {};
+
+	static const FBaseChain* CreateChain(const UStruct* Struct)
+	{
+		int32 Depth = 0x0;
+
+		for (const UStruct* Super = Struct->Super; Super; Super = Super->Super)
+			Depth++;
+
+		/* One allocation for the chain and its ancestors, they're always read together */
+		uint8* Memory = new uint8[sizeof(FBaseChain) + ((Depth + 1) * sizeof(const UStruct*))];
+
+		const UStruct** Ancestors = reinterpret_cast<const UStruct**>(Memory + sizeof(FBaseChain));
+
+		int32 Idx = Depth;
+
+		for (const UStruct* Current = Struct; Current; Current = Current->Super)
+			Ancestors[Idx--] = Current;
+
+		return new (Memory) FBaseChain{ Depth, Ancestors };
+	}
+
+	const FBaseChain* Get(const UStruct* Struct)
+	{
+		const int32 ChunkIdx = Struct->Index / NumElementsPerChunk;
+		const int32 InChunkIdx = Struct->Index % NumElementsPerChunk;
+
+		if (ChunkIdx < 0 || ChunkIdx >= MaxChunks) [[unlikely]]
+			return CreateChain(Struct); // Not cached, leaks. GObjects never gets this large.
+
+		FChainChunk* Chunk = Chunks[ChunkIdx].load(std::memory_order_acquire);
+
+		if (!Chunk) [[unlikely]]
+		{
+			FChainChunk* NewChunk = new FChainChunk{};
+
+			if (Chunks[ChunkIdx].compare_exchange_strong(Chunk, NewChunk, std::memory_order_acq_rel))
+			{
+				Chunk = NewChunk;
+			}
+			else
+			{
+				delete NewChunk; // Another thread was faster, 'Chunk' was set by compare_exchange_strong
+			}
+		}
+
+		std::atomic<const FBaseChain*>& Slot = Chunk->Chains[InChunkIdx];
+
+		const FBaseChain* Chain = Slot.load(std::memory_order_acquire);
+
+		/* The slot may belong to a struct that was unloaded, the struct itself is always the last ancestor */
+		if (!Chain || Chain->Ancestors[Chain->Depth] != Struct) [[unlikely]]
+		{
+			/* The old chain isn't deleted, another thread could still be reading it */
+			Chain = CreateChain(Struct);
+			Slot.store(Chain, std::memory_order_release);
+		}
+
+		return Chain;
+	}
+
+	bool IsSubclassOf(const UStruct* Struct, const UStruct* Base)
+	{
+		if (!Struct || !Base)
+			return false;
+
+		if (Struct == Base)
+			return true;
+
+		const FBaseChain* Chain = Get(Struct);
+		const FBaseChain* BaseChain = Get(Base);
+
+		return Chain->Depth >= BaseChain->Depth && Chain->Ancestors[BaseChain->Depth] == Base;
+	}
+
+	bool IsSubclassOfLinear(const UStruct* Struct, const UStruct* Base)
+	{
+		if (!Base)
+			return false;
+
+		for (const UStruct* Current = Struct; Current; Current = Current->Super)
+		{
+			if (Current == Base)
+				return true;
+		}
+
+		return false;
+	}
+}
+
+)";
+
+		if constexpr (Settings::CppGenerator::bAddClassBaseChainBenchmark)
+		{
+			BasicCpp << R"(
+namespace ClassBaseChain
+{
+	void Benchmark(const UClass* TypeClass, int32 NumIterations)
+	{
+		using Clock = std::chrono::high_resolution_clock;
+
+		auto GetMicroseconds = [](Clock::time_point Start) -> double
+		{
+			return std::chrono::duration<double, std::micro>(Clock::now() - Start).count();
+		};
+
+		std::vector<const UClass*> Classes;
+		Classes.reserve(UObject::GObjects->Num());
+
+		for (UObject* Object : UObject::GObjects)
+		{
+			if (Object->Class)
+				Classes.push_back(Object->Class);
+		}
+
+		int32 NumLinearMatches = 0x0;
+		int32 NumChainMatches = 0x0;
+
+		/* The depth of 'TypeClass' is a constant in UObject::IsA<T>(), so it's looked up only once here too */
+		const FBaseChain* TypeChain = Get(TypeClass);
+		const int32 TypeDepth = TypeChain->Depth;
+
+		auto Start = Clock::now();
+
+		for (int32 i = 0; i < NumIterations; i++)
+		{
+			for (const UClass* Class : Classes)
+				NumLinearMatches += IsSubclassOfLinear(Class, TypeClass);
+		}
+
+		const double LinearTime = GetMicroseconds(Start);
+
+		Start = Clock::now();
+
+		for (int32 i = 0; i < NumIterations; i++)
+		{
+			for (const UClass* Class : Classes)
+			{
+				const FBaseChain* Chain = Get(Class);
+
+				NumChainMatches += Chain->Depth >= TypeDepth && Chain->Ancestors[TypeDepth] == TypeClass;
+			}
+		}
+
+		const double ChainTime = GetMicroseconds(Start);
+
+		const double NumChecks = static_cast<double>(Classes.size()) * NumIterations;
+
+		std::cout << "ClassBaseChain::Benchmark(\"" << TypeClass->GetName() << "\", " << NumIterations << "):\n";
+		std::cout << "\tObjects:         " << Classes.size() << "\n";
+		std::cout << "\tSuper-chain:     " << ((LinearTime * 1000.0) / NumChecks) << "ns per check\n";
+		std::cout << "\tBase-chain:      " << ((ChainTime * 1000.0) / NumChecks) << "ns per check (includes creating the chains)\n";
+		std::cout << "\tResults match:   " << (NumLinearMatches == NumChainMatches ? "true" : "false") << "\n" << std::endl;
+	}
+}
+
+)";
+		}
+	}
+
+	if constexpr (Settings::CppGenerator::bCallNativeFunctionsDirectly)
+	{
+		BasicCpp << std::format(R"(
+namespace NativeCall
+{{
+	/* FOutputDevice's virtual functions are only called by a thunk to report script errors, the calls are ignored */
+	static void IgnoreOutputDeviceCall()
+	{{
+	}}
+
+	static void** OutputDeviceVTable = []() -> void**
+	{{
+		static void* VTable[0x20];
+
+		for (void*& Entry : VTable)
+			Entry = reinterpret_cast<void*>(&IgnoreOutputDeviceCall);
+
+		return VTable;
+	}}();
+
+	using PropertyType = {0};
+
+	/* CPF_Parm, CPF_OutParm and FUNC_HasOutParms */
+	constexpr uint64 ParmFlag = 0x80;
+	constexpr uint64 OutParmFlag = 0x100;
+	constexpr uint32 HasOutParmsFlag = 0x00400000;
+
+	void Invoke(const UObject* Object, UFunction* Function, void* Parms, void* ReturnValue)
+	{{
+		FNativeCallFrame Frame{{}};
+		Frame.VTable = OutputDeviceVTable;
+		Frame.Node = Function;
+		Frame.Object = const_cast<UObject*>(Object);
+		Frame.Locals = static_cast<uint8*>(Parms);
+		Frame.PropertyChainForCompiledIn = Function->{1};
+		Frame.CurrentNativeFunction = Function;
+
+		/* The thunk looks every out-parameter up in this list, like ProcessEvent it contains one record per CPF_OutParm parameter, in order */
+		FOutParmRec OutParms[MaxOutParms];
+		FOutParmRec** LastOutParm = &Frame.OutParms;
+
+		if (Function->FunctionFlags & HasOutParmsFlag)
+		{{
+			int32 NumOutParms = 0x0;
+
+			for (PropertyType* Property = reinterpret_cast<PropertyType*>(Function->{1}); Property && (Property->PropertyFlags & ParmFlag); Property = reinterpret_cast<PropertyType*>(Property->Next))
+			{{
+				if (!(Property->PropertyFlags & OutParmFlag) || NumOutParms >= MaxOutParms)
+					continue;
+
+				FOutParmRec* Out = &OutParms[NumOutParms++];
+				Out->Property = Property;
+				Out->PropAddr = static_cast<uint8*>(Parms) + Property->Offset;
+
+				*LastOutParm = Out;
+				LastOutParm = &Out->NextOutParm;
+			}}
+		}}
+
+		*LastOutParm = nullptr;
+
+		Function->ExecFunction(const_cast<UObject*>(Object), &Frame, ReturnValue);
+	}}
+
+	void Benchmark(const UObject* Object, UFunction* Function, void* Parms, void* ReturnValue, int32 NumIterations)
+	{{
+		using Clock = std::chrono::high_resolution_clock;
+
+		auto GetNanoseconds = [](Clock::time_point Start) -> double
+		{{
+			return std::chrono::duration<double, std::nano>(Clock::now() - Start).count();
+		}};
+
+		auto Start = Clock::now();
+
+		for (int32 i = 0; i < NumIterations; i++)
+		{{
+			/* What the generated wrappers do for native functions, if 'bCallNativeFunctionsDirectly' is disabled */
+			auto Flgs = Function->FunctionFlags;
+			Function->FunctionFlags |= 0x400;
+
+			Object->ProcessEvent(Function, Parms);
+
+			Function->FunctionFlags = Flgs;
+		}}
+
+		const double ProcessEventTime = GetNanoseconds(Start);
+
+		Start = Clock::now();
+
+		for (int32 i = 0; i < NumIterations; i++)
+			Invoke(Object, Function, Parms, ReturnValue);
+
+		const double InvokeTime = GetNanoseconds(Start);
+
+		std::cout << "NativeCall::Benchmark(\"" << Function->GetName() << "\", " << NumIterations << "):\n";
+		std::cout << "\tProcessEvent:    " << (ProcessEventTime / NumIterations) << "ns per call\n";
+		std::cout << "\tExecFunction:    " << (InvokeTime / NumIterations) << "ns per call\n" << std::endl;
+	}}
+
+	bool SelfTest()
+	{{
+		/* int32 FMod(Dividend, Divisor, Remainder&), the parameters are floats or doubles depending on the engine version */
+		UFunction* Function = UObject::FindObject<UFunction>("Function Engine.KismetMathLibrary.FMod", EClassCastFlags::Function);
+
+		if (!Function)
+		{{
+			std::cout << "NativeCall::SelfTest(): 'KismetMathLibrary.FMod' was not found\n" << std::endl;
+			return false;
+		}}
+
+		struct FParam
+		{{
+			const char* Name;
+			int32 Offset = -1;
+			int32 Size = 0x0;
+		}};
+
+		FParam Dividend{{ "Dividend" }};
+		FParam Divisor{{ "Divisor" }};
+		FParam Remainder{{ "Remainder" }};
+		FParam ReturnValue{{ "ReturnValue" }};
+
+		for (PropertyType* Property = reinterpret_cast<PropertyType*>(Function->{1}); Property; Property = reinterpret_cast<PropertyType*>(Property->Next))
+		{{
+			const std::string Name = Property->Name.ToString();
+
+			for (FParam* Param : {{ &Dividend, &Divisor, &Remainder, &ReturnValue }})
+			{{
+				if (Name == Param->Name)
+				{{
+					Param->Offset = Property->Offset;
+					Param->Size = Property->ElementSize;
+				}}
+			}}
+		}}
+
+		alignas(0x10) uint8 ProcessEventParms[0x40] = {{ 0x0 }};
+		alignas(0x10) uint8 InvokeParms[0x40] = {{ 0x0 }};
+
+		for (const FParam* Param : {{ &Dividend, &Divisor, &Remainder, &ReturnValue }})
+		{{
+			if (Param->Offset < 0x0 || (Param->Offset + Param->Size) > static_cast<int32>(sizeof(InvokeParms)))
+			{{
+				std::cout << "NativeCall::SelfTest(): Unexpected parameter '" << Param->Name << "' of 'KismetMathLibrary.FMod'\n" << std::endl;
+				return false;
+			}}
+		}}
+
+		auto WriteReal = [](uint8* Parms, const FParam& Param, double Value) -> void
+		{{
+			if (Param.Size == sizeof(double))
+				memcpy(Parms + Param.Offset, &Value, sizeof(double));
+			else
+				*reinterpret_cast<float*>(Parms + Param.Offset) = static_cast<float>(Value);
+		}};
+
+		auto ReadReal = [](const uint8* Parms, const FParam& Param) -> double
+		{{
+			if (Param.Size == sizeof(double))
+				return *reinterpret_cast<const double*>(Parms + Param.Offset);
+
+			return *reinterpret_cast<const float*>(Parms + Param.Offset);
+		}};
+
+		for (uint8* Parms : {{ ProcessEventParms, InvokeParms }})
+		{{
+			WriteReal(Parms, Dividend, 7.5);
+			WriteReal(Parms, Divisor, 2.0);
+			WriteReal(Parms, Remainder, -1.0);
+		}}
+
+		const UObject* DefaultObject = static_cast<UClass*>(Function->Outer)->DefaultObject;
+
+		auto Flgs = Function->FunctionFlags;
+		Function->FunctionFlags |= 0x400;
+
+		DefaultObject->ProcessEvent(Function, ProcessEventParms);
+
+		Function->FunctionFlags = Flgs;
+
+		Invoke(DefaultObject, Function, InvokeParms, InvokeParms + ReturnValue.Offset);
+
+		const int32 ProcessEventResult = *reinterpret_cast<const int32*>(ProcessEventParms + ReturnValue.Offset);
+		const int32 InvokeResult = *reinterpret_cast<const int32*>(InvokeParms + ReturnValue.Offset);
+
+		const bool bSucceeded = ProcessEventResult == 3 && InvokeResult == 3 && ReadReal(ProcessEventParms, Remainder) == 1.5 && ReadReal(InvokeParms, Remainder) == 1.5;
+
+		std::cout << "NativeCall::SelfTest(): " << (bSucceeded ? "SUCCEEDED!" : "FAILED!") << "\n";
+		std::cout << "\tProcessEvent:    FMod(7.5, 2.0) = " << ProcessEventResult << ", Remainder = " << ReadReal(ProcessEventParms, Remainder) << "\n";
+		std::cout << "\tExecFunction:    FMod(7.5, 2.0) = " << InvokeResult << ", Remainder = " << ReadReal(InvokeParms, Remainder) << "\n" << std::endl;
+
+		return bSucceeded;
+	}}
+}}
+
+)", Settings::Internal::bUseFProperty ? "struct FProperty" : "class UProperty", Settings::Internal::bUseFProperty ? "ChildProperties" : "Children");
+	}
+
+	if constexpr (Settings::CppGenerator::bAddContainerLookupBenchmark)
+	{
+		BasicCpp << R"(
+namespace ContainerLookup
+{
+	/*
+	* Synthetic memory image of a TSet<ElementType> (or of the TSet inside of a TMap), written at the engine's offsets:
+	* 
+	* 0x00 TSparseArray::Data, 0x10 TSparseArray::AllocationFlags, 0x30 FirstFreeIndex, 0x34 NumFreeIndices, 0x38 Hash, 0x48 HashSize
+	* 
+	* Every 'HoleInterval'th slot is left unallocated, the way removed elements are. Elements are inserted at the front of their bucket, like the engine does.
+	*/
+	template<typename ElementType>
+	class TSetImage
+	{
+	private:
+		struct FElement
+		{
+			ElementType Value;
+			int32 HashNextId;
+			int32 HashIndex;
+		};
+
+		/* Slots of the sparse array are unions of the element and the free-list link */
+		static constexpr int32 SlotSize = sizeof(FElement) > 0x8 ? sizeof(FElement) : 0x8;
+
+		static constexpr int32 NumInlineAllocationBits = 4 * 32;
+
+		static constexpr int32 HoleInterval = 0x7;
+
+	private:
+		std::vector<uint64> Slots;
+		std::vector<uint32> AllocationBits;
+		std::vector<int32> Buckets;
+
+		alignas(0x8) uint8 Image[0x50] = { 0x0 };
+
+	private:
+		template<typename T>
+		inline void Write(int32 Offset, T Value)
+		{
+			memcpy(Image + Offset, &Value, sizeof(T));
+		}
+
+		/* Same as the engine's TSet::GetNumberOfHashBuckets */
+		static int32 GetNumberOfHashBuckets(int32 NumElements)
+		{
+			if (NumElements < 4)
+				return 1;
+
+			int32 NumBuckets = 1;
+
+			while (NumBuckets < (NumElements / 2 + 8))
+				NumBuckets <<= 1;
+
+			return NumBuckets;
+		}
+
+	public:
+		TSetImage(const std::vector<ElementType>& Values, const std::vector<uint32>& Hashes)
+		{
+			const int32 NumElements = static_cast<int32>(Values.size());
+			const int32 MaxSlots = NumElements + (NumElements / (HoleInterval - 1)) + 1;
+
+			const int32 HashSize = GetNumberOfHashBuckets(NumElements);
+
+			Slots.resize(((static_cast<size_t>(MaxSlots) * SlotSize) / sizeof(uint64)) + 1, 0x0);
+			AllocationBits.resize((MaxSlots / 32) + 1, 0x0);
+			Buckets.resize(HashSize, -1);
+
+			uint8* SlotData = reinterpret_cast<uint8*>(Slots.data());
+
+			int32 NumSlots = 0;
+			int32 NumHoles = 0;
+
+			for (int32 ValueIdx = 0; ValueIdx < NumElements; NumSlots++)
+			{
+				if ((NumSlots % HoleInterval) == (HoleInterval - 1))
+				{
+					NumHoles++;
+					continue;
+				}
+
+				const int32 Bucket = static_cast<int32>(Hashes[ValueIdx] & (HashSize - 1));
+
+				const FElement Element = { Values[ValueIdx], Buckets[Bucket], Bucket };
+				memcpy(SlotData + (static_cast<size_t>(NumSlots) * SlotSize), &Element, sizeof(FElement));
+
+				Buckets[Bucket] = NumSlots;
+				AllocationBits[NumSlots / 32] |= (1u << (NumSlots % 32));
+
+				ValueIdx++;
+			}
+
+			Write<void*>(0x00, SlotData);
+			Write<int32>(0x08, NumSlots);
+			Write<int32>(0x0C, NumSlots);
+
+			/* Small bit-arrays use the inline-allocation */
+			if (NumSlots <= NumInlineAllocationBits)
+			{
+				memcpy(Image + 0x10, AllocationBits.data(), AllocationBits.size() * sizeof(uint32));
+			}
+			else
+			{
+				Write<void*>(0x20, AllocationBits.data());
+			}
+
+			Write<int32>(0x28, NumSlots);
+			Write<int32>(0x2C, static_cast<int32>(AllocationBits.size() * 32));
+			Write<int32>(0x30, NumHoles > 0 ? HoleInterval - 1 : -1);
+			Write<int32>(0x34, NumHoles);
+
+			/* A single bucket uses the inline-allocation */
+			if (HashSize == 1)
+			{
+				Write<int32>(0x38, Buckets[0]);
+			}
+			else
+			{
+				Write<void*>(0x40, Buckets.data());
+			}
+
+			Write<int32>(0x48, HashSize);
+		}
+
+		TSetImage(const TSetImage&) = delete;
+
+	public:
+		template<typename ContainerType>
+		inline const ContainerType& As() const { return *reinterpret_cast<const ContainerType*>(Image); }
+	};
+
+	void Benchmark(int32 NumElements, int32 NumIterations)
+	{
+		using Clock = std::chrono::high_resolution_clock;
+
+		auto GetMicroseconds = [](Clock::time_point Start) -> double
+		{
+			return std::chrono::duration<double, std::micro>(Clock::now() - Start).count();
+		};
+
+		std::vector<TPair<int32, int32>> Pairs;
+		std::vector<uint32> Hashes;
+
+		for (int32 i = 0; i < NumElements; i++)
+		{
+			Pairs.emplace_back(i * 0x3, i);
+			Hashes.push_back(GetTypeHash(i * 0x3));
+		}
+
+		TSetImage<TPair<int32, int32>> Image(Pairs, Hashes);
+		TMap<int32, int32>& Map = const_cast<TMap<int32, int32>&>(Image.As<TMap<int32, int32>>());
+
+		auto Equals = [](const int32& Left, const int32& Right) -> bool { return Left == Right; };
+
+		/* Every lookup searches for a different key, half of them don't exist */
+		int64 LinearSum = 0;
+		int64 HashedSum = 0;
+
+		auto Start = Clock::now();
+
+		for (int32 i = 0; i < NumIterations; i++)
+		{
+			auto It = Map.Find((i % NumElements) * 0x3 + (i & 1), Equals);
+
+			if (It != end(Map))
+				LinearSum += It->Value();
+		}
+
+		const double LinearTime = GetMicroseconds(Start);
+
+		Start = Clock::now();
+
+		for (int32 i = 0; i < NumIterations; i++)
+		{
+			if (const int32* Value = Map.Find((i % NumElements) * 0x3 + (i & 1)))
+				HashedSum += *Value;
+		}
+
+		const double HashedTime = GetMicroseconds(Start);
+
+		std::cout << "ContainerLookup::Benchmark(" << NumElements << ", " << NumIterations << "):\n";
+		std::cout << "\tLinear:          " << ((LinearTime * 1000.0) / NumIterations) << "ns per lookup\n";
+		std::cout << "\tHashed:          " << ((HashedTime * 1000.0) / NumIterations) << "ns per lookup\n";
+		std::cout << "\tResults match:   " << (LinearSum == HashedSum ? "true" : "false") << "\n" << std::endl;
+	}
+}
+
+)";
+	}
+
+	BasicCpp << R"(
+bool TUObjectArray::ForEachObjectParallel(const std::function<bool(class UObject*)>& Callback, int32 NumThreads) const
+{
+	const int32 NumPartitions = (NumElements + (ObjectsPerPartition - 1)) / ObjectsPerPartition;
+
+	if (NumThreads <= 0)
+		NumThreads = static_cast<int32>(std::thread::hardware_concurrency());
+
+	if (NumThreads > NumPartitions)
+		NumThreads = NumPartitions;
+
+	std::atomic<int32> NextPartition = 0x0;
+	std::atomic<bool> bWasStopped = false;
+
+	/* Partitions are handed out one at a time, threads that got sparse chunks take over the remaining ones */
+	auto IteratePartitions = [&]() -> void
+	{
+		for (int32 Partition = NextPartition.fetch_add(1, std::memory_order_relaxed); Partition < NumPartitions; Partition = NextPartition.fetch_add(1, std::memory_order_relaxed))
+		{
+			const bool bFinishedPartition = ForEachObjectInRange(Partition * ObjectsPerPartition, (Partition + 1) * ObjectsPerPartition, [&](class UObject* Object) -> bool
+			{
+				return !bWasStopped.load(std::memory_order_relaxed) && Callback(Object);
+			});
+
+			if (!bFinishedPartition)
+			{
+				bWasStopped.store(true, std::memory_order_relaxed);
+				return;
+			}
+		}
+	};
+
+	std::vector<std::thread> Threads;
+	Threads.reserve(NumThreads > 0 ? NumThreads : 0);
+
+	/* The calling thread is one of the threads */
+	for (int32 i = 1; i < NumThreads; i++)
+		Threads.emplace_back(IteratePartitions);
+
+	IteratePartitions();
+
+	for (std::thread& Thread : Threads)
+		Thread.join();
+
+	return !bWasStopped.load(std::memory_order_relaxed);
+}
+
+)";
+
+	if constexpr (Settings::CppGenerator::bAddObjectIterationBenchmark)
+	{
+		BasicCpp << R"(
+namespace ObjectIteration
+{
+	void Benchmark(int32 NumIterations)
+	{
+		using Clock = std::chrono::high_resolution_clock;
+
+		auto GetMicroseconds = [](Clock::time_point Start) -> double
+		{
+			return std::chrono::duration<double, std::micro>(Clock::now() - Start).count();
+		};
+
+		/* Every pass reads the class of every object, like a search does. The parallel pass sums into one counter per chunk, so threads rarely share one. */
+		struct alignas(0x40) FCounter
+		{
+			std::atomic<uint64> Value = 0x0;
+		};
+
+		uint64 IndexSum = 0x0;
+		uint64 IteratorSum = 0x0;
+		uint64 ForEachSum = 0x0;
+		uint64 ParallelSum = 0x0;
+
+		auto Start = Clock::now();
+
+		for (int32 i = 0; i < NumIterations; i++)
+		{
+			for (int j = 0; j < UObject::GObjects->Num(); ++j)
+			{
+				if (UObject* Object = UObject::GObjects->GetByIndex(j))
+					IndexSum += reinterpret_cast<uint64>(Object->Class);
+			}
+		}
+
+		const double IndexTime = GetMicroseconds(Start);
+
+		Start = Clock::now();
+
+		for (int32 i = 0; i < NumIterations; i++)
+		{
+			for (UObject* Object : UObject::GObjects)
+				IteratorSum += reinterpret_cast<uint64>(Object->Class);
+		}
+
+		const double IteratorTime = GetMicroseconds(Start);
+
+		Start = Clock::now();
+
+		for (int32 i = 0; i < NumIterations; i++)
+		{
+			UObject::GObjects->ForEachObject([&ForEachSum](UObject* Object) -> void
+			{
+				ForEachSum += reinterpret_cast<uint64>(Object->Class);
+			});
+		}
+
+		const double ForEachTime = GetMicroseconds(Start);
+
+		std::vector<FCounter> Counters(0x40);
+
+		Start = Clock::now();
+
+		for (int32 i = 0; i < NumIterations; i++)
+		{
+			UObject::GObjects->ForEachObjectParallel([&Counters](UObject* Object) -> bool
+			{
+				Counters[(Object->Index >> 0x10) & 0x3F].Value.fetch_add(reinterpret_cast<uint64>(Object->Class), std::memory_order_relaxed);
+				return true;
+			});
+		}
+
+		const double ParallelTime = GetMicroseconds(Start);
+
+		for (const FCounter& Counter : Counters)
+			ParallelSum += Counter.Value.load(std::memory_order_relaxed);
+
+		const bool bResultsMatch = IndexSum == IteratorSum && IndexSum == ForEachSum && IndexSum == ParallelSum;
+
+		std::cout << "ObjectIteration::Benchmark(" << NumIterations << "):\n";
+		std::cout << "\tObjects:         " << UObject::GObjects->Num() << "\n";
+		std::cout << "\tGetByIndex:      " << (IndexTime / NumIterations) << "us per pass\n";
+		std::cout << "\tIterator:        " << (IteratorTime / NumIterations) << "us per pass\n";
+		std::cout << "\tForEachObject:   " << (ForEachTime / NumIterations) << "us per pass\n";
+		std::cout << "\tParallel:        " << (ParallelTime / NumIterations) << "us per pass\n";
+		std::cout << "\tResults match:   " << (bResultsMatch ? "true" : "false") << "\n" << std::endl;
+	}
+}
+
+)";
+	}
+
+	if constexpr (Settings::CppGenerator::bAddNameCache)
+	{
+		BasicCpp << R"(
+namespace NameCache
+{
+	/* FNamePool indices are (Block << 16 | Offset) with up to 0x2000 blocks, small chunks keep sparsely used blocks cheap */
+	constexpr int32 NumElementsPerChunk = 0x1000;
+	constexpr int32 MaxChunks = 0x20000;
+
+	struct FCachedName
+	{
+		int32 Length;
+		char String[1];
+	};
+
+	struct FNameChunk
+	{
+		std::atomic<const FCachedName*> Names[NumElementsPerChunk];
+	};
+
+	/* MaxChunks chunk-pointers (1MB), allocated on the first lookup and never freed */
+	static std::atomic<std::atomic<FNameChunk*>*> Chunks = nullptr;
+
+	static std::atomic<FNameChunk*>* GetChunks()
+	{
+		std::atomic<FNameChunk*>* ChunkTable = Chunks.load(std::memory_order_acquire);
+
+		if (!ChunkTable) [[unlikely]]
+		{
+			std::atomic<FNameChunk*>* NewChunkTable = new std::atomic<FNameChunk*>[MaxChunks]{};
+
+			if (Chunks.compare_exchange_strong(ChunkTable, NewChunkTable, std::memory_order_acq_rel))
+			{
+				ChunkTable = NewChunkTable;
+			}
+			else
+			{
+				delete[] NewChunkTable;
+			}
+		}
+
+		return ChunkTable;
+	}
+
+	static const FCachedName* CreateCachedName(const FName& Name)
+	{
+		FName PlainName = Name;)";
+
+		if (!Settings::Internal::bUseUoutlineNumberName)
+			BasicCpp << "\n\t\tPlainName.Number = 0x0;";
+
+		BasicCpp << R"(
+
+		char Buffer[FName::MaxStringLength];
+		const int32 Length = PlainName.GetRawString(Buffer, sizeof(Buffer));
+
+		/* One allocation for the length and the string */
+		uint8* Memory = new uint8[sizeof(FCachedName) + Length];
+
+		FCachedName* CachedName = reinterpret_cast<FCachedName*>(Memory);
+		CachedName->Length = Length;
+		memcpy(CachedName->String, Buffer, Length + 1);
+
+		return CachedName;
+	}
+
+	std::string_view Get(const FName& Name)
+	{
+		const int32 Index = Name.GetDisplayIndex();
+
+		const int32 ChunkIdx = Index / NumElementsPerChunk;
+		const int32 InChunkIdx = Index % NumElementsPerChunk;
+
+		if (Index < 0 || ChunkIdx >= MaxChunks) [[unlikely]]
+			return std::string_view();
+
+		std::atomic<FNameChunk*>* ChunkTable = GetChunks();
+
+		FNameChunk* Chunk = ChunkTable[ChunkIdx].load(std::memory_order_acquire);
+
+		if (!Chunk) [[unlikely]]
+		{
+			FNameChunk* NewChunk = new FNameChunk{};
+
+			if (ChunkTable[ChunkIdx].compare_exchange_strong(Chunk, NewChunk, std::memory_order_acq_rel))
+			{
+				Chunk = NewChunk;
+			}
+			else
+			{
+				delete NewChunk;
+			}
+		}
+
+		std::atomic<const FCachedName*>& Slot = Chunk->Names[InChunkIdx];
 
-class UObject* BasicFilesImpleUtils::GetObjectByIndex(int32 Index)
-{
-	return UObject::GObjects->GetByIndex(Index);
-}
+		const FCachedName* CachedName = Slot.load(std::memory_order_acquire);
 
-UFunction* BasicFilesImpleUtils::FindFunctionByFName(const FName* Name)
-{
-	for (int i = 0; i < UObject::GObjects->Num(); ++i)
-	{
-		UObject* Object = UObject::GObjects->GetByIndex(i);
+		if (!CachedName) [[unlikely]]
+		{
+			const FCachedName* NewName = CreateCachedName(Name);
 
-		if (!Object)
-			continue;
+			/* Names never change, a concurrent thread created the same string */
+			if (Slot.compare_exchange_strong(CachedName, NewName, std::memory_order_acq_rel))
+			{
+				CachedName = NewName;
+			}
+			else
+			{
+				delete[] reinterpret_cast<const uint8*>(NewName);
+			}
+		}
 
-		if (Object->Name == *Name)
-			return static_cast<UFunction*>(Object);
+		return std::string_view(CachedName->String, CachedName->Length);
 	}
-
-	return nullptr;
 }
 
 )";
+	}
 
 	/* Implementation of 'UObject::StaticClass()', templated to allow for a per-class local static class-pointer */
 	BasicHpp << R"(
 template<StringLiteral Name, bool bIsFullName = false>
 class UClass* StaticClassImpl()
 {
-	static class UClass* Clss = nullptr;
+	/* Atomic, StaticClass() may be called from multiple threads at once. Concurrent misses all find the same class. */
+	static std::atomic<class UClass*> Clss = nullptr;
 
-	if (Clss == nullptr)
+	class UClass* Result = Clss.load(std::memory_order_acquire);
+
+	if (Result == nullptr) [[unlikely]]
 	{
 		if constexpr (bIsFullName) {
-			Clss = BasicFilesImpleUtils::FindClassByFullName(Name);
+			Result = BasicFilesImpleUtils::FindClassByFullName(Name);
 		}
 		else /* default */ {
-			Clss = BasicFilesImpleUtils::FindClassByName(Name);
+			Result = BasicFilesImpleUtils::FindClassByName(Name);
 		}
+
+		Clss.store(Result, std::memory_order_release);
 	}
 
-	return Clss;
+	return Result;
 }
 )";
 
@@ -3185,43 +5665,46 @@ template<StringLiteral Name, bool bIsFullName = false, StringLiteral NonFullName
 class UClass* StaticBPGeneratedClassImpl()
 {
 	/* Could be external function, not really unique to this StaticClass functon */
-	static auto SetClassIndex = [](UClass* Class, int32& Index, uint64& ClassName) -> UClass*
+	static auto SetClassIndex = [](UClass* Class, std::atomic<int32>& Index, std::atomic<uint64>& ClassName) -> UClass*
 	{
 		if (Class)
 		{
-			Index = BasicFilesImpleUtils::GetObjectIndex(Class);
-			ClassName = BasicFilesImpleUtils::GetObjFNameAsUInt64(Class);
+			/* Name first, a reader that sees the new index also sees the new name */
+			ClassName.store(BasicFilesImpleUtils::GetObjFNameAsUInt64(Class), std::memory_order_relaxed);
+			Index.store(BasicFilesImpleUtils::GetObjectIndex(Class), std::memory_order_release);
 		}
 
 		return Class;
 	};
 
-	static int32 ClassIdx = 0x0;
-	static uint64 ClassName = 0x0;
+	static std::atomic<int32> ClassIdx = 0x0;
+	static std::atomic<uint64> ClassName = 0x0;
+
+	const int32 CachedIdx = ClassIdx.load(std::memory_order_acquire);
 
 	/* Use the full name to find an object */
 	if constexpr (bIsFullName)
 	{
-		if (ClassIdx == 0x0) [[unlikely]]
+		if (CachedIdx == 0x0) [[unlikely]]
 			return SetClassIndex(BasicFilesImpleUtils::FindClassByFullName(Name), ClassIdx, ClassName);
 
-		UClass* ClassObj = static_cast<UClass*>(BasicFilesImpleUtils::GetObjectByIndex(ClassIdx));
+		UClass* ClassObj = static_cast<UClass*>(BasicFilesImpleUtils::GetObjectByIndex(CachedIdx));
 
 		/* Could use cast flags too to save some string comparisons */
-		if (!ClassObj || BasicFilesImpleUtils::GetObjFNameAsUInt64(ClassObj) != ClassName)
+		if (!ClassObj || BasicFilesImpleUtils::GetObjFNameAsUInt64(ClassObj) != ClassName.load(std::memory_order_relaxed))
 			return SetClassIndex(BasicFilesImpleUtils::FindClassByFullName(Name), ClassIdx, ClassName);
 
 		return ClassObj;
 	}
 	else /* Default, use just the name to find an object*/
 	{
-		if (ClassIdx == 0x0) [[unlikely]]
+		if (CachedIdx == 0x0) [[unlikely]]
 			return SetClassIndex(BasicFilesImpleUtils::FindClassByName(Name), ClassIdx, ClassName);
 
-		UClass* ClassObj = static_cast<UClass*>(BasicFilesImpleUtils::GetObjectByIndex(ClassIdx));
+		UClass* ClassObj = static_cast<UClass*>(BasicFilesImpleUtils::GetObjectByIndex(CachedIdx));
 
 		/* Could use cast flags too to save some string comparisons */
-		if (!ClassObj || BasicFilesImpleUtils::GetObjFNameAsUInt64(ClassObj) != ClassName)
+		if (!ClassObj || BasicFilesImpleUtils::GetObjFNameAsUInt64(ClassObj) != ClassName.load(std::memory_order_relaxed))
 			return SetClassIndex(BasicFilesImpleUtils::FindClassByName(Name), ClassIdx, ClassName);
 
 		return ClassObj;
@@ -3272,6 +5755,9 @@ class TUObjectArray
 private:
 	static inline auto DecryptPtr = {};
 
+	/* Number of objects per thread-task in ForEachObjectParallel */
+	static constexpr int32 ObjectsPerPartition = 0x10000;
+
 public:
 	FUObjectItem* Objects;
 	int32 MaxElements;
@@ -3295,7 +5781,15 @@ public:
 
 		return GetDecrytedObjPtr()[Index].Object;
 	}}
-}};
+
+private:
+	/* Items from 'Index' to the end of the array, there are no chunks */
+	inline FUObjectItem* GetContiguousItems(const int32 Index, int32& OutNumItems) const
+	{{
+		OutNumItems = NumElements - Index;
+
+		return GetDecrytedObjPtr() + Index;
+	}}
 )", DecryptionStrToUse);
 	}
 	else
@@ -3328,6 +5822,9 @@ public:
 private:
 	static inline auto DecryptPtr = {};
 
+	/* Number of objects per thread-task in ForEachObjectParallel, one chunk */
+	static constexpr int32 ObjectsPerPartition = ElementsPerChunk;
+
 public:{}
 
 public:
@@ -3354,9 +5851,213 @@ public:
 
 		return ChunkPtr[InChunkIdx].Object;
 	}}
-}};
+
+private:
+	/* Items from 'Index' to the end of its chunk, nullptr if the chunk wasn't allocated. 'OutNumItems' is set either way, to skip the chunk. */
+	inline FUObjectItem* GetContiguousItems(const int32 Index, int32& OutNumItems) const
+	{{
+		const int32 ChunkIndex = Index / ElementsPerChunk;
+		const int32 InChunkIdx = Index % ElementsPerChunk;
+
+		OutNumItems = ElementsPerChunk - InChunkIdx;
+
+		if ((Index + OutNumItems) > NumElements)
+			OutNumItems = NumElements - Index;
+
+		if (ChunkIndex >= NumChunks)
+			return nullptr;
+
+		FUObjectItem* ChunkPtr = GetDecrytedObjPtr()[ChunkIndex];
+
+		return ChunkPtr ? ChunkPtr + InChunkIdx : nullptr;
+	}}
 )", Off::InSDK::ObjArray::ChunkSize, DecryptionStrToUse, Off::FUObjectArray::Ptr == 0 ? MemmberString : MemberStringWeirdLayout);
 	}
+
+	/* Iteration, the same for both layouts of GObjects */
+	BasicHpp << R"(
+private:
+	/* Objects are prefetched this many items ahead while iterating, the FUObjectItems are contiguous but the UObjects they point to are not */
+	static constexpr int32 PrefetchDistance = 0x10;
+
+	static inline void PrefetchObject(const class UObject* Object)
+	{
+#if defined(_M_X64) || defined(__SSE__)
+		_mm_prefetch(reinterpret_cast<const char*>(Object), _MM_HINT_T0);
+#endif
+	}
+
+public:
+	/* Compares equal to an iterator once it reached the current end of GObjects, objects added while iterating are visited too */
+	struct FObjectSentinel
+	{
+	};
+
+	/* Visits all objects that aren't nullptr, chunk by chunk. GObjects is decrypted once per chunk instead of once per object. */
+	class FObjectIterator
+	{
+	public:
+		using value_type = class UObject*;
+		using difference_type = std::ptrdiff_t;
+		using iterator_concept = std::input_iterator_tag;
+
+	private:
+		const TUObjectArray* Array;
+
+		/* Item at 'Index', valid up to 'ChunkEnd' */
+		FUObjectItem* Item = nullptr;
+
+		int32 Index;
+		int32 ChunkEnd;
+
+	public:
+		inline FObjectIterator(const TUObjectArray* ObjectArray, int32 FirstIndex)
+			: Array(ObjectArray), Index(FirstIndex), ChunkEnd(FirstIndex)
+		{
+			SkipNullObjects();
+		}
+
+	private:
+		inline void SkipNullObjects()
+		{
+			while (Index < Array->NumElements)
+			{
+				if (Index >= ChunkEnd)
+				{
+					int32 NumItems = 0x0;
+					Item = Array->GetContiguousItems(Index, NumItems);
+					ChunkEnd = Index + NumItems;
+
+					if (!Item)
+					{
+						Index = ChunkEnd;
+						continue;
+					}
+				}
+
+				if ((Index + PrefetchDistance) < ChunkEnd)
+					PrefetchObject(Item[PrefetchDistance].Object);
+
+				if (Item->Object)
+					return;
+
+				Index++;
+				Item++;
+			}
+		}
+
+	public:
+		inline class UObject* operator*() const
+		{
+			return Item->Object;
+		}
+
+		inline FObjectIterator& operator++()
+		{
+			Index++;
+			Item++;
+
+			SkipNullObjects();
+
+			return *this;
+		}
+
+		inline void operator++(int)
+		{
+			++(*this);
+		}
+
+		inline int32 GetIndex() const
+		{
+			return Index;
+		}
+
+		inline bool operator==(const FObjectIterator& Other) const
+		{
+			return Index == Other.Index;
+		}
+
+		inline bool operator==(FObjectSentinel) const
+		{
+			return Index >= Array->NumElements;
+		}
+	};
+
+public:
+	/* 'for (UObject* Object : *UObject::GObjects.GetTypedPtr())', null objects are skipped */
+	inline FObjectIterator begin() const
+	{
+		return FObjectIterator(this, 0x0);
+	}
+
+	inline FObjectSentinel end() const
+	{
+		return FObjectSentinel();
+	}
+
+	/*
+	* Calls 'Callback' for every object that isn't nullptr, with an index in [FirstIndex, EndIndex). Walks GObjects chunk by chunk.
+	*
+	* The callback takes a 'UObject*' and returns either void, or a bool that is false to stop the iteration. Returns false if the iteration was stopped.
+	*/
+	template<typename CallbackType>
+	inline bool ForEachObjectInRange(int32 FirstIndex, int32 EndIndex, CallbackType&& Callback) const
+	{
+		if (EndIndex > NumElements)
+			EndIndex = NumElements;
+
+		for (int32 Index = FirstIndex > 0 ? FirstIndex : 0x0; Index < EndIndex;)
+		{
+			int32 NumItems = 0x0;
+			FUObjectItem* Items = GetContiguousItems(Index, NumItems);
+
+			if (NumItems > (EndIndex - Index))
+				NumItems = EndIndex - Index;
+
+			for (int32 i = 0; Items && i < NumItems; i++)
+			{
+				if ((i + PrefetchDistance) < NumItems)
+					PrefetchObject(Items[i + PrefetchDistance].Object);
+
+				class UObject* Object = Items[i].Object;
+
+				if (!Object)
+					continue;
+
+				if constexpr (std::is_void_v<std::invoke_result_t<CallbackType&, class UObject*>>)
+				{
+					Callback(Object);
+				}
+				else
+				{
+					if (!Callback(Object))
+						return false;
+				}
+			}
+
+			Index += NumItems;
+		}
+
+		return true;
+	}
+
+	/* ForEachObjectInRange over all of GObjects */
+	template<typename CallbackType>
+	inline bool ForEachObject(CallbackType&& Callback) const
+	{
+		return ForEachObjectInRange(0x0, NumElements, std::forward<CallbackType>(Callback));
+	}
+
+	/*
+	* Like ForEachObject, but GObjects is split into chunks that are iterated by 'NumThreads' threads (0 for one per hardware-thread).
+	*
+	* 'Callback' is called concurrently and has to be thread-safe. Returning false stops all threads, the order in which objects are visited is undefined.
+	*/
+	bool ForEachObjectParallel(const std::function<bool(class UObject*)>& Callback, int32 NumThreads = 0x0) const;
+};
+
+static_assert(std::input_iterator<TUObjectArray::FObjectIterator> && std::sentinel_for<TUObjectArray::FObjectSentinel, TUObjectArray::FObjectIterator>, "TUObjectArray::FObjectIterator is not an input-iterator!");
+)";
 	// End class 'TUObjectArray'
 
 
@@ -3421,6 +6122,17 @@ public:)";
 
 		return reinterpret_cast<class TUObjectArray*>(GObjectsAddress);
 	}
+
+	/* 'for (UObject* Object : UObject::GObjects)' */
+	inline TUObjectArray::FObjectIterator begin()
+	{
+		return GetTypedPtr()->begin();
+	}
+
+	inline TUObjectArray::FObjectSentinel end()
+	{
+		return GetTypedPtr()->end();
+	}
 };
 )";
 	// End class 'TUObjectArrayWrapper'
@@ -3446,7 +6158,65 @@ public:)";
 		},
 	};
 
-	
+
+	/* String-accessors of FNameEntry, the same for FNamePool and TNameEntryArray. They only need 'IsWide()' and 'GetLength()'. */
+	const std::vector<PredefinedFunction> NameEntryStringFunctions =
+	{
+		PredefinedFunction {
+			.CustomComment = "",
+			.ReturnType = "std::string", .NameWithParams = "GetString()", .Body =
+R"({
+	if (IsWide())
+	{
+		const int32 Length = GetLength();
+
+		std::string OutputString(static_cast<size_t>(Length) * 3 + 1, '\0');
+		OutputString.resize(ContainerImpl::HelperFunctions::WideToUtf8(Name.WideName, Length, OutputString.data(), static_cast<int32>(OutputString.size())));
+
+		return OutputString;
+	}
+
+	return std::string(Name.AnsiName, GetLength());
+})",
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+		},
+		PredefinedFunction {
+			.CustomComment = "Writes the name as null-terminated UTF-8 into Buffer and returns its length. Doesn't allocate.",
+			.ReturnType = "int32", .NameWithParams = "GetString(char* Buffer, int32 BufferSize)", .Body =
+R"({
+	if (IsWide())
+		return ContainerImpl::HelperFunctions::WideToUtf8(Name.WideName, GetLength(), Buffer, BufferSize);
+
+	if (BufferSize <= 0)
+		return 0;
+
+	const int32 Length = GetLength() < BufferSize ? GetLength() : BufferSize - 1;
+
+	memcpy(Buffer, Name.AnsiName, Length);
+	Buffer[Length] = '\0';
+
+	return Length;
+})",
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+		},
+		PredefinedFunction {
+			.CustomComment = "View into the name-table, empty if the name is wide. Non-wide names are pure ASCII.",
+			.ReturnType = "std::string_view", .NameWithParams = "GetAnsiView()", .Body =
+R"({
+	return IsWide() ? std::string_view() : std::string_view(Name.AnsiName, GetLength());
+})",
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+		},
+		PredefinedFunction {
+			.CustomComment = "View into the name-table, empty if the name isn't wide",
+			.ReturnType = "std::wstring_view", .NameWithParams = "GetWideView()", .Body =
+R"({
+	return IsWide() ? std::wstring_view(Name.WideName, GetLength()) : std::wstring_view();
+})",
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+		},
+	};
+
 	if (Off::InSDK::Name::AppendNameToString == 0x0 && !Settings::Internal::bUseNamePool)
 	{
 		/* struct FNameEntry */
@@ -3487,20 +6257,16 @@ R"({
 			},
 			PredefinedFunction {
 				.CustomComment = "",
-				.ReturnType = "std::string", .NameWithParams = "GetString()", .Body =
+				.ReturnType = "int32", .NameWithParams = "GetLength()", .Body =
 R"({
-	if (IsWide())
-	{
-		std::wstring WideString(Name.WideName);
-		return std::string(WideString.begin(), WideString.end());
-	}
-
-	return Name.AnsiName;
+	return static_cast<int32>(IsWide() ? wcslen(Name.WideName) : strlen(Name.AnsiName));
 })",
 				.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
 			},
 		};
 
+		FNameEntry.Functions.insert(FNameEntry.Functions.end(), NameEntryStringFunctions.begin(), NameEntryStringFunctions.end());
+
 		const int32 ChunkTableSize = Off::NameArray::NumElements / 0x8;
 		const int32 ChunkTableSizeBytes = ChunkTableSize * 0x8;
 
@@ -3684,20 +6450,16 @@ R"({
 			},
 			PredefinedFunction {
 				.CustomComment = "",
-				.ReturnType = "std::string", .NameWithParams = "GetString()", .Body =
+				.ReturnType = "int32", .NameWithParams = "GetLength()", .Body =
 R"({
-	if (IsWide())
-	{
-		std::wstring WideString(Name.WideName, Header.Len);
-		return std::string(WideString.begin(), WideString.end());
-	}
-
-	return std::string(Name.AnsiName, Header.Len);
+	return Header.Len;
 })",
 				.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
 			},
 		};
 
+		FNameEntry.Functions.insert(FNameEntry.Functions.end(), NameEntryStringFunctions.begin(), NameEntryStringFunctions.end());
+
 		constexpr int32 SizeOfChunkPtrs = 0x2000 * 0x8;
 
 		/* class FNamePool */
@@ -3861,9 +6623,67 @@ R"({
 		);
 	}
 
+	FName.Properties.push_back(PredefinedMember{
+		.Comment = "Size of a buffer that fits every name as UTF-8: 1024 wide characters, a number-suffix and the null-terminator",
+		.Type = "constexpr int32", .Name = "MaxStringLength", .Offset = 0x0, .Size = 0x04, .ArrayDim = 0x1, .Alignment = 0x4,
+		.bIsStatic = true, .bIsZeroSizeMember = false, .bIsBitField = false, .BitIndex = 0xFF, .DefaultValue = "0xC10"
+		}
+	);
+
 	SortMembers(FName.Properties);
 
-	constexpr const char* GetRawStringWithAppendString =
+	constexpr const char* GetRawStringWithAppendString =
+		R"({
+	thread_local FAllocatedString TempString(1024);
+
+	if (!AppendString)
+		InitInternal();
+
+	InSDKUtils::CallGameFunction(reinterpret_cast<void(*)(const FName*, FString&)>(AppendString), this, TempString);
+
+	std::string OutputString = TempString.ToString();
+	TempString.Clear();
+
+	return OutputString;
+}
+)";
+
+	constexpr const char* GetRawStringWithNameArray =
+		R"({
+	if (!GNames)
+		InitInternal();
+
+	std::string RetStr = FName::GNames->GetEntryByIndex(GetDisplayIndex())->GetString();
+
+	if (Number > 0)
+		RetStr += ("_" + std::to_string(Number - 1));
+
+	return RetStr;
+}
+)";
+
+	constexpr const char* GetRawStringWithNameArrayWithOutlineNumber =
+		R"({
+	if (!GNames)
+		InitInternal();
+
+	const FNameEntry* Entry = FName::GNames->GetEntryByIndex(GetDisplayIndex());
+
+	if (Entry->Header.Length == 0)
+	{{
+		if (Entry->Number > 0)
+			return FName::GNames->GetEntryByIndex(Entry->NumberedName.Id)->GetString() + "_" + std::to_string(Entry->Number - 1);
+
+		return FName::GNames->GetEntryByIndex(Entry->NumberedName.Id)->GetString();
+	}}
+
+	return Entry.GetString();
+}
+)";
+
+	std::string GetRawStringBody = Off::InSDK::Name::AppendNameToString == 0 ? Settings::Internal::bUseUoutlineNumberName ? GetRawStringWithNameArrayWithOutlineNumber : GetRawStringWithNameArray : GetRawStringWithAppendString;
+
+	constexpr const char* GetRawStringToBufferWithAppendString =
 		R"({
 	thread_local FAllocatedString TempString(1024);
 
@@ -3872,47 +6692,54 @@ R"({
 
 	InSDKUtils::CallGameFunction(reinterpret_cast<void(*)(const FName*, FString&)>(AppendString), this, TempString);
 
-	std::string OutputString = TempString.ToString();
+	const int32 Length = TempString.ToString(Buffer, BufferSize);
 	TempString.Clear();
 
-	return OutputString;
+	return Length;
 }
 )";
 
-	constexpr const char* GetRawStringWithNameArray =
+	constexpr const char* GetRawStringToBufferWithNameArray =
 		R"({
 	if (!GNames)
 		InitInternal();
 
-	std::string RetStr = FName::GNames->GetEntryByIndex(GetDisplayIndex())->GetString();
+	int32 Length = FName::GNames->GetEntryByIndex(GetDisplayIndex())->GetString(Buffer, BufferSize);
 
-	if (Number > 0)
-		RetStr += ("_" + std::to_string(Number - 1));
+	/* With 4 bytes left the string wasn't truncated, a character is at most 4 bytes of UTF-8 */
+	if (Number > 0 && (BufferSize - 1 - Length) >= 4)
+	{
+		Buffer[Length] = '_';
 
-	return RetStr;
+		const auto [End, Error] = std::to_chars(Buffer + Length + 1, Buffer + (BufferSize - 1), Number - 1);
+
+		if (Error == std::errc())
+			Length = static_cast<int32>(End - Buffer);
+
+		Buffer[Length] = '\0';
+	}
+
+	return Length;
 }
 )";
 
-	constexpr const char* GetRawStringWithNameArrayWithOutlineNumber =
+	/* Numbered entries of outline-number names aren't resolved in place, the string is copied */
+	constexpr const char* GetRawStringToBufferWithOutlineNumber =
 		R"({
-	if (!GNames)
-		InitInternal();
-
-	const FNameEntry* Entry = FName::GNames->GetEntryByIndex(GetDisplayIndex());
+	if (BufferSize <= 0)
+		return 0;
 
-	if (Entry->Header.Length == 0)
-	{{
-		if (Entry->Number > 0)
-			return FName::GNames->GetEntryByIndex(Entry->NumberedName.Id)->GetString() + "_" + std::to_string(Entry->Number - 1);
+	const std::string RawString = GetRawString();
+	const int32 Length = static_cast<int32>(RawString.size()) < BufferSize ? static_cast<int32>(RawString.size()) : BufferSize - 1;
 
-		return FName::GNames->GetEntryByIndex(Entry->NumberedName.Id)->GetString();
-	}}
+	memcpy(Buffer, RawString.data(), Length);
+	Buffer[Length] = '\0';
 
-	return Entry.GetString();
+	return Length;
 }
 )";
 
-	std::string GetRawStringBody = Off::InSDK::Name::AppendNameToString == 0 ? Settings::Internal::bUseUoutlineNumberName ? GetRawStringWithNameArrayWithOutlineNumber : GetRawStringWithNameArray : GetRawStringWithAppendString;
+	std::string GetRawStringToBufferBody = Off::InSDK::Name::AppendNameToString == 0 ? Settings::Internal::bUseUoutlineNumberName ? GetRawStringToBufferWithOutlineNumber : GetRawStringToBufferWithNameArray : GetRawStringToBufferWithAppendString;
 
 	FName.Functions =
 	{
@@ -3938,6 +6765,11 @@ std::format(R"({{
 			.ReturnType = "std::string", .NameWithParams = "GetRawString()", .Body = GetRawStringBody,
 			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
 		},
+		PredefinedFunction {
+			.CustomComment = "Writes the name, including its number, as null-terminated UTF-8 into Buffer and returns its length. Use a buffer of 'MaxStringLength' to never truncate.",
+			.ReturnType = "int32", .NameWithParams = "GetRawString(char* Buffer, int32 BufferSize)", .Body = GetRawStringToBufferBody,
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+		},
 		PredefinedFunction {
 			.CustomComment = "",
 			.ReturnType = "std::string", .NameWithParams = "ToString()", .Body = R"({
@@ -3945,10 +6777,45 @@ std::format(R"({{
 
 	size_t pos = OutputString.rfind('/');
 
-	if (pos == std::string::npos)
-		return OutputString;
+	if (pos != std::string::npos)
+		OutputString.erase(0, pos + 1);
+
+	return OutputString;
+}
+)",
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+		},
+		PredefinedFunction {
+			.CustomComment = "Same as ToString(), written into Buffer. Doesn't allocate.",
+			.ReturnType = "int32", .NameWithParams = "ToString(char* Buffer, int32 BufferSize)", .Body = R"({
+	if (BufferSize <= 0)
+		return 0;
+
+	/* The last '/' has to be searched in the complete name, Buffer might be too small for it */
+	char RawBuffer[MaxStringLength];
+	char* RawString = BufferSize >= MaxStringLength ? Buffer : RawBuffer;
+
+	const int32 RawLength = GetRawString(RawString, MaxStringLength);
 
-	return OutputString.substr(pos + 1);
+	int32 Start = RawLength;
+	while (Start > 0 && RawString[Start - 1] != '/')
+		Start--;
+
+	int32 Length = RawLength - Start;
+
+	if (Length >= BufferSize)
+	{
+		Length = BufferSize - 1;
+
+		/* Don't split a UTF-8 character */
+		while (Length > 0 && (static_cast<uint8>(RawString[Start + Length]) & 0xC0) == 0x80)
+			Length--;
+	}
+
+	memmove(Buffer, RawString + Start, Length);
+	Buffer[Length] = '\0';
+
+	return Length;
 }
 )",
 			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
@@ -3971,6 +6838,33 @@ std::format(R"({{
 		},
 	};
 
+	if (Off::InSDK::Name::AppendNameToString == 0 && !Settings::Internal::bUseUoutlineNumberName)
+	{
+		FName.Functions.push_back(PredefinedFunction{
+			.CustomComment = "View into GNames of the name without its number. Empty if the name is wide, use GetRawString(Buffer, BufferSize) for those.",
+			.ReturnType = "std::string_view", .NameWithParams = "GetAnsiView()", .Body = R"({
+	if (!GNames)
+		InitInternal();
+
+	return FName::GNames->GetEntryByIndex(GetDisplayIndex())->GetAnsiView();
+}
+)",
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+		});
+	}
+
+	if constexpr (Settings::CppGenerator::bAddNameCache)
+	{
+		FName.Functions.push_back(PredefinedFunction{
+			.CustomComment = "The name without its number as UTF-8, converted once per name and cached. The view stays valid for the lifetime of the process.",
+			.ReturnType = "std::string_view", .NameWithParams = "GetCachedString()", .Body = R"({
+	return NameCache::Get(*this);
+}
+)",
+			.bIsStatic = false, .bIsConst = true, .bIsBodyInline = true
+		});
+	}
+
 	if constexpr (Settings::CppGenerator::bAddManualOverrideOptions)
 	{
 		FName.Functions.insert(
@@ -3985,8 +6879,30 @@ std::format(R"({{
 			});
 	}
 
+	if constexpr (Settings::CppGenerator::bAddNameCache)
+	{
+		BasicHpp << R"(
+/* Strings of FNames, converted to UTF-8 once per name-entry and never freed */
+namespace NameCache
+{
+	/* Keyed by the display-index, which is the comparison-index unless the game uses case-preserving names. The name's number isn't part of the string. */
+	std::string_view Get(const class FName& Name);
+}
+)";
+	}
+
 	GenerateStruct(&FName, BasicHpp, BasicCpp, BasicHpp);
 
+	/* Hash of FName used by the engine's TSet/TMap, found through ADL by the hashed lookups in UnrealContainers.hpp. The using-declaration keeps UC's overloads visible inside of the SDK namespace. */
+	BasicHpp << std::format(R"(
+using UC::GetTypeHash;
+
+inline uint32 GetTypeHash(const FName& Name)
+{{
+	return static_cast<uint32>(Name.ComparisonIndex){};
+}}
+)", !Settings::Internal::bUseUoutlineNumberName ? " + static_cast<uint32>(Name.Number)" : "");
+
 
 	BasicHpp <<
 		R"(
@@ -4918,6 +7834,183 @@ UE_ENUM_OPERATORS(EClassCastFlags);
 UE_ENUM_OPERATORS(EPropertyFlags);
 )";
 
+	if constexpr (Settings::CppGenerator::bAddObjectNameIndex)
+	{
+		BasicHpp << R"(
+/*
+* Index of GObjects by FName::ComparisonIndex, used by UObject::FindObject and UObject::FindObjectFast.
+*
+* Built on the first lookup. Objects appended to GObjects are indexed on the next lookup, entries are verified on every hit
+* and removed once their slot holds a different object. Names that aren't in the index fall back to a linear search, names
+* the linear search doesn't find either aren't searched again until the number of objects in GObjects changes.
+*/
+namespace ObjectNameIndex
+{
+	class UObject* FindObject(const std::string& Name, EClassCastFlags RequiredType, bool bIsFullName);
+
+	/* Linear search through GObjects, what FindObject did before the index existed */
+	class UObject* FindObjectLinear(const std::string& Name, EClassCastFlags RequiredType, bool bIsFullName);
+
+	/* Drops the index, it's rebuilt on the next lookup */
+	void Invalidate();
+
+}
+)";
+
+		if constexpr (Settings::CppGenerator::bAddObjectNameIndexBenchmark)
+		{
+			BasicHpp << R"(
+namespace ObjectNameIndex
+{
+	/* Compares 'NumIterations' lookups of 'Name' with and without the index, results are written to std::cout */
+	void Benchmark(const std::string& Name, int32 NumIterations = 1000, bool bIsFullName = false);
+}
+)";
+		}
+	}
+
+	if constexpr (Settings::CppGenerator::bAddClassBaseChains)
+	{
+		BasicHpp << R"(
+/*
+* Constant-time inheritance checks, like 'UStruct::StructBaseChain' in newer engine versions.
+*
+* Every UStruct gets an array of its ancestors, created on its first check and cached by object-index. A struct is a subclass
+* of 'Base' if its chain is at least as deep as Base's and contains Base at Base's depth. UObject::IsA<T>() uses T's own
+* cast-flag where it has one, and T::ClassDepth (emitted by the generator) otherwise.
+*/
+namespace ClassBaseChain
+{
+	struct FBaseChain
+	{
+		/* Number of supers, UObject has a depth of 0 */
+		int32 Depth;
+
+		/* 'Ancestors[0]' is the root, 'Ancestors[Depth]' is the struct itself */
+		const class UStruct* const* Ancestors;
+	};
+
+	const FBaseChain* Get(const class UStruct* Struct);
+
+	bool IsSubclassOf(const class UStruct* Struct, const class UStruct* Base);
+
+	/* Walks the Super-chain, what UStruct::IsSubclassOf did before */
+	bool IsSubclassOfLinear(const class UStruct* Struct, const class UStruct* Base);
+
+	/* Implementation of UObject::IsA<T>(), 'ObjectType' is always UObject. It's a template parameter so UClass doesn't need to be complete here. */
+	template<typename ClassType, typename ObjectType>
+	inline bool IsA(const ObjectType* Object)
+	{
+		if constexpr (std::is_same_v<ClassType, class UObject>)
+		{
+			return true;
+		}
+		else if constexpr (ClassType::ClassCastFlag != EClassCastFlags::None)
+		{
+			return Object->Class->CastFlags & ClassType::ClassCastFlag;
+		}
+		else
+		{
+			const FBaseChain* Chain = Get(Object->Class);
+
+			return Chain->Depth >= ClassType::ClassDepth && Chain->Ancestors[ClassType::ClassDepth] == ClassType::StaticClass();
+		}
+	}
+}
+)";
+
+		if constexpr (Settings::CppGenerator::bAddClassBaseChainBenchmark)
+		{
+			BasicHpp << R"(
+namespace ClassBaseChain
+{
+	/* Checks the class of every object in GObjects against 'TypeClass' with IsSubclassOf and IsSubclassOfLinear, results are written to std::cout */
+	void Benchmark(const class UClass* TypeClass, int32 NumIterations = 10);
+}
+)";
+		}
+	}
+
+	if constexpr (Settings::CppGenerator::bCallNativeFunctionsDirectly)
+	{
+		/* UE5.1 added 'MostRecentPropertyContainer', UE5.0 is assumed to have it too */
+		const bool bHasMostRecentPropertyContainer = Settings::Internal::bUseLargeWorldCoordinates;
+
+		BasicHpp << std::format(R"(
+/*
+* Calls native UFunctions through their ExecFunction, instead of ProcessEvent.
+*
+* With 'Code' being nullptr, the native thunk reads its parameters from 'Locals' by following 'PropertyChainForCompiledIn', just like
+* it does when it's called by ProcessEvent. Out-parameters and non-const references are looked up in the 'OutParms' list, which Invoke
+* builds the same way ProcessEvent does. The return value is written to 'ReturnValue'.
+*/
+namespace NativeCall
+{{
+	/* Functions with more out-parameters (including the return value) are called through ProcessEvent by the SDK */
+	constexpr int32 MaxOutParms = 0x{:X};
+
+	struct FOutParmRec
+	{{
+		void* Property;
+		uint8* PropAddr;
+		FOutParmRec* NextOutParm;
+	}};
+
+	/* Minimal FFrame, only the members up to 'CurrentNativeFunction' are used. Newer engine versions append more members, so there's spare space at the end. */
+	struct FNativeCallFrame
+	{{
+		void* VTable;                            // FOutputDevice
+		bool bSuppressEventTag;
+		bool bAutoEmitLineTerminator;
+		uint8 Pad_A[0x6];
+		class UFunction* Node;
+		class UObject* Object;
+		uint8* Code;
+		uint8* Locals;
+		void* MostRecentProperty;
+		uint8* MostRecentPropertyAddress;{}
+		uint8 FlowStack[0x30];                   // TArray<uint32, TInlineAllocator<8>>
+		FNativeCallFrame* PreviousFrame;
+		FOutParmRec* OutParms;
+		void* PropertyChainForCompiledIn;
+		class UFunction* CurrentNativeFunction;
+		uint8 Pad_B[0x40];
+	}};
+
+	/* 'Parms' is the functions' parameter struct, or nullptr. 'ReturnValue' points into 'Parms', or is nullptr. */
+	void Invoke(const class UObject* Object, class UFunction* Function, void* Parms, void* ReturnValue);
+
+	/* Compares the latency of 'NumIterations' calls through ProcessEvent and through Invoke, results are written to std::cout. Calls the function, use one without side-effects. */
+	void Benchmark(const class UObject* Object, class UFunction* Function, void* Parms, void* ReturnValue, int32 NumIterations = 100000);
+
+	/* Calls 'KismetMathLibrary::FMod', which has an out-parameter, through ProcessEvent and through Invoke and compares the results. Returns false if they differ. */
+	bool SelfTest();
+}}
+)", NativeCallMaxOutParms, bHasMostRecentPropertyContainer ? "\n\t\tuint8* MostRecentPropertyContainer;" : "");
+	}
+
+	if constexpr (Settings::CppGenerator::bAddObjectIterationBenchmark)
+	{
+		BasicHpp << R"(
+namespace ObjectIteration
+{
+	/* Times 'NumIterations' passes over GObjects with GetByIndex, the iterator, ForEachObject and ForEachObjectParallel, results are written to std::cout */
+	void Benchmark(int32 NumIterations = 0x10);
+}
+)";
+	}
+
+	if constexpr (Settings::CppGenerator::bAddContainerLookupBenchmark)
+	{
+		BasicHpp << R"(
+/* Times the hashed lookups of TSet/TMap on a synthetic container, no game-memory is read */
+namespace ContainerLookup
+{
+	/* Compares the linear TMap::Find(Key, Equals) with the hashed TMap::Find(Key) on a map of 'NumElements' elements, results are written to std::cout */
+	void Benchmark(int32 NumElements = 0x1000, int32 NumIterations = 0x10000);
+}
+)";
+	}
 
 
 	/* Write Predefined Structs into Basic.hpp */
@@ -5000,7 +8093,7 @@ using TActorBasedCycleFixup = CyclicDependencyFixupImpl::TCyclicClassFixup<Under
 void CppGenerator::GenerateUnrealContainers(StreamType& UEContainersHeader)
 {
 	WriteFileHead(UEContainersHeader, nullptr, EFileType::UnrealContainers, 
-		"Container implementations with iterators. See https://github.com/Fischsalat/UnrealContainers", "#include <string>\n#include <stdexcept>");
+		"Container implementations with iterators. See https://github.com/Fischsalat/UnrealContainers", "#include <string>\n#include <string_view>\n#include <stdexcept>\n#include <type_traits>\n\n#if defined(_M_X64) || defined(__SSE2__)\n#include <emmintrin.h>\n#endif");
 
 
 	UEContainersHeader << R"(
@@ -5074,6 +8167,112 @@ namespace UC
 
 				return 31 - FloorLog2(Value);
 			}
+
+			/*
+			* Converts UTF-16 to UTF-8, without allocating. Runs of ASCII characters are converted 16 at a time with SSE2.
+			* 
+			* Writes at most BufferSize - 1 bytes, never splits a character, null-terminates the output and returns its length.
+			* Unpaired surrogates are replaced with U+FFFD.
+			*/
+			template<typename WideCharType>
+			inline int32 WideToUtf8(const WideCharType* Wide, int32 WideLength, char* Buffer, int32 BufferSize)
+			{
+				if (BufferSize <= 0)
+					return 0;
+
+				const int32 MaxLength = BufferSize - 1;
+
+				int32 ReadIdx = 0;
+				int32 WriteIdx = 0;
+
+				while (ReadIdx < WideLength)
+				{
+#if defined(_M_X64) || defined(__SSE2__)
+					if constexpr (sizeof(WideCharType) == 0x2)
+					{
+						const __m128i NonAsciiMask = _mm_set1_epi16(static_cast<short>(0xFF80));
+
+						while (ReadIdx + 16 <= WideLength && WriteIdx + 16 <= MaxLength)
+						{
+							const __m128i Low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Wide + ReadIdx));
+							const __m128i High = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Wide + ReadIdx + 8));
+
+							const __m128i NonAsciiBits = _mm_and_si128(_mm_or_si128(Low, High), NonAsciiMask);
+
+							if (_mm_movemask_epi8(_mm_cmpeq_epi16(NonAsciiBits, _mm_setzero_si128())) != 0xFFFF)
+								break;
+
+							_mm_storeu_si128(reinterpret_cast<__m128i*>(Buffer + WriteIdx), _mm_packus_epi16(Low, High));
+
+							ReadIdx += 16;
+							WriteIdx += 16;
+						}
+					}
+#endif
+					while (ReadIdx < WideLength && WriteIdx < MaxLength && static_cast<uint32>(Wide[ReadIdx]) < 0x80)
+						Buffer[WriteIdx++] = static_cast<char>(Wide[ReadIdx++]);
+
+					if (ReadIdx >= WideLength || WriteIdx >= MaxLength)
+						break;
+
+					uint32 CodePoint = static_cast<uint32>(Wide[ReadIdx]);
+					int32 NumWideChars = 1;
+
+					if constexpr (sizeof(WideCharType) == 0x2)
+					{
+						CodePoint &= 0xFFFF;
+
+						if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF && (ReadIdx + 1) < WideLength)
+						{
+							const uint32 LowSurrogate = static_cast<uint32>(Wide[ReadIdx + 1]) & 0xFFFF;
+
+							if (LowSurrogate >= 0xDC00 && LowSurrogate <= 0xDFFF)
+							{
+								CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (LowSurrogate - 0xDC00);
+								NumWideChars = 2;
+							}
+						}
+					}
+
+					if ((CodePoint >= 0xD800 && CodePoint <= 0xDFFF) || CodePoint > 0x10FFFF)
+						CodePoint = 0xFFFD;
+
+					const int32 NumBytes = CodePoint < 0x80 ? 1 : CodePoint < 0x800 ? 2 : CodePoint < 0x10000 ? 3 : 4;
+
+					if (WriteIdx + NumBytes > MaxLength)
+						break;
+
+					if (NumBytes == 1)
+					{
+						Buffer[WriteIdx] = static_cast<char>(CodePoint);
+					}
+					else if (NumBytes == 2)
+					{
+						Buffer[WriteIdx + 0] = static_cast<char>(0xC0 | (CodePoint >> 6));
+						Buffer[WriteIdx + 1] = static_cast<char>(0x80 | (CodePoint & 0x3F));
+					}
+					else if (NumBytes == 3)
+					{
+						Buffer[WriteIdx + 0] = static_cast<char>(0xE0 | (CodePoint >> 12));
+						Buffer[WriteIdx + 1] = static_cast<char>(0x80 | ((CodePoint >> 6) & 0x3F));
+						Buffer[WriteIdx + 2] = static_cast<char>(0x80 | (CodePoint & 0x3F));
+					}
+					else
+					{
+						Buffer[WriteIdx + 0] = static_cast<char>(0xF0 | (CodePoint >> 18));
+						Buffer[WriteIdx + 1] = static_cast<char>(0x80 | ((CodePoint >> 12) & 0x3F));
+						Buffer[WriteIdx + 2] = static_cast<char>(0x80 | ((CodePoint >> 6) & 0x3F));
+						Buffer[WriteIdx + 3] = static_cast<char>(0x80 | (CodePoint & 0x3F));
+					}
+
+					ReadIdx += NumWideChars;
+					WriteIdx += NumBytes;
+				}
+
+				Buffer[WriteIdx] = '\0';
+
+				return WriteIdx;
+			}
 		}
 
 		template<int32 Size, uint32 Alignment>
@@ -5186,7 +8385,7 @@ namespace UC
 		{
 		private:
 			template<typename SetDataType>
-			friend class TSet;
+			friend class UC::TSet;
 
 		private:
 			SetType Value;
@@ -5196,6 +8395,53 @@ namespace UC
 	}
 
 
+	/*
+	* Hash functions matching the engine's GetTypeHash overloads, used by the hashed lookups of TSet and TMap.
+	*
+	* Further key types are supported by declaring 'uint32 GetTypeHash(const KeyType&)' in the namespace of the key type (see 'GetTypeHash(const FName&)' in Basic.hpp).
+	* If a game hashes a type differently, use 'FindIndexByHash' with the hash the game uses.
+	*/
+	inline uint32 GetTypeHash(const uint8  Value) { return Value; }
+	inline uint32 GetTypeHash(const int8   Value) { return Value; }
+	inline uint32 GetTypeHash(const uint16 Value) { return Value; }
+	inline uint32 GetTypeHash(const int16  Value) { return Value; }
+	inline uint32 GetTypeHash(const uint32 Value) { return Value; }
+	inline uint32 GetTypeHash(const int32  Value) { return Value; }
+	inline uint32 GetTypeHash(const uint64 Value) { return static_cast<uint32>(Value) + (static_cast<uint32>(Value >> 32) * 23); }
+	inline uint32 GetTypeHash(const int64  Value) { return static_cast<uint32>(Value) + (static_cast<uint32>(Value >> 32) * 23); }
+
+	template<typename EnumType, typename = std::enable_if_t<std::is_enum_v<EnumType>>>
+	inline uint32 GetTypeHash(const EnumType Value) { return GetTypeHash(static_cast<std::underlying_type_t<EnumType>>(Value)); }
+
+	/* Bob Jenkins' 96-bit mix, as used by the engine */
+	inline uint32 HashCombine(uint32 A, uint32 C)
+	{
+		uint32 B = 0x9e3779b9;
+		A += B;
+
+		A -= B; A -= C; A ^= (C >> 13);
+		B -= C; B -= A; B ^= (A << 8);
+		C -= A; C -= B; C ^= (B >> 13);
+		A -= B; A -= C; A ^= (C >> 12);
+		B -= C; B -= A; B ^= (A << 16);
+		C -= A; C -= B; C ^= (B >> 5);
+		A -= B; A -= C; A ^= (C >> 3);
+		B -= C; B -= A; B ^= (A << 10);
+		C -= A; C -= B; C ^= (B >> 15);
+
+		return C;
+	}
+
+	/* The lower 4 bits of a pointer are likely zero, they're ignored by the engine */
+	inline uint32 PointerHash(const void* Key, uint32 C = 0)
+	{
+		return HashCombine(GetTypeHash(static_cast<uint64>(reinterpret_cast<uintptr_t>(Key) >> 4)), C);
+	}
+
+	template<typename PointerType>
+	inline uint32 GetTypeHash(PointerType* Value) { return PointerHash(Value); }
+
+
 	template <typename KeyType, typename ValueType>
 	class TPair
 	{
@@ -5335,26 +8581,54 @@ namespace UC
 		}
 
 	public:
+		/* Number of characters before the null-terminator */
+		inline int32 Length() const
+		{
+			if (!*this)
+				return 0;
+
+			int32 Len = 0;
+			while (Len < NumElements && Data[Len] != L'\0')
+				Len++;
+
+			return Len;
+		}
+
+		/* UTF-8, allocates once */
 		inline std::string ToString() const
 		{
-			if (*this)
-			{
-				std::wstring WData(Data);
-#pragma warning(suppress: 4244)
-				return std::string(WData.begin(), WData.end());
-			}
+			const int32 Len = Length();
 
-			return "";
+			if (Len <= 0)
+				return "";
+
+			/* Every UTF-16 character is at most 3 bytes of UTF-8, surrogate-pairs are 4 bytes for 2 characters */
+			std::string OutputString(static_cast<size_t>(Len) * 3 + 1, '\0');
+			OutputString.resize(ContainerImpl::HelperFunctions::WideToUtf8(Data, Len, OutputString.data(), static_cast<int32>(OutputString.size())));
+
+			return OutputString;
+		}
+
+		/* Writes the string as null-terminated UTF-8 into Buffer and returns its length. Doesn't allocate, truncates the string if the buffer is too small. */
+		inline int32 ToString(char* Buffer, int32 BufferSize) const
+		{
+			return ContainerImpl::HelperFunctions::WideToUtf8(Data, Length(), Buffer, BufferSize);
 		}
 
 		inline std::wstring ToWString() const
 		{
 			if (*this)
-				return std::wstring(Data);
+				return std::wstring(Data, Length());
 
 			return L"";
 		}
 
+		/* View of the string in its own memory, valid as long as the string isn't modified */
+		inline std::wstring_view ToWStringView() const
+		{
+			return std::wstring_view(Data, Length());
+		}
+
 	public:
 		inline       wchar_t* CStr()       { return Data; }
 		inline const wchar_t* CStr() const { return Data; }
@@ -5442,6 +8716,10 @@ namespace UC
 	private:
 		using FElementOrFreeListLink = ContainerImpl::TSparseArrayElementOrFreeListLink<ContainerImpl::TAlignedBytes<ElementSize, ElementAlign>>;
 
+	private:
+		template<typename SetElementType>
+		friend class TSet;
+
 	private:
 		TArray<FElementOrFreeListLink> Data;
 		ContainerImpl::FBitArray AllocationFlags;
@@ -5464,6 +8742,9 @@ namespace UC
 	private:
 		inline void VerifyIndex(int32 Index) const { if (!IsValidIndex(Index)) throw std::out_of_range("Index was out of range!"); }
 
+		inline       SparseArrayElementType& GetUnsafe(int32 Index)       { return *reinterpret_cast<SparseArrayElementType*>(&Data.GetUnsafe(Index).ElementData); }
+		inline const SparseArrayElementType& GetUnsafe(int32 Index) const { return *reinterpret_cast<const SparseArrayElementType*>(&Data.GetUnsafe(Index).ElementData); }
+
 	public:
 		inline int32 NumAllocated() const { return Data.Num(); }
 
@@ -5500,6 +8781,10 @@ namespace UC
 		using SetDataType = ContainerImpl::SetElement<SetElementType>;
 		using HashType = ContainerImpl::TInlineAllocator<1>::ForElementType<int32>;
 
+	private:
+		template<typename KeyElementType, typename ValueElementType>
+		friend class TMap;
+
 	private:
 		TSparseArray<SetDataType> Elements;
 		HashType Hash;
@@ -5521,6 +8806,34 @@ namespace UC
 	private:
 		inline void VerifyIndex(int32 Index) const { if (!IsValidIndex(Index)) throw std::out_of_range("Index was out of range!"); }
 
+		inline       SetElementType& GetUnsafe(int32 Index)       { return Elements.GetUnsafe(Index).Value; }
+		inline const SetElementType& GetUnsafe(int32 Index) const { return Elements.GetUnsafe(Index).Value; }
+
+		/* Walks the engine's bucket-chain for KeyHash. Reads only, and at most NumAllocated() elements, even if the chain is broken. */
+		template<typename KeyType, typename GetKeyFunctionType>
+		inline int32 FindIndexByHashImpl(uint32 KeyHash, const KeyType& Key, GetKeyFunctionType GetKey) const
+		{
+			if (Elements.Num() <= 0 || HashSize <= 0)
+				return -1;
+
+			const int32* Buckets = Hash.GetAllocation();
+			const int32 NumAllocatedElements = Elements.NumAllocated();
+
+			int32 Index = Buckets[KeyHash & (HashSize - 1)];
+
+			for (int32 i = 0; i < NumAllocatedElements && Index >= 0 && Index < NumAllocatedElements; i++)
+			{
+				const SetDataType& Element = Elements.GetUnsafe(Index);
+
+				if (GetKey(Element.Value) == Key)
+					return Index;
+
+				Index = Element.HashNextId;
+			}
+
+			return -1;
+		}
+
 	public:
 		inline int32 NumAllocated() const { return Elements.NumAllocated(); }
 
@@ -5534,6 +8847,20 @@ namespace UC
 	public:
 		const ContainerImpl::FBitArray& GetAllocationFlags() const { return Elements.GetAllocationFlags(); }
 
+	public:
+		/* Index of Key, or -1. KeyHash has to be the hash the engine uses for SetElementType. */
+		inline int32 FindIndexByHash(uint32 KeyHash, const SetElementType& Key) const
+		{
+			return FindIndexByHashImpl(KeyHash, Key, [](const SetElementType& Value) -> const SetElementType& { return Value; });
+		}
+
+		inline int32 FindIndex(const SetElementType& Key) const { return FindIndexByHash(GetTypeHash(Key), Key); }
+
+		inline       SetElementType* Find(const SetElementType& Key)       { const int32 Index = FindIndex(Key); return Index >= 0 ? &GetUnsafe(Index) : nullptr; }
+		inline const SetElementType* Find(const SetElementType& Key) const { const int32 Index = FindIndex(Key); return Index >= 0 ? &GetUnsafe(Index) : nullptr; }
+
+		inline bool Contains(const SetElementType& Key) const { return FindIndex(Key) >= 0; }
+
 	public:
 		inline       SetElementType& operator[] (int32 Index)       { return Elements[Index].Value; }
 		inline const SetElementType& operator[] (int32 Index) const { return Elements[Index].Value; }
@@ -5572,6 +8899,20 @@ namespace UC
 		const ContainerImpl::FBitArray& GetAllocationFlags() const { return Elements.GetAllocationFlags(); }
 
 	public:
+		/* Index of the pair with Key, or -1. KeyHash has to be the hash the engine uses for KeyElementType. */
+		inline int32 FindIndexByHash(uint32 KeyHash, const KeyElementType& Key) const
+		{
+			return Elements.FindIndexByHashImpl(KeyHash, Key, [](const ElementType& Pair) -> const KeyElementType& { return Pair.Key(); });
+		}
+
+		inline int32 FindIndex(const KeyElementType& Key) const { return FindIndexByHash(GetTypeHash(Key), Key); }
+
+		inline       ValueElementType* Find(const KeyElementType& Key)       { const int32 Index = FindIndex(Key); return Index >= 0 ? &Elements.GetUnsafe(Index).Value() : nullptr; }
+		inline const ValueElementType* Find(const KeyElementType& Key) const { const int32 Index = FindIndex(Key); return Index >= 0 ? &Elements.GetUnsafe(Index).Value() : nullptr; }
+
+		inline bool Contains(const KeyElementType& Key) const { return FindIndex(Key) >= 0; }
+
+		/* Linear search, for keys without a GetTypeHash overload */
 		inline decltype(auto) Find(const KeyElementType& Key, bool(*Equals)(const KeyElementType& LeftKey, const KeyElementType& RightKey))
 		{
 			for (auto It = begin(*this); It != end(*this); ++It)
@@ -10,8 +10,7 @@
 #include "PackageManager.h"
 
 #include "Generator.h"
-
-#include <fstream>
+#include "OutputSink.h"
 
 namespace fs = std::filesystem;
 
@@ -20,6 +19,7 @@ class CppGenerator
 {
 private:
     friend class CppGeneratorTest;
+    friend class UnrealFixtureTest;
     friend class Generator;
 
 private:
@@ -47,6 +47,80 @@ private:
         std::vector<ParamInfo> UnrealFuncParams; // for unreal-functions only
     };
 
+    struct FunctionTableEntry
+    {
+        std::string OuterName;
+        std::string FunctionName;
+    };
+
+    struct FunctionTable
+    {
+        std::string Name;
+        std::vector<FunctionTableEntry> Entries;
+    };
+
+    struct StaticClassTableEntry
+    {
+        std::string Name;
+        bool bIsFullName;
+    };
+
+    /* Per-bucket displacement of the perfect hash over 'StaticClassTable'. See BuildStaticClassPerfectHash. */
+    struct StaticClassDisplacement
+    {
+        uint32 D0;
+        uint32 D1;
+    };
+
+    struct StaticClassPerfectHash
+    {
+        uint64 Seed = 0x0;
+        std::vector<StaticClassDisplacement> Displacements;
+    };
+
+    /* Kind of a member in the tables written by GenerateMemberReflection, 'MemberReflection::EMemberKind' in the SDK */
+    enum class EMemberKind : uint8
+    {
+        Unknown,
+        Bool,
+        Int8,
+        Int16,
+        Int32,
+        Int64,
+        UInt8,
+        UInt16,
+        UInt32,
+        UInt64,
+        Float,
+        Double,
+        Enum,
+        Name,
+        String,
+        Text,
+        Object,
+        WeakObject,
+        LazyObject,
+        SoftObject,
+        Interface,
+        Struct,
+        Array,
+        Map,
+        Set,
+        Optional,
+        Delegate,
+        MulticastDelegate,
+        FieldPath,
+
+        Num
+    };
+
+    static constexpr const char* MemberKindNames[] = {
+        "Unknown", "Bool", "Int8", "Int16", "Int32", "Int64", "UInt8", "UInt16", "UInt32", "UInt64", "Float", "Double", "Enum", "Name", "String", "Text",
+        "Object", "WeakObject", "LazyObject", "SoftObject", "Interface", "Struct", "Array", "Map", "Set", "Optional", "Delegate", "MulticastDelegate", "FieldPath",
+    };
+
+    static_assert(std::size(MemberKindNames) == static_cast<uint64>(EMemberKind::Num), "Every EMemberKind needs a name!");
+
     enum class EFileType
     {
         Classes,
@@ -68,7 +142,7 @@ private:
     };
 
 private:
-    using StreamType = std::ofstream;
+    using StreamType = BufferedFile;
 
 public:
     static inline PredefinedMemberLookupMapType PredefinedMembers;
@@ -82,30 +156,111 @@ public:
 private:
     static inline std::vector<PredefinedStruct> PredefinedStructs;
 
+    /* Functions of the package that is currently generated on this thread, nullptr while the basic files are generated. See GenerateFunctionTable. */
+    static inline thread_local FunctionTable* CurrentFunctionTable = nullptr;
+
+    /* Names passed to StaticClassImpl by the classes of the package that is currently generated on this thread. See GenerateStaticClassTable. */
+    static inline thread_local std::vector<StaticClassTableEntry>* CurrentStaticClasses = nullptr;
+
+    /* Names of all StaticClass() functions in the SDK, ordered by their slot in 'StaticClassHash'. Collected from all packages before the basic files are generated. */
+    static inline std::vector<StaticClassTableEntry> StaticClassTable;
+
+    /* Minimal perfect hash mapping every name in 'StaticClassTable' to its own index */
+    static inline StaticClassPerfectHash StaticClassHash;
+
+    /* Number of out-parameter records NativeCall::Invoke in the SDK has space for */
+    static constexpr int32 NativeCallMaxOutParms = 0x20;
+
 private:
-    static std::string MakeMemberString(const std::string& Type, const std::string& Name, std::string&& Comment);
-    static std::string MakeMemberStringWithoutName(const std::string& Type, std::string&& Comment);
+    /* The Append*() and Generate*() functions write in-place into 'Out', to avoid allocating temporary strings for every line of the SDK */
+    static void AppendMemberString(std::string& Out, std::string_view Type, std::string_view Name, std::string_view Comment);
+    static void AppendMemberStringWithoutName(std::string& Out, std::string_view Type, std::string_view Comment);
 
-    static std::string GenerateBytePadding(const int32 Offset, const int32 PadSize, std::string&& Reason);
-    static std::string GenerateBitPadding(uint8 UnderlayingSizeBytes, const uint8 PrevBitPropertyEndBit, const int32 Offset, const int32 PadSize, std::string&& Reason);
+    static void AppendBytePadding(std::string& Out, const int32 Offset, const int32 PadSize, std::string_view Reason);
+    static void AppendBitPadding(std::string& Out, uint8 UnderlayingSizeBytes, const uint8 PrevBitPropertyEndBit, const int32 Offset, const int32 PadSize, std::string_view Reason);
 
-    static std::string GenerateMembers(const StructWrapper& Struct, const MemberManager& Members, int32 SuperSize, int32 SuperLastMemberEnd, int32 SuperAlign, int32 PackageIndex = -1);
+    static void GenerateMembers(std::string& OutMembers, const StructWrapper& Struct, const MemberManager& Members, int32 SuperSize, int32 SuperLastMemberEnd, int32 SuperAlign, int32 PackageIndex = -1);
     static std::string GenerateFunctionInHeader(const MemberManager& Members);
     static FunctionInfo GenerateFunctionInfo(const FunctionWrapper& Func);
 
-    // return: In-header function declarations and inline functions
-    static std::string GenerateSingleFunction(const FunctionWrapper& Func, const std::string& StructName, StreamType& FunctionFile, StreamType& ParamFile);
-    static std::string GenerateFunctions(const StructWrapper& Struct, const MemberManager& Members, const std::string& StructName, StreamType& FunctionFile, StreamType& ParamFile);
+    // InHeaderFunctionText: In-header function declarations and inline functions are appended to this string
+    static void GenerateSingleFunction(std::string& InHeaderFunctionText, const FunctionWrapper& Func, const std::string& StructName, StreamType& FunctionFile, StreamType& ParamFile);
+    static void GenerateFunctions(std::string& InHeaderFunctionText, const StructWrapper& Struct, const MemberManager& Members, const std::string& StructName, StreamType& FunctionFile, StreamType& ParamFile);
 
     static void GenerateStruct(const StructWrapper& Struct, StreamType& StructFile, StreamType& FunctionFile, StreamType& ParamFile, int32 PackageIndex = -1, const std::string& StructNameOverride = std::string());
 
     static void GenerateEnum(const EnumWrapper& Enum, StreamType& StructFile);
 
+    static void GenerateFunctionTable(StreamType& FunctionFile, PackageInfoHandle Package, const FunctionTable& Table);
+    static void GenerateStaticClassTable(StreamType& BasicCpp);
+
+    /* FNV-1a of the name with a murmur3 finalizer, the SDK computes the same hash in 'StaticClassTable::HashClassName' */
+    static constexpr uint64 HashStaticClassName(std::string_view Name, bool bIsFullName, uint64 Seed)
+    {
+        uint64 Hash = (0xCBF29CE484222325 ^ Seed) + (bIsFullName ? 0x1 : 0x0);
+
+        for (const char C : Name)
+        {
+            Hash ^= static_cast<uint8>(C);
+            Hash *= 0x100000001B3;
+        }
+
+        Hash ^= Hash >> 33;
+        Hash *= 0xFF51AFD7ED558CCD;
+        Hash ^= Hash >> 33;
+        Hash *= 0xC4CEB9FE1A85EC53;
+        Hash ^= Hash >> 33;
+
+        return Hash;
+    }
+
+    static constexpr uint32 GetStaticClassSlot(uint64 NameHash, const StaticClassDisplacement& Displacement, uint32 NumSlots)
+    {
+        const uint32 F0 = static_cast<uint32>(NameHash);
+        const uint32 F1 = static_cast<uint32>((NameHash * 0x9E3779B97F4A7C15) >> 32);
+
+        return (F0 + (Displacement.D0 * F1) + Displacement.D1) % NumSlots;
+    }
+
+    /*
+    * Builds a minimal perfect hash (CHD, "hash, displace and compress") over 'Entries' and reorders them so every entry is at its slot.
+    *
+    * Names are hashed into buckets of ~4 names, the largest buckets are placed first by searching a displacement that moves all of their
+    * names into free slots. Returns false if no table was found, which doesn't happen for unique names in practice.
+    */
+    static bool BuildStaticClassPerfectHash(std::vector<StaticClassTableEntry>& Entries, StaticClassPerfectHash& OutHash);
+
+    /* FNV-1a of the full name of a struct, class or enum ("ScriptStruct /Script/CoreUObject.Vector"), the SDK computes the same hash in 'MemberReflection::HashTypeName' */
+    static constexpr uint64 HashReflectedTypeName(std::string_view FullName)
+    {
+        uint64 Hash = 0xCBF29CE484222325;
+
+        for (const char C : FullName)
+        {
+            Hash ^= static_cast<uint8>(C);
+            Hash *= 0x100000001B3;
+        }
+
+        return Hash;
+    }
+
+    static EMemberKind GetMemberKind(const PropertyWrapper& Member);
+
+    /* Type-id of the struct, class or enum a property refers to, the element-type for containers. 0x0 if there is none. */
+    static uint64 GetMemberTypeId(UEProperty Property);
+
+    /* Appends 'ReflectedSuper', 'ReflectedTypeId' and the constexpr 'ReflectedMembers' array to the body of an unreal struct. 'ReflectedSuper' is void if the Super is cyclic with 'PackageIndex'. */
+    static void GenerateMemberReflection(std::string& OutText, const StructWrapper& Struct, const MemberManager& Members, int32 PackageIndex = -1);
+
 private: /* utility functions */
     static std::string GetMemberTypeString(const PropertyWrapper& MemberWrapper, int32 PackageIndex = -1, bool bAllowForConstPtrMembers = false /* const USomeClass* Member; */);
     static std::string GetMemberTypeString(UEProperty Member, int32 PackageIndex = -1, bool bAllowForConstPtrMembers = false);
     static std::string GetMemberTypeStringWithoutConst(UEProperty Member, int32 PackageIndex = -1);
 
+    static void AppendMemberTypeString(std::string& Out, const PropertyWrapper& MemberWrapper, int32 PackageIndex = -1, bool bAllowForConstPtrMembers = false);
+    static void AppendMemberTypeString(std::string& Out, UEProperty Member, int32 PackageIndex = -1, bool bAllowForConstPtrMembers = false);
+    static void AppendMemberTypeStringWithoutConst(std::string& Out, UEProperty Member, int32 PackageIndex = -1);
+
     static std::string GetFunctionSignature(UEFunction Func);
 
     static std::string GetStructPrefixedName(const StructWrapper& Struct);
@@ -114,7 +269,7 @@ private: /* utility functions */
 
     static std::string GetCycleFixupType(const StructWrapper& Struct, bool bIsForInheritance);
 
-    static std::unordered_map<std::string, UEProperty> GetUnknownProperties();
+    static std::map<std::string, UEProperty> GetUnknownProperties();
 
 private:
     static void GenerateEnumFwdDeclarations(StreamType& ClassOrStructFile, PackageInfoHandle Package, bool bIsClassFile);
@@ -138,6 +293,9 @@ private:
     */
     static void GenerateUnrealContainers(StreamType& UEContainersHeader);
 
+    /* Generates the _classes.hpp, _structs.hpp, _parameters.hpp and _functions.cpp files of a single package. Thread-safe with regard to other packages. */
+    static void GeneratePackage(PackageInfoHandle Package, std::vector<StaticClassTableEntry>& OutStaticClasses);
+
 public:
     static void Generate();
 
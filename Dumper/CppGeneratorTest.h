@@ -5,6 +5,8 @@
 #include "PackageManager.h"
 
 #include <cassert>
+#include <chrono>
+#include <algorithm>
 
 
 class CppGeneratorTest : protected TestBase
@@ -58,12 +60,12 @@ private:
 		}
 	};
 
-	static inline std::ofstream ClassFile;
-	static inline std::ofstream StructFile;
-	static inline std::ofstream FunctionFile;
-	static inline std::ofstream ParamFile;
+	static inline CppGenerator::StreamType ClassFile;
+	static inline CppGenerator::StreamType StructFile;
+	static inline CppGenerator::StreamType FunctionFile;
+	static inline CppGenerator::StreamType ParamFile;
 
-	static inline std::ofstream NameCollisionInl;
+	static inline CppGenerator::StreamType NameCollisionInl;
 
 private:
 	static void InitTestVariables()
@@ -82,12 +84,12 @@ private:
 
 		fs::path BasePath("C:/Users/savek/Documents/GitHub/Fortnite-Dumper-7/SDKTest");
 
-		ClassFile = std::ofstream(BasePath / "CPP_classes.hpp", std::ios::trunc);
-		StructFile = std::ofstream(BasePath / "CPP_structs.hpp", std::ios::trunc);
-		FunctionFile = std::ofstream(BasePath / "CPP_functions.cpp", std::ios::trunc);
-		ParamFile = std::ofstream(BasePath / "CPP_params.hpp", std::ios::trunc);
+		ClassFile = CppGenerator::StreamType(BasePath / "CPP_classes.hpp");
+		StructFile = CppGenerator::StreamType(BasePath / "CPP_structs.hpp");
+		FunctionFile = CppGenerator::StreamType(BasePath / "CPP_functions.cpp");
+		ParamFile = CppGenerator::StreamType(BasePath / "CPP_params.hpp");
 
-		NameCollisionInl = std::ofstream(BasePath / "NameCollision.inl", std::ios::trunc);
+		NameCollisionInl = CppGenerator::StreamType(BasePath / "NameCollision.inl");
 
 		bDidInit = true;
 	}
@@ -101,6 +103,16 @@ public:
 		TestUnrealClassGeneration<bDoDebugPrinting>();
 		TestUnrealEnumGeneration<bDoDebugPrinting>();
 		TestNameCollisionInlCreation<bDoDebugPrinting>();
+		TestStaticClassPerfectHash<bDoDebugPrinting>();
+
+		/* Files are only written once they're closed */
+		ClassFile.close();
+		StructFile.close();
+		FunctionFile.close();
+		ParamFile.close();
+		NameCollisionInl.close();
+
+		OutputSink::Flush();
 
 		PrintDbgMessage<bDoDebugPrinting>("");
 	}
@@ -196,6 +208,124 @@ public:
 		CppGenerator::GenerateEnum(ObjectArray::FindObjectFast<UEEnum>("ESlateColorStylingMode"), StructFile);
 	}
 
+	/*
+	* Generates every struct and class of the game into memory (nothing is written to disk) and measures the time, throughput and heap-allocations.
+	*
+	* Allocations are only counted if DUMPER7_COUNT_ALLOCATIONS is defined, see 'TestBase::ScopedAllocationCounter'.
+	*/
+	template<bool bDoDebugPrinting = true>
+	static inline void BenchmarkStructGeneration()
+	{
+		InitTestVariables();
+
+		MemberManager::SetPredefinedMemberLookupPtr(&CppGenerator::PredefinedMembers);
+
+		std::vector<UEStruct> Structs;
+
+		for (UEObject Obj : ObjectArray())
+		{
+			if (Obj.IsA(EClassCastFlags::Struct) && !Obj.IsA(EClassCastFlags::Function))
+				Structs.push_back(Obj.Cast<UEStruct>());
+		}
+
+		/* Only used as in-memory buffers, discarded at the end of the benchmark */
+		CppGenerator::StreamType StructOutput("BenchmarkStructs.hpp");
+		CppGenerator::StreamType FunctionOutput("BenchmarkFunctions.cpp");
+		CppGenerator::StreamType ParamOutput("BenchmarkParams.hpp");
+
+		uint64 NumBytesGenerated = 0x0;
+
+		ScopedAllocationCounter AllocationCounter;
+
+		auto StartTime = std::chrono::high_resolution_clock::now();
+
+		for (UEStruct Struct : Structs)
+		{
+			CppGenerator::GenerateStruct(Struct, StructOutput, FunctionOutput, ParamOutput, Struct.GetPackageIndex());
+
+			/* Keep the buffers small, like the per-package buffers during generation */
+			NumBytesGenerated += StructOutput.GetBuffer().size() + FunctionOutput.GetBuffer().size() + ParamOutput.GetBuffer().size();
+
+			StructOutput.GetBuffer().clear();
+			FunctionOutput.GetBuffer().clear();
+			ParamOutput.GetBuffer().clear();
+		}
+
+		const double Time = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - StartTime).count();
+		const uint64 NumAllocations = AllocationCounter.GetNumAllocations();
+
+		StructOutput.Discard();
+		FunctionOutput.Discard();
+		ParamOutput.Discard();
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> {} structs, {} bytes in {:.2f}ms ({:.2f} MB/s), {} allocations ({:.2f} per struct){}",
+			__FUNCTION__, Structs.size(), NumBytesGenerated, Time, (NumBytesGenerated / (1024.0 * 1024.0)) / (Time / 1000.0),
+			NumAllocations, static_cast<double>(NumAllocations) / Structs.size(), ScopedAllocationCounter::IsSupported() ? "" : " [allocations are only counted if DUMPER7_COUNT_ALLOCATIONS is defined]");
+	}
+
+	/* Builds the perfect hash of the StaticClass() table from the name and full name of every class in GObjects and checks that every name has its own slot */
+	template<bool bDoDebugPrinting = false>
+	static inline void TestStaticClassPerfectHash()
+	{
+		using EntryType = CppGenerator::StaticClassTableEntry;
+
+		std::vector<EntryType> Entries;
+
+		for (UEObject Obj : ObjectArray())
+		{
+			if (!Obj.IsA(EClassCastFlags::Class))
+				continue;
+
+			Entries.push_back(EntryType{ Obj.GetName(), false });
+			Entries.push_back(EntryType{ Obj.GetFullName(), true });
+		}
+
+		/* Unique names, like the table generated by CppGenerator::Generate */
+		std::sort(Entries.begin(), Entries.end(), [](const EntryType& Left, const EntryType& Right) -> bool
+		{
+			return Left.bIsFullName != Right.bIsFullName ? !Left.bIsFullName : Left.Name < Right.Name;
+		});
+
+		Entries.erase(std::unique(Entries.begin(), Entries.end(), [](const EntryType& Left, const EntryType& Right) -> bool
+		{
+			return Left.bIsFullName == Right.bIsFullName && Left.Name == Right.Name;
+		}), Entries.end());
+
+		const uint64 NumEntries = Entries.size();
+
+		CppGenerator::StaticClassPerfectHash Hash;
+
+		auto StartTime = std::chrono::high_resolution_clock::now();
+
+		bool bSuccededTestWithoutError = CppGenerator::BuildStaticClassPerfectHash(Entries, Hash);
+
+		const double Time = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - StartTime).count();
+
+		if (Entries.size() != NumEntries)
+		{
+			PrintDbgMessage<bDoDebugPrinting>("Number of entries changed from {} to {}", NumEntries, Entries.size());
+			bSuccededTestWithoutError = false;
+		}
+
+		for (uint32 i = 0; bSuccededTestWithoutError && i < Entries.size(); i++)
+		{
+			const uint64 NameHash = CppGenerator::HashStaticClassName(Entries[i].Name, Entries[i].bIsFullName, Hash.Seed);
+			const CppGenerator::StaticClassDisplacement& Displacement = Hash.Displacements[static_cast<uint32>(NameHash >> 32) % Hash.Displacements.size()];
+
+			const uint32 Slot = CppGenerator::GetStaticClassSlot(NameHash, Displacement, static_cast<uint32>(Entries.size()));
+
+			if (Slot != i)
+			{
+				PrintDbgMessage<bDoDebugPrinting>("\"{}\" hashes to slot 0x{:X} instead of 0x{:X}", Entries[i].Name, Slot, i);
+				bSuccededTestWithoutError = false;
+			}
+		}
+
+		PrintDbgMessage<bDoDebugPrinting>("{} names, {} buckets, seed 0x{:X}, built in {:.2f}ms", Entries.size(), Hash.Displacements.size(), Hash.Seed, Time);
+
+		std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
 	template<bool bDoDebugPrinting = false>
 	static inline void TestNameCollisionInlCreation()
 	{
@@ -18,7 +18,7 @@ void DependencyManager::AddDependency(const int32 DepedantIdx, int32 DependencyI
 
 void DependencyManager::SetDependencies(const int32 DepedantIdx, std::unordered_set<int32>&& Dependencies)
 {
-	AllDependencies[DepedantIdx].DependencyIndices = std::move(Dependencies);
+	AllDependencies[DepedantIdx].DependencyIndices = std::set<int32>(Dependencies.begin(), Dependencies.end());
 }
 
 size_t DependencyManager::GetNumEntries() const
@@ -26,18 +26,14 @@ size_t DependencyManager::GetNumEntries() const
 	return AllDependencies.size();
 }
 
-void DependencyManager::VisitIndexAndDependencies(int32 Index, OnVisitCallbackType Callback) const
+void DependencyManager::VisitIndexAndDependencies(int32 Index, const OnVisitCallbackType& Callback, std::unordered_set<int32>& VisitedNodes) const
 {
-	auto& [IterationHitCounter, Dependencies] = AllDependencies.at(Index);
-
-	if (IterationHitCounter >= CurrentIterationHitCount)
+	if (!VisitedNodes.insert(Index).second)
 		return;
 
-	IterationHitCounter = CurrentIterationHitCount;
-
-	for (int32 Dependency : Dependencies)
+	for (int32 Dependency : AllDependencies.at(Index).DependencyIndices)
 	{
-		VisitIndexAndDependencies(Dependency, Callback);
+		VisitIndexAndDependencies(Dependency, Callback, VisitedNodes);
 	}
 
 	Callback(Index);
@@ -45,17 +41,18 @@ void DependencyManager::VisitIndexAndDependencies(int32 Index, OnVisitCallbackTy
 
 void DependencyManager::VisitIndexAndDependenciesWithCallback(int32 Index, OnVisitCallbackType Callback) const
 {
-	CurrentIterationHitCount++;
+	std::unordered_set<int32> VisitedNodes;
 
-	VisitIndexAndDependencies(Index, Callback);
+	VisitIndexAndDependencies(Index, Callback, VisitedNodes);
 }
 
 void DependencyManager::VisitAllNodesWithCallback(OnVisitCallbackType Callback) const
 {
-	CurrentIterationHitCount++;
+	std::unordered_set<int32> VisitedNodes;
+	VisitedNodes.reserve(AllDependencies.size());
 
 	for (const auto& [Index, DependencyInfo] : AllDependencies)
 	{
-		VisitIndexAndDependencies(Index, Callback);
+		VisitIndexAndDependencies(Index, Callback, VisitedNodes);
 	}
 }
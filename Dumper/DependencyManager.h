@@ -1,6 +1,7 @@
 #pragma once
 #include <unordered_set>
-#include <unordered_map>
+#include <set>
+#include <map>
 #include <iostream>
 #include <format>
 #include <functional>
@@ -16,19 +17,13 @@ public:
 private:
 	struct IndexDependencyInfo
 	{
-		/* Counter incremented every time this element is hit during iteration, **if** the counter is less than the CurrentIterationIndex */
-		mutable uint64 IterationHitCounter = 0x0;
-
-		/* Indices of Objects required by this Object */
-		std::unordered_set<int32> DependencyIndices;
+		/* Indices of Objects required by this Object. Ordered, to visit dependencies in the same order on every run. */
+		std::set<int32> DependencyIndices;
 	};
 
 private:
-	/* List of Objects and their Dependencies */
-	std::unordered_map<int32, IndexDependencyInfo> AllDependencies;
-
-	/* Count to track how often the Dependency-List was iterated. Allows for up to 2^64 iterations of this list. */
-	mutable uint64 CurrentIterationHitCount = 0x0;
+	/* List of Objects and their Dependencies. Ordered by index, so the output of the generators is deterministic. */
+	std::map<int32, IndexDependencyInfo> AllDependencies;
 
 public:
 	DependencyManager() = default;
@@ -36,7 +31,8 @@ public:
 	DependencyManager(int32 ObjectToTrack);
 
 private:
-	void VisitIndexAndDependencies(int32 Index, OnVisitCallbackType Callback) const;
+	/* Visited nodes are tracked per visit, not in the nodes, so multiple generators can visit the same DependencyManager at the same time */
+	void VisitIndexAndDependencies(int32 Index, const OnVisitCallbackType& Callback, std::unordered_set<int32>& VisitedNodes) const;
 
 public:
 	void SetExists(const int32 DepedantIdx);
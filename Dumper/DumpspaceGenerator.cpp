@@ -1,4 +1,7 @@
 #include "DumpspaceGenerator.h"
+#include "ParallelUtils.h"
+#include "Profiler.h"
+#include "Settings.h"
 
 std::string DumpspaceGenerator::GetStructPrefixedName(const StructWrapper& Struct)
 {
@@ -453,6 +456,38 @@ void DumpspaceGenerator::GeneratedStaticOffsets()
 	DSGen::addOffset("INDEX_PROCESSEVENT", Off::InSDK::ProcessEvent::PEIndex);
 }
 
+void DumpspaceGenerator::GeneratePackage(PackageInfoHandle Package, DSGen::BakedData& OutData)
+{
+	ProfilerScope Scope("DumpspaceGenerator::GeneratePackage", [&]() { return Package.GetName(); });
+
+	/* Generate classes/structs/enums/functions into this packages fragment, fragments are merged in package order later on */
+	for (int32 EnumIdx : Package.GetEnums())
+	{
+		DSGen::EnumHolder Enum = GenerateEnum(ObjectArray::GetByIndex<UEEnum>(EnumIdx));
+		DSGen::bakeEnum(Enum, OutData);
+	}
+
+	DependencyManager::OnVisitCallbackType GenerateClassOrStructCallback = [&](int32 Index) -> void
+	{
+		DSGen::ClassHolder StructOrClass = GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index));
+		DSGen::bakeStructOrClass(StructOrClass, OutData);
+	};
+
+	if (Package.HasStructs())
+	{
+		const DependencyManager& Structs = Package.GetSortedStructs();
+
+		Structs.VisitAllNodesWithCallback(GenerateClassOrStructCallback);
+	}
+
+	if (Package.HasClasses())
+	{
+		const DependencyManager& Classes = Package.GetSortedClasses();
+
+		Classes.VisitAllNodesWithCallback(GenerateClassOrStructCallback);
+	}
+}
+
 void DumpspaceGenerator::Generate()
 {
 	/* Set the output directory of DSGen to "...GenerationPath/GameVersion-GameName/Dumespace" */
@@ -461,43 +496,29 @@ void DumpspaceGenerator::Generate()
 	/* Add offsets for GObjects, GNames, GWorld, AppendString, PrcessEvent and ProcessEventIndex*/
 	GeneratedStaticOffsets();
 
-	// Generates all packages and writes them to files
+	/* Collect all packages up front, 'IterateOverPackageInfos()' must not be used from multiple threads */
+	std::vector<PackageInfoHandle> Packages;
+	Packages.reserve(PackageManager::GetPackageInfos().size());
+
 	for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
 	{
-		if (Package.IsEmpty())
-			continue;
-
-		/*
-		* Generate classes/structs/enums/functions directly into the respective files
-		*
-		* Note: Some filestreams aren't opened but passed as parameters anyway because the function demands it, they are not used if they are closed
-		*/
-		for (int32 EnumIdx : Package.GetEnums())
-		{
-			DSGen::EnumHolder Enum = GenerateEnum(ObjectArray::GetByIndex<UEEnum>(EnumIdx));
-			DSGen::bakeEnum(Enum);
-		}
-
-		DependencyManager::OnVisitCallbackType GenerateClassOrStructCallback = [&](int32 Index) -> void
-		{
-			DSGen::ClassHolder StructOrClass = GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index));
-			DSGen::bakeStructOrClass(StructOrClass);
-		};
+		if (!Package.IsEmpty())
+			Packages.push_back(Package);
+	}
 
-		if (Package.HasStructs())
-		{
-			const DependencyManager& Structs = Package.GetSortedStructs();
+	/* One fragment per package, so the order of the elements doesn't depend on which thread finished first */
+	std::vector<DSGen::BakedData> PackageData(Packages.size());
 
-			Structs.VisitAllNodesWithCallback(GenerateClassOrStructCallback);
-		}
+	const uint32 NumThreads = Settings::DumpspaceGenerator::bGeneratePackagesInParallel ? Settings::DumpspaceGenerator::NumGeneratorThreads : 1;
 
-		if (Package.HasClasses())
-		{
-			const DependencyManager& Classes = Package.GetSortedClasses();
+	ParallelUtils::ParallelFor(static_cast<int32>(Packages.size()), [&](int32 Index) -> void
+	{
+		GeneratePackage(Packages[Index], PackageData[Index]);
+	}, NumThreads);
 
-			Classes.VisitAllNodesWithCallback(GenerateClassOrStructCallback);
-		}
-	}
+	for (DSGen::BakedData& Data : PackageData)
+		DSGen::addBakedData(std::move(Data));
 
+	ProfilerScope DumpScope("DSGen::dump");
 	DSGen::dump();
 }
\ No newline at end of file
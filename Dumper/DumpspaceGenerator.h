@@ -5,6 +5,7 @@
 #include "StructWrapper.h"
 #include "MemberWrappers.h"
 #include "PackageManager.h"
+#include "OutputSink.h"
 
 #include "ExternalDependencies/Dumpspace/DSGen.h"
 
@@ -15,7 +16,7 @@ private:
     friend class Generator;
 
 private:
-    using StreamType = std::ofstream;
+    using StreamType = BufferedFile;
 
 public:
     static inline PredefinedMemberLookupMapType PredefinedMembers;
@@ -53,6 +54,8 @@ private:
 
     static void GeneratedStaticOffsets();
 
+    static void GeneratePackage(PackageInfoHandle Package, DSGen::BakedData& OutData);
+
 public:
     static void Generate();
 
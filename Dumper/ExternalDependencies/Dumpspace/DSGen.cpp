@@ -1,6 +1,10 @@
 #include "DSGen.h"
 
-#include <fstream>
+#include <chrono>
+#include <array>
+
+#include "../../OutputSink.h"
+#include "../../ParallelUtils.h"
 
 DSGen::DSGen()
 {
@@ -109,77 +113,140 @@ void DSGen::createFunction(ClassHolder& owningClass, const std::string& function
 
 void DSGen::bakeStructOrClass(ClassHolder& classHolder)
 {
-	nlohmann::json jClass;
+	if (bakedData.empty())
+		bakedData.emplace_back();
 
-	nlohmann::json membersArray = nlohmann::json::array();
+	bakeStructOrClass(classHolder, bakedData.back());
+}
 
-	nlohmann::json inheritInfo = nlohmann::json::array();
-	for (auto super : classHolder.interitedTypes)
-		inheritInfo.push_back(super);
+void DSGen::bakeStructOrClass(const ClassHolder& classHolder, BakedData& target)
+{
+	std::string& classData = classHolder.classType == ET_Class ? target.classes : target.structs;
 
-	nlohmann::json InheritInfo;
-	InheritInfo["__InheritInfo"] = inheritInfo;
-	membersArray.push_back(InheritInfo);
+	if (!classData.empty())
+		classData += ',';
 
-	nlohmann::json gSize;
-	gSize["__MDKClassSize"] = classHolder.classSize;
-	membersArray.push_back(gSize);
+	JsonWriter jClass(classData);
 
-	for(auto& member : classHolder.members)
-	{
-		nlohmann::json jmember;
+	jClass.beginObject();
+	jClass.key(classHolder.className);
+	jClass.beginArray();
 
+	jClass.beginObject();
+	jClass.key("__InheritInfo");
+	jClass.beginArray();
+	for (auto& super : classHolder.interitedTypes)
+		jClass.value(super);
+	jClass.endArray();
+	jClass.endObject();
 
+	jClass.beginObject();
+	jClass.key("__MDKClassSize");
+	jClass.value(classHolder.classSize);
+	jClass.endObject();
+
+	for (auto& member : classHolder.members)
+	{
+		jClass.beginObject();
+		jClass.key(member.memberName);
+		jClass.beginArray();
+		member.memberType.writeJson(jClass);
+		jClass.value(member.offset);
+		jClass.value(member.size);
+		jClass.value(member.arrayDim);
 		if (member.bitOffset > -1)
-			jmember[member.memberName] = std::make_tuple(member.memberType.jsonify(), member.offset, member.size, member.arrayDim, member.bitOffset);
-		else
-			jmember[member.memberName] = std::make_tuple(member.memberType.jsonify(), member.offset, member.size, member.arrayDim);
-		membersArray.push_back(jmember);
+			jClass.value(member.bitOffset);
+		jClass.endArray();
+		jClass.endObject();
 	}
-	nlohmann::json j;
-
-	j[classHolder.className] = membersArray;
 
-	if (classHolder.classType == ET_Class)
-		classes.push_back(j);
-	else
-		structs.push_back(j);
+	jClass.endArray();
+	jClass.endObject();
 
-	if(!classHolder.functions.empty())
+	if (!classHolder.functions.empty())
 	{
-		nlohmann::json classFunctions = nlohmann::json::array();
+		std::string& functions = target.functions;
+
+		if (!functions.empty())
+			functions += ',';
+
+		JsonWriter jFunctions(functions);
+
+		jFunctions.beginObject();
+		jFunctions.key(classHolder.className);
+		jFunctions.beginArray();
+
 		for (auto& func : classHolder.functions)
 		{
-			nlohmann::json functionParams = nlohmann::json::array();
+			jFunctions.beginObject();
+			jFunctions.key(func.functionName);
+			jFunctions.beginArray();
 
-			for (const auto& param : func.functionParams)
-				functionParams.push_back(std::make_tuple(param.first.jsonify(), param.first.reference ? "&" : "", param.second));
+			func.returnType.writeJson(jFunctions);
 
-			nlohmann::json j1;
-			j1[func.functionName] = std::make_tuple(func.returnType.jsonify(), functionParams, func.functionOffset, func.functionFlags);
-			classFunctions.push_back(j1);
+			jFunctions.beginArray();
+			for (const auto& param : func.functionParams)
+			{
+				jFunctions.beginArray();
+				param.first.writeJson(jFunctions);
+				jFunctions.value(param.first.reference ? "&" : "");
+				jFunctions.value(param.second);
+				jFunctions.endArray();
+			}
+			jFunctions.endArray();
+
+			jFunctions.value(func.functionOffset);
+			jFunctions.value(func.functionFlags);
+
+			jFunctions.endArray();
+			jFunctions.endObject();
 		}
-		nlohmann::json f;
 
-		f[classHolder.className] = classFunctions;
-
-		functions.push_back(f);
+		jFunctions.endArray();
+		jFunctions.endObject();
 	}
-
 }
 
 void DSGen::bakeEnum(EnumHolder& enumHolder)
 {
-	nlohmann::json members = nlohmann::json::array();
-	for(const auto& member : enumHolder.enumMembers)
+	if (bakedData.empty())
+		bakedData.emplace_back();
+
+	bakeEnum(enumHolder, bakedData.back());
+}
+
+void DSGen::bakeEnum(const EnumHolder& enumHolder, BakedData& target)
+{
+	std::string& enums = target.enums;
+
+	if (!enums.empty())
+		enums += ',';
+
+	JsonWriter jEnum(enums);
+
+	jEnum.beginObject();
+	jEnum.key(enumHolder.enumName);
+	jEnum.beginArray();
+
+	jEnum.beginArray();
+	for (const auto& member : enumHolder.enumMembers)
 	{
-		nlohmann::json m;
-		m[member.first] = member.second;
-		members.push_back(m);
+		jEnum.beginObject();
+		jEnum.key(member.first);
+		jEnum.value(member.second);
+		jEnum.endObject();
 	}
-	nlohmann::json j;
-	j[enumHolder.enumName] = std::make_tuple(members, enumHolder.enumType);
-	enums.push_back(j);
+	jEnum.endArray();
+
+	jEnum.value(enumHolder.enumType);
+
+	jEnum.endArray();
+	jEnum.endObject();
+}
+
+void DSGen::addBakedData(BakedData&& data)
+{
+	bakedData.push_back(std::move(data));
 }
 
 void DSGen::dump()
@@ -189,29 +256,89 @@ void DSGen::dump()
 
 	constexpr auto version = 10202;
 
-	auto saveToDisk = [&](const nlohmann::json& json, const std::string& fileName, bool offsetFile = false)
+	std::string offsetData;
+
+	for (const auto& [name, offset] : offsets)
 	{
-		nlohmann::json j;
-		j["updated_at"] = dumpTimeStamp;
-		j["data"] = json;
-		j["version"] = version;
-
-		if(offsetFile){
-			nlohmann::json credit;
-			credit["dumper_used"] = "Dumper-7";
-			credit["dumper_link"] = "https://github.com/Encryqed/Dumper-7";
-			j["credit"] = credit;
+		if (!offsetData.empty())
+			offsetData += ',';
+
+		JsonWriter jOffsets(offsetData);
+
+		jOffsets.beginArray();
+		jOffsets.value(name);
+		jOffsets.value(offset);
+		jOffsets.endArray();
+	}
+
+	// keys are written in the same (alphabetical) order nlohmann::json used to write them: credit, data, updated_at, version
+	auto saveToDisk = [&](const std::vector<std::string*>& fragments, const std::string& fileName, bool offsetFile)
+	{
+		std::string header = offsetFile ? R"({"credit":{"dumper_link":"https://github.com/Encryqed/Dumper-7","dumper_used":"Dumper-7"},"data":[)" : R"({"data":[)";
+
+		std::string footer = R"(],"updated_at":)";
+		JsonWriter::appendString(footer, dumpTimeStamp);
+		footer += R"(,"version":)";
+		footer += std::to_string(version);
+		footer += '}';
+
+		size_t fileSize = header.size() + footer.size() + fragments.size();
+		for (const std::string* fragment : fragments)
+			fileSize += fragment->size();
+
+		BufferedFile file(directory / fileName, true, fileSize);
+		file << header;
+
+		bool bIsFirstElement = true;
+		for (std::string* fragment : fragments)
+		{
+			if (fragment->empty())
+				continue;
+
+			if (!bIsFirstElement)
+				file << ',';
+
+			file << *fragment;
+			bIsFirstElement = false;
+
+			// the data was copied into the file, release it right away
+			*fragment = std::string();
 		}
 
-		std::ofstream file(directory / fileName);
-		file << j.dump(-1, ' ', false, nlohmann::detail::error_handler_t::replace);
+		file << footer;
+	};
+
+	struct OutputFile
+	{
+		const char* fileName;
+		std::string BakedData::* member;
 	};
 
-	saveToDisk(nlohmann::json(nlohmann::json(offsets)), "OffsetsInfo.json", true);
-	saveToDisk(nlohmann::json(classes), "ClassesInfo.json");
-	saveToDisk(nlohmann::json(functions), "FunctionsInfo.json");
-	saveToDisk(nlohmann::json(structs), "StructsInfo.json");
-	saveToDisk(nlohmann::json(enums), "EnumsInfo.json");
+	static constexpr std::array<OutputFile, 4> dataFiles =
+	{ {
+		{ "ClassesInfo.json", &BakedData::classes },
+		{ "FunctionsInfo.json", &BakedData::functions },
+		{ "StructsInfo.json", &BakedData::structs },
+		{ "EnumsInfo.json", &BakedData::enums },
+	} };
+
+	// every file only touches its own member of the fragments, the files can be assembled concurrently
+	ParallelUtils::ParallelFor(static_cast<int32>(dataFiles.size() + 1), [&](int32 index) -> void
+	{
+		if (index == static_cast<int32>(dataFiles.size()))
+		{
+			saveToDisk({ &offsetData }, "OffsetsInfo.json", true);
+			return;
+		}
+
+		std::vector<std::string*> fragments;
+		fragments.reserve(bakedData.size());
+
+		for (BakedData& data : bakedData)
+			fragments.push_back(&(data.*dataFiles[index].member));
 
+		saveToDisk(fragments, dataFiles[index].fileName, false);
+	});
 
+	bakedData.clear();
 }
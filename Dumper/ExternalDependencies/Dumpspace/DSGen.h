@@ -1,8 +1,10 @@
 #pragma once
 
 #include <string>
+#include <vector>
+#include <tuple>
 #include <filesystem>
-#include "../Json/json.hpp"
+#include "JsonWriter.h"
 
 class DSGen
 {
@@ -59,23 +61,21 @@ public:
 		std::vector<MemberType> subTypes; // most of the times empty, just needed if the MemberType is a template, e.g TArray<abc>
 
 		/**
-		 * \brief creates a JSON with all the information about the MemberType and SubTypes
-		 * \return returns a JSON with all the information about the MemberType and SubTypes
+		 * \brief writes a JSON array with all the information about the MemberType and SubTypes
+		 * \param writer the writer the array gets appended to
 		 */
-		nlohmann::json jsonify() const
+		void writeJson(JsonWriter& writer) const
 		{
 			//create a array for the memberType
-			nlohmann::json arr = nlohmann::json::array();
-			arr.push_back(typeName); //first the typeName
-			arr.push_back(getTypeShort(type)); //then the short Type
-			arr.push_back(extendedType); //then any extended type
-			nlohmann::json subTypeArr = nlohmann::json::array();
+			writer.beginArray();
+			writer.value(typeName); //first the typeName
+			writer.value(getTypeShort(type)); //then the short Type
+			writer.value(extendedType); //then any extended type
+			writer.beginArray();
 			for (auto& subType : subTypes)
-				subTypeArr.push_back(subType.jsonify());
-			
-			arr.push_back(subTypeArr);
-
-			return arr;
+				subType.writeJson(writer);
+			writer.endArray();
+			writer.endArray();
 		}
 	};
 
@@ -119,6 +119,15 @@ public:
 	};
 
 
+	// Holds baked elements, already serialized. Each string is the comma-separated content of the "data" array of one file.
+	// Fragments can be baked on different threads and are then added with addBakedData, in the order they should appear in the files.
+	struct BakedData
+	{
+		std::string classes;
+		std::string structs;
+		std::string functions;
+		std::string enums;
+	};
 
 private:
 	static inline std::string dumpTimeStamp{};
@@ -127,10 +136,8 @@ private:
 
 	static inline std::vector<std::tuple<std::string, uintptr_t>> offsets{};
 
-	static inline nlohmann::json classes = nlohmann::json::array();
-	static inline nlohmann::json structs = nlohmann::json::array();
-	static inline nlohmann::json functions = nlohmann::json::array();
-	static inline nlohmann::json enums = nlohmann::json::array();
+	// baked fragments in the order they're written to the files, see addBakedData
+	static inline std::vector<BakedData> bakedData{};
 
 public:
 	//redundant constructor
@@ -264,15 +271,35 @@ public:
 	 */
 	static void bakeStructOrClass(ClassHolder& classHolder);
 
+	/**
+	 * \brief bakes a ClassHolder into a fragment instead of the global data. Doesn't touch any global state, can be called from any thread
+	 * \param classHolder the classHolder that should get baked
+	 * \param target the fragment the classHolder gets appended to
+	 */
+	static void bakeStructOrClass(const ClassHolder& classHolder, BakedData& target);
+
 	/**
 	 * \brief bakes a EnumHolder which gets later dumped
 	 * \param enumHolder the enumHolder that should get baked
 	 */
 	static void bakeEnum(EnumHolder& enumHolder);
 
+	/**
+	 * \brief bakes a EnumHolder into a fragment instead of the global data. Doesn't touch any global state, can be called from any thread
+	 * \param enumHolder the enumHolder that should get baked
+	 * \param target the fragment the enumHolder gets appended to
+	 */
+	static void bakeEnum(const EnumHolder& enumHolder, BakedData& target);
+
+	/**
+	 * \brief adds a fragment which gets later dumped. Its elements are written after all elements baked before
+	 * \param data the fragment, gets moved from
+	 */
+	static void addBakedData(BakedData&& data);
+
 
 	/**
-	 * \brief dumps all baked information to disk. This should be the final step
+	 * \brief dumps all baked information to disk. This should be the final step. The five files are assembled concurrently
 	 */
 	static void dump();
 };
\ No newline at end of file
@@ -0,0 +1,259 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <charconv>
+#include <concepts>
+#include <cstdint>
+
+/*
+ * Minimal SAX-style JSON writer, appending compact JSON directly to a std::string.
+ *
+ * The output is byte-identical to nlohmann::json::dump(-1, ' ', false, error_handler_t::replace) of the same values:
+ * no whitespace, control characters escaped like nlohmann does, invalid UTF-8 replaced by U+FFFD.
+ * Object keys are written in the order they're passed, callers have to pass them sorted to match nlohmann's std::map ordering.
+ */
+class JsonWriter
+{
+private:
+	std::string& out;
+
+	// one entry per open object/array, whether the next value needs a leading comma
+	std::vector<bool> needsComma;
+
+	// set after a key was written, the following value must not be preceeded by a comma
+	bool bAfterKey = false;
+
+public:
+	explicit JsonWriter(std::string& output)
+		: out(output)
+	{
+		needsComma.reserve(16);
+	}
+
+private:
+	void beginValue()
+	{
+		if (bAfterKey)
+		{
+			bAfterKey = false;
+			return;
+		}
+
+		if (!needsComma.empty())
+		{
+			if (needsComma.back())
+				out += ',';
+
+			needsComma.back() = true;
+		}
+	}
+
+	// Hoehrmann's UTF-8 decoder, same table as nlohmann::detail::serializer::decode
+	static uint8_t decodeUtf8(uint8_t& state, uint32_t& codepoint, const uint8_t byte)
+	{
+		static constexpr uint8_t utf8d[400] =
+		{
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 00..1F
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 20..3F
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 40..5F
+			0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 60..7F
+			1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, // 80..9F
+			7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, // A0..BF
+			8, 8, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // C0..DF
+			0xA, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x4, 0x3, 0x3, // E0..EF
+			0xB, 0x6, 0x6, 0x6, 0x5, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, // F0..FF
+			0x0, 0x1, 0x2, 0x3, 0x5, 0x8, 0x7, 0x1, 0x1, 0x1, 0x4, 0x6, 0x1, 0x1, 0x1, 0x1, // s0..s0
+			1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 1, // s1..s2
+			1, 2, 1, 1, 1, 1, 1, 2, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, // s3..s4
+			1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 3, 1, 1, 1, 1, 1, 1, // s5..s6
+			1, 3, 1, 1, 1, 1, 1, 3, 1, 3, 1, 1, 1, 1, 1, 1, 1, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1  // s7..s8
+		};
+
+		const uint8_t type = utf8d[byte];
+
+		codepoint = (state != 0) ? (byte & 0x3Fu) | (codepoint << 6u) : (0xFFu >> type) & byte;
+
+		state = utf8d[256u + state * 16u + type];
+		return state;
+	}
+
+	static void appendEscapedSlow(std::string& output, std::string_view str)
+	{
+		constexpr uint8_t utf8Accept = 0;
+		constexpr uint8_t utf8Reject = 1;
+
+		constexpr std::string_view replacementChar = "\xEF\xBF\xBD";
+
+		uint32_t codepoint = 0;
+		uint8_t state = utf8Accept;
+
+		size_t sizeAfterLastAccept = output.size();
+		size_t undumpedChars = 0;
+
+		for (size_t i = 0; i < str.size(); ++i)
+		{
+			const uint8_t byte = static_cast<uint8_t>(str[i]);
+
+			switch (decodeUtf8(state, codepoint, byte))
+			{
+			case utf8Accept:
+			{
+				switch (codepoint)
+				{
+				case 0x08: output += "\\b"; break;
+				case 0x09: output += "\\t"; break;
+				case 0x0A: output += "\\n"; break;
+				case 0x0C: output += "\\f"; break;
+				case 0x0D: output += "\\r"; break;
+				case 0x22: output += "\\\""; break;
+				case 0x5C: output += "\\\\"; break;
+				default:
+				{
+					if (codepoint <= 0x1F)
+					{
+						constexpr const char* hexDigits = "0123456789abcdef";
+
+						output += "\\u00";
+						output += hexDigits[codepoint >> 4];
+						output += hexDigits[codepoint & 0xF];
+					}
+					else
+					{
+						// previous bytes of a multi-byte codepoint were already copied
+						output += str[i];
+					}
+					break;
+				}
+				}
+
+				sizeAfterLastAccept = output.size();
+				undumpedChars = 0;
+				break;
+			}
+			case utf8Reject:
+			{
+				// the byte might be valid on its own, just not as part of the previous sequence, read it again
+				if (undumpedChars > 0)
+					--i;
+
+				// drop the bytes of the invalid sequence
+				output.resize(sizeAfterLastAccept);
+				output += replacementChar;
+
+				sizeAfterLastAccept = output.size();
+				undumpedChars = 0;
+				state = utf8Accept;
+				break;
+			}
+			default:
+			{
+				// incomplete multi-byte codepoint
+				output += str[i];
+				++undumpedChars;
+				break;
+			}
+			}
+		}
+
+		// string ended inside of a multi-byte codepoint
+		if (state != utf8Accept)
+		{
+			output.resize(sizeAfterLastAccept);
+			output += replacementChar;
+		}
+	}
+
+public:
+	// appends 'str' as a quoted and escaped JSON string
+	static void appendString(std::string& output, std::string_view str)
+	{
+		output += '"';
+
+		bool bNeedsEscaping = false;
+
+		for (const char c : str)
+		{
+			const uint8_t byte = static_cast<uint8_t>(c);
+
+			if (byte < 0x20 || byte >= 0x80 || c == '"' || c == '\\')
+			{
+				bNeedsEscaping = true;
+				break;
+			}
+		}
+
+		// almost all names are plain ASCII identifiers
+		if (!bNeedsEscaping)
+			output += str;
+		else
+			appendEscapedSlow(output, str);
+
+		output += '"';
+	}
+
+public:
+	void beginObject()
+	{
+		beginValue();
+		out += '{';
+		needsComma.push_back(false);
+	}
+
+	void endObject()
+	{
+		out += '}';
+		needsComma.pop_back();
+	}
+
+	void beginArray()
+	{
+		beginValue();
+		out += '[';
+		needsComma.push_back(false);
+	}
+
+	void endArray()
+	{
+		out += ']';
+		needsComma.pop_back();
+	}
+
+	void key(std::string_view name)
+	{
+		beginValue();
+		appendString(out, name);
+		out += ':';
+		bAfterKey = true;
+	}
+
+	void value(std::string_view str)
+	{
+		beginValue();
+		appendString(out, str);
+	}
+
+	void value(const char* str)
+	{
+		value(std::string_view(str));
+	}
+
+	template<std::integral T>
+	void value(T number)
+	{
+		beginValue();
+
+		char buffer[24];
+		const auto result = std::to_chars(buffer, buffer + sizeof(buffer), number);
+
+		out.append(buffer, result.ptr);
+	}
+
+	// appends an already serialized JSON value
+	void rawValue(std::string_view json)
+	{
+		beginValue();
+		out += json;
+	}
+};
@@ -5,6 +5,7 @@
 #include "MemberManager.h"
 #include "PackageManager.h"
 #include "Utils.h"
+#include "Profiler.h"
 
 inline void InitWeakObjectPtrSettings()
 {
@@ -58,6 +59,15 @@ inline void InitLargeWorldCoordinateSettings()
 	//std::cout << std::format("\nDumper-7: bUseLargeWorldCoordinates = {}\n", Settings::Internal::bUseLargeWorldCoordinates) << std::endl;
 }
 
+/* Runs 'Step' inside of a ProfilerScope, 'Name' must be a string literal */
+template<typename StepType>
+inline void RunProfiled(const char* Name, StepType&& Step)
+{
+	ProfilerScope Scope(Name);
+
+	Step();
+}
+
 inline void InitSettings()
 {
 	InitWeakObjectPtrSettings();
@@ -80,35 +90,35 @@ void Generator::InitEngineCore()
 	/* Multiversus [Unsupported, weird GObjects-struct]*/
 	//InitObjectArrayDecryption([](void* ObjPtr) -> uint8* { return reinterpret_cast<uint8*>(uint64(ObjPtr) ^ 0x1B5DEAFD6B4068C); });
 
-	ObjectArray::Init();
-	FName::Init();
-	Off::Init();
-	PropertySizes::Init();
-	Off::InSDK::ProcessEvent::InitPE(); //Must be at this position, relies on offsets initialized in Off::Init()
+	RunProfiled("ObjectArray::Init", []() { ObjectArray::Init(); });
+	RunProfiled("FName::Init", []() { FName::Init(); });
+	RunProfiled("Off::Init", []() { Off::Init(); }); // every OffsetFinder step is profiled individually
+	RunProfiled("PropertySizes::Init", []() { PropertySizes::Init(); });
+	RunProfiled("Off::InSDK::ProcessEvent::InitPE", []() { Off::InSDK::ProcessEvent::InitPE(); }); //Must be at this position, relies on offsets initialized in Off::Init()
 
-	Off::InSDK::World::InitGWorld(); //Must be at this position, relies on offsets initialized in Off::Init()
+	RunProfiled("Off::InSDK::World::InitGWorld", []() { Off::InSDK::World::InitGWorld(); }); //Must be at this position, relies on offsets initialized in Off::Init()
 
-	Off::InSDK::Text::InitTextOffsets(); //Must be at this position, relies on offsets initialized in Off::InitPE()
+	RunProfiled("Off::InSDK::Text::InitTextOffsets", []() { Off::InSDK::Text::InitTextOffsets(); }); //Must be at this position, relies on offsets initialized in Off::InitPE()
 
-	InitSettings();
+	RunProfiled("InitSettings", []() { InitSettings(); });
 }
 
 void Generator::InitInternal()
 {
 	// Initialize PackageManager with all packages, their names, structs, classes enums, functions and dependencies
-	PackageManager::Init();
+	RunProfiled("PackageManager::Init", []() { PackageManager::Init(); });
 
 	// Initialize StructManager with all structs and their names
-	StructManager::Init();
+	RunProfiled("StructManager::Init", []() { StructManager::Init(); });
 	
 	// Initialize EnumManager with all enums and their names
-	EnumManager::Init();
+	RunProfiled("EnumManager::Init", []() { EnumManager::Init(); });
 	
 	// Initialized all Member-Name collisions
-	MemberManager::Init();
+	RunProfiled("MemberManager::Init", []() { MemberManager::Init(); });
 
 	// Post-Initialize PackageManager after StructManager has been initialized. 'PostInit()' handles Cyclic-Dependencies detection
-	PackageManager::PostInit();
+	RunProfiled("PackageManager::PostInit", []() { PackageManager::PostInit(); });
 }
 
 bool Generator::SetupDumperFolder()
@@ -121,6 +131,15 @@ bool Generator::SetupDumperFolder()
 
 		DumperFolder = fs::path(Settings::Generator::SDKGenerationPath) / FolderName;
 
+		if constexpr (Settings::Generator::bOnlyWriteChangedFiles)
+		{
+			/* Files are compared against the manifest of the last run, unchanged files aren't rewritten and stale files are removed on shutdown */
+			fs::create_directories(DumperFolder);
+			OutputSink::LoadManifest(DumperFolder);
+
+			return true;
+		}
+
 		if (fs::exists(DumperFolder))
 		{
 			fs::path Old = DumperFolder.generic_string() + "_OLD";
@@ -159,7 +178,7 @@ bool Generator::SetupFolders(std::string& FolderName, fs::path& OutFolder, std::
 		OutFolder = DumperFolder / FolderName;
 		OutSubFolder = OutFolder / SubfolderName;
 				
-		if (fs::exists(OutFolder))
+		if (!Settings::Generator::bOnlyWriteChangedFiles && fs::exists(OutFolder))
 		{
 			fs::path Old = OutFolder.generic_string() + "_OLD";
 
@@ -1,10 +1,14 @@
 #pragma once
 #include <filesystem>
+#include <thread>
+#include <vector>
 
 #include "ObjectArray.h"
 #include "DependencyManager.h"
 #include "MemberManager.h"
 #include "HashStringTable.h"
+#include "OutputSink.h"
+#include "Profiler.h"
 
 
 namespace fs = std::filesystem;
@@ -45,32 +49,102 @@ public:
     static void InitEngineCore();
     static void InitInternal();
 
+    /* Empty until the first generator ran */
+    static inline const fs::path& GetDumperFolder() { return DumperFolder; }
+
 private:
     static bool SetupDumperFolder();
 
     static bool SetupFolders(std::string& FolderName, fs::path& OutFolder);
     static bool SetupFolders(std::string& FolderName, fs::path& OutFolder, std::string& SubfolderName, fs::path& OutSubFolder);
 
-public:
-    template<GeneratorImplementation GeneratorType>
-    static void Generate() 
-    { 
-        if (DumperFolder.empty())
-        {
-            if (!SetupDumperFolder())
-                return;
+private:
+    static inline bool EnsureDumperFolder()
+    {
+        if (!DumperFolder.empty())
+            return true;
+
+        if (!SetupDumperFolder())
+            return false;
+
+        ObjectArray::DumpObjects(DumperFolder);
 
-            ObjectArray::DumpObjects(DumperFolder);
-        }
+        return true;
+    }
+
+    /* Creates the folders of the generator and initializes its predefined members. Not thread-safe, called before any generator runs. */
+    template<GeneratorImplementation GeneratorType>
+    static bool PrepareGenerator()
+    {
+        ProfilerScope Scope("Generator::PrepareGenerator", []() { return GeneratorType::MainFolderName; });
 
         if (!SetupFolders(GeneratorType::MainFolderName, GeneratorType::MainFolder, GeneratorType::SubfolderName, GeneratorType::Subfolder))
-            return;
+            return false;
 
         GeneratorType::InitPredefinedMembers();
         GeneratorType::InitPredefinedFunctions();
 
+        return true;
+    }
+
+    template<GeneratorImplementation GeneratorType>
+    static void RunGenerator()
+    {
+        ProfilerScope Scope("Generator::RunGenerator", []() { return GeneratorType::MainFolderName; });
+
+        /* The lookup is per-thread (see ParallelUtils::GeneratorContext), so generators on other threads keep their own predefined members */
         MemberManager::SetPredefinedMemberLookupPtr(&GeneratorType::PredefinedMembers);
 
         GeneratorType::Generate();
+    }
+
+public:
+    template<GeneratorImplementation GeneratorType>
+    static void Generate() 
+    { 
+        if (!EnsureDumperFolder())
+            return;
+
+        if (!PrepareGenerator<GeneratorType>())
+            return;
+
+        RunGenerator<GeneratorType>();
+
+        /* Generators only write into memory, wait for all of their files to be written to disk */
+        ProfilerScope FlushScope("OutputSink::Flush");
+        OutputSink::Flush();
     };
+
+    /*
+    * Runs all generators at the same time, each one on its own thread. The output is the same as calling Generate() for each of them.
+    *
+    * Generators only read the state of the managers (ObjectArray, PackageManager, StructManager, ...) which is fully initialized by then.
+    * Folders and predefined members are still set up one generator after another, before any generator starts.
+    */
+    template<GeneratorImplementation... GeneratorTypes>
+    static void GenerateConcurrently()
+    {
+        if (!EnsureDumperFolder())
+            return;
+
+        ProfilerChildCounters GeneratorCounters;
+
+        std::vector<std::thread> GeneratorThreads;
+        GeneratorThreads.reserve(sizeof...(GeneratorTypes));
+
+        ([&]() -> void
+        {
+            if (PrepareGenerator<GeneratorTypes>())
+                GeneratorThreads.emplace_back([&]() -> void { GeneratorCounters.Run(&RunGenerator<GeneratorTypes>); });
+        }(), ...);
+
+        for (std::thread& GeneratorThread : GeneratorThreads)
+            GeneratorThread.join();
+
+        GeneratorCounters.AddToCurrentThread();
+
+        /* Generators only write into memory, wait for all of their files to be written to disk */
+        ProfilerScope FlushScope("OutputSink::Flush");
+        OutputSink::Flush();
+    }
 };
@@ -1,4 +1,5 @@
 #include "HashStringTable.h"
+#include "HotPathCounters.h"
 
 
 #pragma warning(suppress: 26495)
@@ -141,13 +142,21 @@ HashStringTableIndex HashStringTable::Find(const CharType* Str, int32 Length, ui
 
     StringBucket& Bucket = Buckets[Hash];
 
+    HotPathCounters::Add(EHotPathCounter::HashStringTableFinds);
+
+    uint64 NumProbes = 0x0;
+
     /* Try to find duplications withing 'checked' regions */
     for (auto It = HashBucketIterator::begin(Bucket); It != HashBucketIterator::end(Bucket); ++It)
     {
         const StringEntry& Entry = *It;
 
+        NumProbes++;
+
         if (Entry.Length == Length && Entry.bIsWide == bIsWchar && Strcmp(Str, Entry) == 0)
         {
+            HotPathCounters::Add(EHotPathCounter::HashStringTableProbes, NumProbes);
+
             HashStringTableIndex Idx;
             Idx.Unused = 0x0;
             Idx.HashIndex = Hash;
@@ -157,6 +166,8 @@ HashStringTableIndex HashStringTable::Find(const CharType* Str, int32 Length, ui
         }
     }
 
+    HotPathCounters::Add(EHotPathCounter::HashStringTableProbes, NumProbes);
+
     return HashStringTableIndex::FromInt(-1);
 }
 
@@ -0,0 +1,131 @@
+#include <fstream>
+#include <algorithm>
+
+#include "HotPathCounters.h"
+#include "ExternalDependencies/Dumpspace/JsonWriter.h"
+
+
+HotPathCounters::ThreadCounterBlock::ThreadCounterBlock()
+{
+	std::scoped_lock Lock(BlocksLock);
+
+	LiveBlocks.push_back(this);
+}
+
+HotPathCounters::ThreadCounterBlock::~ThreadCounterBlock()
+{
+	std::scoped_lock Lock(BlocksLock);
+
+	for (int32 i = 0; i < NumCounters; i++)
+		FinishedThreadCounts[i] += Counts[i].load(std::memory_order_relaxed);
+
+	LiveBlocks.erase(std::find(LiveBlocks.begin(), LiveBlocks.end(), this));
+}
+
+HotPathCounters::CounterValues HotPathCounters::SumAllThreads()
+{
+	CounterValues Sum = FinishedThreadCounts;
+
+	for (const ThreadCounterBlock* Block : LiveBlocks)
+	{
+		for (int32 i = 0; i < NumCounters; i++)
+			Sum[i] += Block->Counts[i].load(std::memory_order_relaxed);
+	}
+
+	return Sum;
+}
+
+HotPathCounters::CounterValues HotPathCounters::GetTotals()
+{
+	std::scoped_lock Lock(BlocksLock);
+
+	CounterValues Totals = SumAllThreads();
+
+	for (int32 i = 0; i < NumCounters; i++)
+		Totals[i] -= ResetBaseline[i];
+
+	return Totals;
+}
+
+void HotPathCounters::Reset()
+{
+	std::scoped_lock Lock(BlocksLock);
+
+	/* Counters only ever grow, remembering their sum is enough to count from zero without writing to blocks of other threads */
+	ResetBaseline = SumAllThreads();
+}
+
+const char* HotPathCounters::GetCounterName(EHotPathCounter Counter)
+{
+	switch (Counter)
+	{
+	case EHotPathCounter::ObjectArrayGetByIndex:
+		return "ObjectArrayGetByIndex";
+	case EHotPathCounter::IsBadReadPtr:
+		return "IsBadReadPtr";
+	case EHotPathCounter::FNameAppendString:
+		return "FNameAppendString";
+	case EHotPathCounter::FNameEntryDecode:
+		return "FNameEntryDecode";
+	case EHotPathCounter::FindObjectScans:
+		return "FindObjectScans";
+	case EHotPathCounter::FindObjectScannedObjects:
+		return "FindObjectScannedObjects";
+	case EHotPathCounter::HashStringTableFinds:
+		return "HashStringTableFinds";
+	case EHotPathCounter::HashStringTableProbes:
+		return "HashStringTableProbes";
+	case EHotPathCounter::GetPropertiesCalls:
+		return "GetPropertiesCalls";
+	case EHotPathCounter::GetPropertiesMaterialized:
+		return "GetPropertiesMaterialized";
+	default:
+		return "Invalid";
+	}
+}
+
+std::string HotPathCounters::CreateStatsJson(const CounterValues& Totals)
+{
+	std::string Json;
+	JsonWriter Writer(Json);
+
+	Writer.beginObject();
+
+	Writer.key("counters");
+	Writer.beginObject();
+	for (int32 i = 0; i < NumCounters; i++)
+	{
+		Writer.key(GetCounterName(static_cast<EHotPathCounter>(i)));
+		Writer.value(Totals[i]);
+	}
+	Writer.endObject();
+
+	/* Ratios in permille, to keep the file free of floating point values and easy to compare between runs */
+	const uint64 NumFinds = Totals[static_cast<int32>(EHotPathCounter::HashStringTableFinds)];
+	const uint64 NumProbes = Totals[static_cast<int32>(EHotPathCounter::HashStringTableProbes)];
+	const uint64 NumScans = Totals[static_cast<int32>(EHotPathCounter::FindObjectScans)];
+	const uint64 NumScanned = Totals[static_cast<int32>(EHotPathCounter::FindObjectScannedObjects)];
+
+	Writer.key("derived");
+	Writer.beginObject();
+	Writer.key("HashStringTableAverageProbeLengthPermille");
+	Writer.value(NumFinds > 0x0 ? (NumProbes * 1000) / NumFinds : 0x0);
+	Writer.key("FindObjectAverageScanLengthPermille");
+	Writer.value(NumScans > 0x0 ? (NumScanned * 1000) / NumScans : 0x0);
+	Writer.endObject();
+
+	Writer.endObject();
+
+	return Json;
+}
+
+void HotPathCounters::WriteStatsFile(const fs::path& Folder)
+{
+	if constexpr (!IsEnabled())
+		return;
+
+	const std::string Json = CreateStatsJson(GetTotals());
+
+	std::ofstream StatsFile(Folder / StatsFileName, std::ios::binary);
+	StatsFile.write(Json.data(), Json.size());
+}
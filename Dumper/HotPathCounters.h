@@ -0,0 +1,118 @@
+#pragma once
+#include <filesystem>
+#include <string>
+#include <array>
+#include <vector>
+#include <mutex>
+#include <atomic>
+
+#include "Enums.h"
+#include "Settings.h"
+
+namespace fs = std::filesystem;
+
+
+enum class EHotPathCounter : uint8
+{
+	/* Calls to ObjectArray::GetByIndex, this includes every step of an ObjectArray iteration */
+	ObjectArrayGetByIndex,
+
+	/* Calls to IsBadReadPtr, each one is a VirtualQuery */
+	IsBadReadPtr,
+
+	/* FName string resolutions through the games FName::AppendString/ToString */
+	FNameAppendString,
+
+	/* FName string resolutions by decoding the entry in GNames (NamePool or TNameEntryArray) */
+	FNameEntryDecode,
+
+	/* Linear scans over GObjects by FindObject, FindObjectFast and FindObjectFastInOuter, and the number of objects visited by them */
+	FindObjectScans,
+	FindObjectScannedObjects,
+
+	/* Calls to HashStringTable::Find, and the number of entries compared by them. Probes / Finds is the average probe length. */
+	HashStringTableFinds,
+	HashStringTableProbes,
+
+	/* Calls to UEStruct::GetProperties, and the number of properties put into the returned vectors */
+	GetPropertiesCalls,
+	GetPropertiesMaterialized,
+
+	Num
+};
+
+/*
+* Counts calls on hot paths (memory reads, name resolutions, lookups) to find out why a phase is slow and to catch accidental O(n^2) regressions.
+*
+* Every thread increments its own counters, which are only summed up when the results are requested.
+* Only active if Settings::Debug::bEnableHotPathCounters is set. Otherwise 'Add()' compiles to nothing.
+*/
+class HotPathCounters
+{
+private:
+	friend class HotPathCountersTest;
+
+private:
+	static constexpr int32 NumCounters = static_cast<int32>(EHotPathCounter::Num);
+
+	static constexpr const char* StatsFileName = "HotPathStats.json";
+
+public:
+	using CounterValues = std::array<uint64, NumCounters>;
+
+private:
+	/* Only ever written by its owning thread. The counters are atomic so other threads can read them while they're in use. */
+	struct alignas(0x40) ThreadCounterBlock
+	{
+		std::array<std::atomic<uint64>, NumCounters> Counts = {};
+
+		ThreadCounterBlock();
+		~ThreadCounterBlock();
+	};
+
+private:
+	static inline std::mutex BlocksLock;
+
+	/* Blocks of threads that are still running */
+	static inline std::vector<ThreadCounterBlock*> LiveBlocks;
+
+	/* Sum of the blocks of threads that already finished */
+	static inline CounterValues FinishedThreadCounts = {};
+
+	/* Sum of all threads at the last call to Reset(), subtracted from the totals. Counters are never written by other threads than their owner. */
+	static inline CounterValues ResetBaseline = {};
+
+	static inline thread_local ThreadCounterBlock ThisThreadBlock;
+
+private:
+	/* BlocksLock has to be held */
+	static CounterValues SumAllThreads();
+
+public:
+	static consteval bool IsEnabled() { return Settings::Debug::bEnableHotPathCounters; }
+
+	static inline void Add(EHotPathCounter Counter, uint64 Value = 0x1)
+	{
+		if constexpr (IsEnabled())
+		{
+			std::atomic<uint64>& Count = ThisThreadBlock.Counts[static_cast<int32>(Counter)];
+
+			/* Single writer, a plain load + store avoids the cost of a locked read-modify-write */
+			Count.store(Count.load(std::memory_order_relaxed) + Value, std::memory_order_relaxed);
+		}
+	}
+
+public:
+	/* Sum of all threads, running and finished */
+	static CounterValues GetTotals();
+
+	/* Starts counting from zero again, for all threads */
+	static void Reset();
+
+	static const char* GetCounterName(EHotPathCounter Counter);
+
+	static std::string CreateStatsJson(const CounterValues& Totals);
+
+	/* Writes HotPathStats.json to 'Folder', directly and not through the OutputSink */
+	static void WriteStatsFile(const fs::path& Folder);
+};
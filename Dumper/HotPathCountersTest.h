@@ -0,0 +1,128 @@
+#pragma once
+#include "HotPathCounters.h"
+#include "HashStringTable.h"
+#include "ExternalDependencies/Json/json.hpp"
+#include "TestBase.h"
+
+#include <thread>
+
+
+/* Resets the global counters, don't run these tests while a generator is running */
+class HotPathCountersTest : protected TestBase
+{
+private:
+	static inline uint64 GetTotal(const HotPathCounters::CounterValues& Totals, EHotPathCounter Counter)
+	{
+		return Totals[static_cast<int32>(Counter)];
+	}
+
+public:
+	template<bool bDoDebugPrinting = false>
+	static inline void TestAll()
+	{
+		if constexpr (!HotPathCounters::IsEnabled())
+		{
+			std::cout << __FUNCTION__ << ": SKIPPED! (Settings::Debug::bEnableHotPathCounters is false)" << std::endl;
+			return;
+		}
+
+		TestThreadAggregation<bDoDebugPrinting>();
+		TestHashStringTableProbes<bDoDebugPrinting>();
+		TestStatsJson<bDoDebugPrinting>();
+
+		PrintDbgMessage<bDoDebugPrinting>("");
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestThreadAggregation()
+	{
+		constexpr int32 NumThreads = 0x8;
+		constexpr uint64 NumAddsPerThread = 0x10000;
+
+		HotPathCounters::Reset();
+
+		HotPathCounters::Add(EHotPathCounter::IsBadReadPtr, 0x5);
+
+		std::vector<std::thread> Threads;
+
+		for (int32 i = 0; i < NumThreads; i++)
+		{
+			Threads.emplace_back([]()
+			{
+				for (uint64 j = 0; j < NumAddsPerThread; j++)
+					HotPathCounters::Add(EHotPathCounter::IsBadReadPtr);
+			});
+		}
+
+		for (std::thread& Thread : Threads)
+			Thread.join();
+
+		/* Finished threads, plus the still running calling thread */
+		const uint64 Total = GetTotal(HotPathCounters::GetTotals(), EHotPathCounter::IsBadReadPtr);
+		const bool bSucceeded = Total == (NumThreads * NumAddsPerThread) + 0x5;
+
+		HotPathCounters::Reset();
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> Total: {}", __FUNCTION__, Total);
+		std::cout << __FUNCTION__ << ": " << (bSucceeded ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestHashStringTableProbes()
+	{
+		bool bSucceeded = true;
+
+		HashStringTable Table;
+
+		HotPathCounters::Reset();
+
+		Table.FindOrAdd(std::string("FirstString"));
+		Table.FindOrAdd(std::string("FirstString"));
+		Table.FindOrAdd(std::string("SecondString"));
+
+		const HotPathCounters::CounterValues Totals = HotPathCounters::GetTotals();
+
+		const uint64 NumFinds = GetTotal(Totals, EHotPathCounter::HashStringTableFinds);
+		const uint64 NumProbes = GetTotal(Totals, EHotPathCounter::HashStringTableProbes);
+
+		/* One Find() per FindOrAdd(), the second lookup of "FirstString" has to compare at least one entry */
+		SetBoolIfFailed(bSucceeded, NumFinds == 0x3);
+		SetBoolIfFailed(bSucceeded, NumProbes >= 0x1 && NumProbes <= 0x3);
+
+		HotPathCounters::Reset();
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> Finds: {}, Probes: {}", __FUNCTION__, NumFinds, NumProbes);
+		std::cout << __FUNCTION__ << ": " << (bSucceeded ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestStatsJson()
+	{
+		bool bSucceeded = true;
+
+		HotPathCounters::CounterValues Totals = {};
+
+		for (int32 i = 0; i < static_cast<int32>(Totals.size()); i++)
+			Totals[i] = 0x100 + i;
+
+		const std::string Json = HotPathCounters::CreateStatsJson(Totals);
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> {}", __FUNCTION__, Json);
+
+		const nlohmann::json Parsed = nlohmann::json::parse(Json, nullptr, false);
+
+		SetBoolIfFailed(bSucceeded, !Parsed.is_discarded() && Parsed.contains("counters") && Parsed.contains("derived"));
+
+		if (bSucceeded)
+		{
+			for (int32 i = 0; i < static_cast<int32>(Totals.size()); i++)
+				SetBoolIfFailed(bSucceeded, Parsed["counters"][HotPathCounters::GetCounterName(static_cast<EHotPathCounter>(i))] == Totals[i]);
+
+			const uint64 ExpectedProbeLength = (GetTotal(Totals, EHotPathCounter::HashStringTableProbes) * 1000) / GetTotal(Totals, EHotPathCounter::HashStringTableFinds);
+
+			SetBoolIfFailed(bSucceeded, Parsed["derived"]["HashStringTableAverageProbeLengthPermille"] == ExpectedProbeLength);
+		}
+
+		std::cout << __FUNCTION__ << ": " << (bSucceeded ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+};
@@ -1,6 +1,8 @@
-#include "IDAMappingGenerator.h"
+#include <algorithm>
 
-#include <fstream>
+#include "IDAMappingGenerator.h"
+#include "ParallelUtils.h"
+#include "Profiler.h"
 
 
 std::string IDAMappingGenerator::MangleFunctionName(const std::string& ClassName, const std::string& FunctionName)
@@ -37,7 +39,7 @@ struct Identifier
 )";
 }
 
-void IDAMappingGenerator::GenerateVTableName(StreamType& IdmapFile, UEObject DefaultObject)
+void IDAMappingGenerator::CollectVTableRecord(std::vector<IdmapRecord>& OutRecords, UEObject DefaultObject)
 {
 	UEClass Class = DefaultObject.GetClass();
 	UEClass Super = Class.GetSuper().Cast<UEClass>();
@@ -45,41 +47,156 @@ void IDAMappingGenerator::GenerateVTableName(StreamType& IdmapFile, UEObject Def
 	if (Super && DefaultObject.GetVft() == Super.GetDefaultObject().GetVft())
 		return;
 
-	std::string Name = Class.GetCppName() + "_VFT";
+	const uint32 Offset = static_cast<uint32>(GetOffset(DefaultObject.GetVft()));
 
-	uint32 Offset = static_cast<uint32>(GetOffset(DefaultObject.GetVft()));
-	uint16 NameLen = static_cast<uint16>(Name.length());
-
-	WriteToStream(IdmapFile, Offset);
-	WriteToStream(IdmapFile, NameLen);
-	WriteToStream(IdmapFile, Name.c_str(), NameLen);
+	OutRecords.push_back({ Offset, Class.GetIndex(), -1, 0x0 });
 }
 
-void IDAMappingGenerator::GenerateClassFunctions(StreamType& IdmapFile, UEClass Class)
+void IDAMappingGenerator::CollectClassFunctionRecords(std::vector<IdmapRecord>& OutRecords, UEClass Class)
 {
-	static std::unordered_map<uint32, std::string> Funcs;
+	int32 FunctionNumber = 0x0;
 
 	for (UEFunction Func : Class.GetFunctions())
 	{
+		FunctionNumber++;
+
 		if (!Func.HasFlags(EFunctionFlags::Native))
 			continue;
 
-		std::string MangledName = MangleFunctionName(Class.GetCppName(), Func.GetValidName());
+		const uint32 Offset = static_cast<uint32>(GetOffset(Func.GetExecFunction()));
+
+		OutRecords.push_back({ Offset, Class.GetIndex(), Func.GetIndex(), FunctionNumber });
+	}
+}
+
+std::vector<IDAMappingGenerator::IdmapRecord> IDAMappingGenerator::CollectRecords()
+{
+	ProfilerScope Scope("IDAMappingGenerator::CollectRecords");
+
+	const int32 NumObjects = ObjectArray::Num();
+	const int32 NumTasks = (NumObjects + NumObjectsPerCollectionTask - 1) / NumObjectsPerCollectionTask;
 
-		uint32 Offset = static_cast<uint32>(GetOffset(Func.GetExecFunction()));
-		uint16 NameLen = static_cast<uint16>(MangledName.length());
+	std::vector<std::vector<IdmapRecord>> RecordsPerTask(NumTasks);
+
+	ParallelUtils::ParallelFor(NumTasks, [&](int32 TaskIndex) -> void
+	{
+		std::vector<IdmapRecord>& TaskRecords = RecordsPerTask[TaskIndex];
 
-		auto [It, bInseted] = Funcs.emplace(Offset, Func.GetFullName());
+		const int32 FirstIndex = TaskIndex * NumObjectsPerCollectionTask;
+		const int32 LastIndex = std::min(FirstIndex + NumObjectsPerCollectionTask, NumObjects);
 
-		if (!bInseted)
+		for (int32 i = FirstIndex; i < LastIndex; i++)
 		{
-			//std::cout << "Collision: \nOld: " << It->second << "\nNew: " << Func.GetFullName() << "\n" << std::endl;
-			continue;
+			UEObject Obj = ObjectArray::GetByIndex(i);
+
+			if (!Obj)
+				continue;
+
+			if (Obj.HasAnyFlags(EObjectFlags::ClassDefaultObject))
+			{
+				/* Gets the VTable offset from the default object, the name is ClassName + "_VFT" */
+				CollectVTableRecord(TaskRecords, Obj);
+			}
+			else if (Obj.IsA(EClassCastFlags::Class))
+			{
+				/* Collects all native functions of the class, their names are mangled with an "exec" prefix in front of the function name */
+				CollectClassFunctionRecords(TaskRecords, Obj.Cast<UEClass>());
+			}
 		}
+	});
+
+	size_t NumRecords = 0x0;
+	for (const std::vector<IdmapRecord>& TaskRecords : RecordsPerTask)
+		NumRecords += TaskRecords.size();
+
+	std::vector<IdmapRecord> Records;
+	Records.reserve(NumRecords);
+
+	for (const std::vector<IdmapRecord>& TaskRecords : RecordsPerTask)
+		Records.insert(Records.end(), TaskRecords.begin(), TaskRecords.end());
+
+	return Records;
+}
+
+void IDAMappingGenerator::SortAndDeduplicate(std::vector<IdmapRecord>& Records)
+{
+	ProfilerScope Scope("IDAMappingGenerator::SortAndDeduplicate");
+
+	/* VTables first, then functions in the order they were encountered in GObjects, so the same function always wins a collision */
+	std::sort(Records.begin(), Records.end(), [](const IdmapRecord& Left, const IdmapRecord& Right) -> bool
+	{
+		if (Left.Offset != Right.Offset)
+			return Left.Offset < Right.Offset;
+
+		if (Left.IsVTable() != Right.IsVTable())
+			return Left.IsVTable();
+
+		if (Left.ClassIndex != Right.ClassIndex)
+			return Left.ClassIndex < Right.ClassIndex;
+
+		return Left.FunctionNumber < Right.FunctionNumber;
+	});
+
+	/* Only functions are deduplicated, multiple functions can share an exec-function (eg. when the linker folded identical functions) */
+	auto NewEnd = std::unique(Records.begin(), Records.end(), [](const IdmapRecord& Left, const IdmapRecord& Right) -> bool
+	{
+		return !Left.IsVTable() && !Right.IsVTable() && Left.Offset == Right.Offset;
+	});
+
+	Records.erase(NewEnd, Records.end());
+}
+
+void IDAMappingGenerator::WriteRecords(StreamType& IdmapFile, const std::vector<IdmapRecord>& Records)
+{
+	ProfilerScope Scope("IDAMappingGenerator::WriteRecords");
 
-		WriteToStream(IdmapFile, Offset);
+	/* GetCppName() is comparatively expensive, it's only called once per class */
+	std::vector<int32> ClassIndices;
+	ClassIndices.reserve(Records.size());
+
+	for (const IdmapRecord& Record : Records)
+		ClassIndices.push_back(Record.ClassIndex);
+
+	std::sort(ClassIndices.begin(), ClassIndices.end());
+	ClassIndices.erase(std::unique(ClassIndices.begin(), ClassIndices.end()), ClassIndices.end());
+
+	std::vector<std::string> ClassNames(ClassIndices.size());
+
+	ParallelUtils::ParallelFor(static_cast<int32>(ClassIndices.size()), [&](int32 Index) -> void
+	{
+		ClassNames[Index] = ObjectArray::GetByIndex<UEClass>(ClassIndices[Index]).GetCppName();
+	});
+
+	auto GetClassName = [&](int32 ClassIndex) -> const std::string&
+	{
+		return ClassNames[std::lower_bound(ClassIndices.begin(), ClassIndices.end(), ClassIndex) - ClassIndices.begin()];
+	};
+
+	std::vector<std::string> Names(Records.size());
+
+	ParallelUtils::ParallelFor(static_cast<int32>(Records.size()), [&](int32 Index) -> void
+	{
+		const IdmapRecord& Record = Records[Index];
+
+		if (Record.IsVTable())
+		{
+			Names[Index] = GetClassName(Record.ClassIndex) + "_VFT";
+		}
+		else
+		{
+			Names[Index] = MangleFunctionName(GetClassName(Record.ClassIndex), ObjectArray::GetByIndex<UEFunction>(Record.FunctionIndex).GetValidName());
+		}
+	});
+
+	for (size_t i = 0; i < Records.size(); i++)
+	{
+		const std::string& Name = Names[i];
+
+		uint16 NameLen = static_cast<uint16>(Name.length());
+
+		WriteToStream(IdmapFile, Records[i].Offset);
 		WriteToStream(IdmapFile, NameLen);
-		WriteToStream(IdmapFile, MangledName.c_str(), NameLen);
+		WriteToStream(IdmapFile, Name.c_str(), NameLen);
 	}
 }
 
@@ -89,26 +206,22 @@ void IDAMappingGenerator::Generate()
 
 	FileNameHelper::MakeValidFileName(IdaMappingFileName);
 
-	/* Open the stream as binary data, else ofstream will add \r after numbers that can be interpreted as \n. */
-	std::ofstream IdmapFile(MainFolder / IdaMappingFileName, std::ios::binary);
-
 	/* Create a ReadMe to describe what '.idmap' is, and how to use it */
-	std::ofstream ReadMe(MainFolder / "ReadMe.txt");
+	StreamType ReadMe(MainFolder / "ReadMe.txt");
 
 	/* Write description of the file format, as well as a link to the IDA-Plugin */
 	WriteReadMe(ReadMe);
 
-	for (UEObject Obj : ObjectArray())
-	{
-		if (Obj.HasAnyFlags(EObjectFlags::ClassDefaultObject))
-		{
-			/* Gets the VTable offset from the default object and writes the ClassName + "_VFT" postfix to the file */
-			GenerateVTableName(IdmapFile, Obj);
-		}
-		else if (Obj.IsA(EClassCastFlags::Class))
-		{
-			/* Iterates all of the functions of the class and them to the stream with an "exec" prefix in front of the function name */
-			GenerateClassFunctions(IdmapFile, Obj.Cast<UEClass>());
-		}
-	}
+	std::vector<IdmapRecord> Records = CollectRecords();
+
+	/* Sorted by offset, which also allows the plugin to apply the names in address order */
+	SortAndDeduplicate(Records);
+
+	/* Reserve enough for the fixed-size part of all records, plus an average name length */
+	constexpr size_t EstimatedBytesPerRecord = sizeof(uint32) + sizeof(uint16) + 0x40;
+
+	/* Open the file as binary data, else newlines would be translated and \r added after numbers that can be interpreted as \n. */
+	StreamType IdmapFile(MainFolder / IdaMappingFileName, false, Records.size() * EstimatedBytesPerRecord);
+
+	WriteRecords(IdmapFile, Records);
 }
\ No newline at end of file
@@ -1,9 +1,11 @@
 #pragma once
 #include <iostream>
 #include <string>
+#include <vector>
 
 #include "PredefinedMembers.h"
 #include "ObjectArray.h"
+#include "OutputSink.h"
 
 class IDAMappingGenerator
 {
@@ -17,7 +19,29 @@ public:
     static inline fs::path Subfolder;
 
 private:
-    using StreamType = std::ofstream;
+    using StreamType = BufferedFile;
+
+private:
+    /* Number of objects collected per task, objects are split into ranges so every task produces its records in GObjects order */
+    static constexpr int32 NumObjectsPerCollectionTask = 0x4000;
+
+private:
+    /* A name in the '.idmap'. Records are collected and deduplicated first, names are only created for the records that are written. */
+    struct IdmapRecord
+    {
+        uint32 Offset;
+
+        /* Index of the class in GObjects. For VTables, this is the class of the default object. */
+        int32 ClassIndex;
+
+        /* Index of the function in GObjects, -1 for VTables */
+        int32 FunctionIndex;
+
+        /* Position of the function in Class.GetFunctions(), used to keep the first function at an offset, when multiple functions share one */
+        int32 FunctionNumber;
+
+        inline bool IsVTable() const { return FunctionIndex == -1; }
+    };
 
 private:
     template<typename InStreamType, typename T>
@@ -38,8 +62,16 @@ private:
 private:
     static void WriteReadMe(StreamType& ReadMe);
 
-    static void GenerateVTableName(StreamType& IdmapFile, UEObject DefaultObject);
-    static void GenerateClassFunctions(StreamType& IdmapFile, UEClass Class);
+    static void CollectVTableRecord(std::vector<IdmapRecord>& OutRecords, UEObject DefaultObject);
+    static void CollectClassFunctionRecords(std::vector<IdmapRecord>& OutRecords, UEClass Class);
+
+    /* Phase 1: Collects records for all VTables and native functions, in parallel */
+    static std::vector<IdmapRecord> CollectRecords();
+
+    /* Phase 2: Sorts records by offset and removes functions at an offset that's already named by another function */
+    static void SortAndDeduplicate(std::vector<IdmapRecord>& Records);
+
+    static void WriteRecords(StreamType& IdmapFile, const std::vector<IdmapRecord>& Records);
 
 public:
     static void Generate();
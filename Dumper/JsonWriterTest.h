@@ -0,0 +1,169 @@
+#pragma once
+#include "ExternalDependencies/Dumpspace/JsonWriter.h"
+#include "ExternalDependencies/Json/json.hpp"
+#include "TestBase.h"
+
+#include <chrono>
+
+
+/* JsonWriter replaced nlohmann::json in DSGen, its output has to stay byte-identical to 'nlohmann::json::dump()' */
+class JsonWriterTest : protected TestBase
+{
+private:
+	static inline std::string DumpWithNlohmann(const nlohmann::json& Json)
+	{
+		return Json.dump(-1, ' ', false, nlohmann::detail::error_handler_t::replace);
+	}
+
+	/* Strings that need escaping, plus valid, truncated and invalid UTF-8 sequences */
+	static inline const std::vector<std::string> SpecialStrings = {
+		"", "Plain_Name", "Quote\"", "Back\\slash", "Slash/", "\t\n\r\b\f", std::string("\x00\x01\x1F\x7F", 4), "\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80",
+		"\xC3", "\xC3(", "\xE2\x82", "\xED\xA0\x80", "a\xFF" "b", "\x80\x80", "\xF4\x90\x80\x80",
+	};
+
+public:
+	template<bool bDoDebugPrinting = false>
+	static inline void TestAll()
+	{
+		TestStringEscaping<bDoDebugPrinting>();
+		TestNestedValues<bDoDebugPrinting>();
+
+		PrintDbgMessage<bDoDebugPrinting>("");
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestStringEscaping()
+	{
+		bool bSucceeded = true;
+
+		for (const std::string& Str : SpecialStrings)
+		{
+			std::string Written;
+			JsonWriter::appendString(Written, Str);
+
+			const std::string Expected = DumpWithNlohmann(nlohmann::json(Str));
+
+			SetBoolIfFailed(bSucceeded, Written == Expected);
+
+			PrintDbgMessage<bDoDebugPrinting>("{} --> {} | {}", __FUNCTION__, Written, Expected);
+		}
+
+		std::cout << __FUNCTION__ << ": " << (bSucceeded ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestNestedValues()
+	{
+		/* Same layout as a member in DSGen: {"Name":[["Type","C","*",[]],Offset,Size,ArrayDim]} */
+		nlohmann::json Expected = nlohmann::json::array();
+
+		std::string Written;
+		JsonWriter Writer(Written);
+
+		Writer.beginArray();
+
+		for (int32 i = 0; i < static_cast<int32>(SpecialStrings.size()); i++)
+		{
+			const std::string& Str = SpecialStrings[i];
+
+			nlohmann::json Member;
+			Member[Str] = std::make_tuple(nlohmann::json::array({ Str, "C", "*", nlohmann::json::array() }), -i, static_cast<uint64>(0x7FF000000000) + i, 1);
+			Expected.push_back(Member);
+
+			Writer.beginObject();
+			Writer.key(Str);
+			Writer.beginArray();
+			Writer.beginArray();
+			Writer.value(Str);
+			Writer.value("C");
+			Writer.value("*");
+			Writer.beginArray();
+			Writer.endArray();
+			Writer.endArray();
+			Writer.value(-i);
+			Writer.value(static_cast<uint64>(0x7FF000000000) + i);
+			Writer.value(1);
+			Writer.endArray();
+			Writer.endObject();
+		}
+
+		Writer.endArray();
+
+		const bool bSucceeded = Written == DumpWithNlohmann(Expected);
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> {}", __FUNCTION__, Written);
+		std::cout << __FUNCTION__ << ": " << (bSucceeded ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	/* Serializes 'NumElements' class-like elements, once by building and dumping an nlohmann DOM (like DSGen used to), once with JsonWriter */
+	template<bool bDoDebugPrinting = true>
+	static inline void BenchmarkWriter(int32 NumElements = 100000)
+	{
+		auto StartTime = std::chrono::high_resolution_clock::now();
+
+		nlohmann::json Dom = nlohmann::json::array();
+
+		for (int32 i = 0; i < NumElements; i++)
+		{
+			nlohmann::json Members = nlohmann::json::array();
+
+			for (int32 j = 0; j < 20; j++)
+			{
+				nlohmann::json Member;
+				Member[std::format("Member_{}", j)] = std::make_tuple(nlohmann::json::array({ "UObject", "C", "*", nlohmann::json::array() }), j * 8, 8, 1);
+				Members.push_back(Member);
+			}
+
+			nlohmann::json Class;
+			Class[std::format("UClass_{}", i)] = Members;
+			Dom.push_back(Class);
+		}
+
+		const std::string DomOutput = DumpWithNlohmann(Dom);
+
+		const double DomTime = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - StartTime).count();
+
+		StartTime = std::chrono::high_resolution_clock::now();
+
+		std::string WriterOutput;
+		JsonWriter Writer(WriterOutput);
+
+		Writer.beginArray();
+
+		for (int32 i = 0; i < NumElements; i++)
+		{
+			Writer.beginObject();
+			Writer.key(std::format("UClass_{}", i));
+			Writer.beginArray();
+
+			for (int32 j = 0; j < 20; j++)
+			{
+				Writer.beginObject();
+				Writer.key(std::format("Member_{}", j));
+				Writer.beginArray();
+				Writer.beginArray();
+				Writer.value("UObject");
+				Writer.value("C");
+				Writer.value("*");
+				Writer.beginArray();
+				Writer.endArray();
+				Writer.endArray();
+				Writer.value(j * 8);
+				Writer.value(8);
+				Writer.value(1);
+				Writer.endArray();
+				Writer.endObject();
+			}
+
+			Writer.endArray();
+			Writer.endObject();
+		}
+
+		Writer.endArray();
+
+		const double WriterTime = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - StartTime).count();
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> {} elements, {} bytes: nlohmann DOM {:.2f}ms, JsonWriter {:.2f}ms{}", __FUNCTION__, NumElements, WriterOutput.size(),
+			DomTime, WriterTime, DomOutput == WriterOutput ? "" : " [OUTPUT DIFFERS]");
+	}
+};
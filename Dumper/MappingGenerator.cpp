@@ -4,9 +4,12 @@
 #include "ExternalDependencies/Compression/zstd.h"
 
 #include "Utils.h"
+#include "ParallelUtils.h"
+#include "Profiler.h"
 
 #include <iostream>
 #include <string>
+#include <cstring>
 
 EMappingsTypeFlags MappingGenerator::GetMappingType(UEProperty Property)
 {
@@ -130,33 +133,22 @@ EMappingsTypeFlags MappingGenerator::GetMappingType(UEProperty Property)
 	return EMappingsTypeFlags::Unknown;
 }
 
-int32 MappingGenerator::AddNameToData(std::stringstream& NameTable, const std::string& Name)
+int32 MappingGenerator::AddStructName(UsmapNameTable& NameTable, const StructWrapper& Struct)
 {
-	if constexpr (Settings::MappingGenerator::bShouldCheckForDuplicatedNames)
-	{
-		static std::unordered_map<std::string, int32> NameMap;
-		
-		auto [It, bInserted] = NameMap.insert({ Name, NameCounter });
-
-		/* The name didn't occure yet, write it to the NameTable */
-		if (bInserted)
-		{
-			WriteToStream(NameTable, static_cast<uint16>(Name.length()));
-			NameTable.write(Name.c_str(), Name.length());
-			return NameCounter++;
-		}
-
-		return It->second;
-	}
-
-	WriteToStream(NameTable, static_cast<uint16>(Name.length()));
-	NameTable.write(Name.c_str(), Name.length());
+	/* Predefined structs don't have an FName */
+	return Struct.IsUnrealStruct() ? NameTable.AddNameOf(Struct.GetUnrealStruct()) : NameTable.AddName(Struct.GetRawName());
+}
 
-	return NameCounter++;
+void MappingGenerator::WriteNameIndex(PackagePayload& Payload, int32 LocalNameIndex)
+{
+	Payload.NameIndexOffsets.push_back(static_cast<uint32>(Payload.Data.size()));
+	WriteToStream(Payload.Data, LocalNameIndex);
 }
 
-void MappingGenerator::GeneratePropertyType(UEProperty Property, std::stringstream& Data, std::stringstream& NameTable)
+void MappingGenerator::GeneratePropertyType(UEProperty Property, PackagePayload& Payload)
 {
+	std::string& Data = Payload.Data;
+
 	if (!Property)
 	{
 		WriteToStream(Data, static_cast<uint8>(EMappingsTypeFlags::Unknown));
@@ -176,42 +168,39 @@ void MappingGenerator::GeneratePropertyType(UEProperty Property, std::stringstre
 
 	if (MappingType == EMappingsTypeFlags::EnumProperty)
 	{
-		GeneratePropertyType(Property.Cast<UEEnumProperty>().GetUnderlayingProperty(), Data, NameTable);
+		GeneratePropertyType(Property.Cast<UEEnumProperty>().GetUnderlayingProperty(), Payload);
 
-		const int32 EnumNameIdx = AddNameToData(NameTable, Property.Cast<UEEnumProperty>().GetEnum().GetName());
-		WriteToStream(Data, EnumNameIdx);
+		WriteNameIndex(Payload, Payload.Names.AddNameOf(Property.Cast<UEEnumProperty>().GetEnum()));
 	}
 	else if (bIsFakeEnumProperty)
 	{
-		const int32 EnumNameIdx = AddNameToData(NameTable, Property.Cast<UEByteProperty>().GetEnum().GetName());
-		WriteToStream(Data, EnumNameIdx);
+		WriteNameIndex(Payload, Payload.Names.AddNameOf(Property.Cast<UEByteProperty>().GetEnum()));
 	}
 	else if (MappingType == EMappingsTypeFlags::StructProperty)
 	{
-		const int32 StructNameIdx = AddNameToData(NameTable, Property.Cast<UEStructProperty>().GetUnderlayingStruct().GetName());
-		WriteToStream(Data, StructNameIdx);
+		WriteNameIndex(Payload, Payload.Names.AddNameOf(Property.Cast<UEStructProperty>().GetUnderlayingStruct()));
 	}
 	else if (MappingType == EMappingsTypeFlags::SetProperty)
 	{
-		GeneratePropertyType(Property.Cast<UESetProperty>().GetElementProperty(), Data, NameTable);
+		GeneratePropertyType(Property.Cast<UESetProperty>().GetElementProperty(), Payload);
 	}
 	else if (MappingType == EMappingsTypeFlags::ArrayProperty)
 	{
-		GeneratePropertyType(Property.Cast<UEArrayProperty>().GetInnerProperty(), Data, NameTable);
+		GeneratePropertyType(Property.Cast<UEArrayProperty>().GetInnerProperty(), Payload);
 	}
 	else if (MappingType == EMappingsTypeFlags::OptionalProperty)
 	{
-		GeneratePropertyType(Property.Cast<UEOptionalProperty>().GetValueProperty(), Data, NameTable);
+		GeneratePropertyType(Property.Cast<UEOptionalProperty>().GetValueProperty(), Payload);
 	}
 	else if (MappingType == EMappingsTypeFlags::MapProperty)
 	{
 		UEMapProperty AsMapProperty = Property.Cast<UEMapProperty>();
-		GeneratePropertyType(AsMapProperty.GetKeyProperty(), Data, NameTable);
-		GeneratePropertyType(AsMapProperty.GetValueProperty(), Data, NameTable);
+		GeneratePropertyType(AsMapProperty.GetKeyProperty(), Payload);
+		GeneratePropertyType(AsMapProperty.GetValueProperty(), Payload);
 	}
 }
 
-void MappingGenerator::GeneratePropertyInfo(const PropertyWrapper& Property, std::stringstream& Data, std::stringstream& NameTable, int32& Index)
+void MappingGenerator::GeneratePropertyInfo(const PropertyWrapper& Property, PackagePayload& Payload, int32& Index)
 {
 	if (!Property.IsUnrealProperty())
 	{
@@ -219,36 +208,33 @@ void MappingGenerator::GeneratePropertyInfo(const PropertyWrapper& Property, std
 		return;
 	}
 
-	WriteToStream(Data, static_cast<uint16>(Index));
-	WriteToStream(Data, static_cast<uint8>(Property.GetArrayDim()));
+	WriteToStream(Payload.Data, static_cast<uint16>(Index));
+	WriteToStream(Payload.Data, static_cast<uint8>(Property.GetArrayDim()));
 
-	const int32 MemberNameIdx = AddNameToData(NameTable, Property.GetUnrealProperty().GetName());
-	WriteToStream(Data, MemberNameIdx);
+	WriteNameIndex(Payload, Payload.Names.AddNameOf(Property.GetUnrealProperty()));
 
-	GeneratePropertyType(Property.GetUnrealProperty(), Data, NameTable);
+	GeneratePropertyType(Property.GetUnrealProperty(), Payload);
 
 	Index += Property.GetArrayDim();
 }
 
-void MappingGenerator::GenerateStruct(const StructWrapper& Struct, std::stringstream& Data, std::stringstream& NameTable)
+void MappingGenerator::GenerateStruct(const StructWrapper& Struct, PackagePayload& Payload)
 {
 	if (!Struct.IsValid())
 		return;
 
-	const int32 StructNameIndex = AddNameToData(NameTable, Struct.GetRawName());
-	WriteToStream(Data, StructNameIndex);
+	WriteNameIndex(Payload, AddStructName(Payload.Names, Struct));
 
 	StructWrapper Super = Struct.GetSuper();
 
 	if (Super.IsValid())
 	{
-		/* Most likely adds a duplicate to the name-table. Find a better solution later! */
-		const int32 SuperNameIndex = AddNameToData(NameTable, Super.GetRawName());
-		WriteToStream(Data, SuperNameIndex);
+		/* The super was most likely added before, by its own struct or a property */
+		WriteNameIndex(Payload, AddStructName(Payload.Names, Super));
 	}
 	else
 	{
-		WriteToStream(Data, static_cast<int32>(-1));
+		WriteToStream(Payload.Data, static_cast<int32>(-1));
 	}
 
 	MemberManager Members = Struct.GetMembers();
@@ -267,8 +253,8 @@ void MappingGenerator::GenerateStruct(const StructWrapper& Struct, std::stringst
 	}
 
 	/* uint16, uint16 */
-	WriteToStream(Data, PropertyCount);
-	WriteToStream(Data, SerializablePropertyCount);
+	WriteToStream(Payload.Data, PropertyCount);
+	WriteToStream(Payload.Data, SerializablePropertyCount);
 
 	/* Incremented by 'Property->ArrayDim' inside 'GeneratePropertyInfo()' */
 	int32 IndexIncrementedByFunction = 0x0;
@@ -278,89 +264,146 @@ void MappingGenerator::GenerateStruct(const StructWrapper& Struct, std::stringst
 		if (ExcludeEditorOnlyProps && Member.HasPropertyFlags(EPropertyFlags::EditorOnly))
 			continue;
 
-		GeneratePropertyInfo(Member, Data, NameTable, IndexIncrementedByFunction);
+		GeneratePropertyInfo(Member, Payload, IndexIncrementedByFunction);
 	}
 }
 
-void MappingGenerator::GenerateEnum(const EnumWrapper& Enum, std::stringstream& Data, std::stringstream& NameTable)
+void MappingGenerator::GenerateEnum(const EnumWrapper& Enum, PackagePayload& Payload)
 {
-	const int32 EnumNameIndex = AddNameToData(NameTable, Enum.GetRawName());
-	WriteToStream(Data, EnumNameIndex);
+	WriteNameIndex(Payload, Payload.Names.AddNameOf(Enum.GetUnrealEnum()));
 
-	WriteToStream(Data, static_cast<uint16>(Enum.GetNumMembers()));
+	WriteToStream(Payload.Data, static_cast<uint16>(Enum.GetNumMembers()));
 
 	for (EnumCollisionInfo Member : Enum.GetMembers())
 	{
-		const int32 EnumMemberNameIdx = AddNameToData(NameTable, Member.GetUniqueName());
-		WriteToStream(Data, EnumMemberNameIdx);
+		WriteNameIndex(Payload, Payload.Names.AddName(Member.GetUniqueName()));
+	}
+}
+
+void MappingGenerator::GeneratePackage(PackageInfoHandle Package, PackagePayload& OutEnums, PackagePayload& OutStructs)
+{
+	ProfilerScope Scope("MappingGenerator::GeneratePackage", [&]() { return Package.GetName(); });
+
+	if (Package.HasEnums())
+	{
+		for (int32 EnumIdx : Package.GetEnums())
+		{
+			GenerateEnum(ObjectArray::GetByIndex<UEEnum>(EnumIdx), OutEnums);
+			OutEnums.NumEntries++;
+		}
+	}
+
+	/* From the mapping-files point of view classes are the exact same as structs. */
+	if (!Package.HasClasses() && !Package.HasStructs())
+		return;
+
+	DependencyManager::OnVisitCallbackType GenerateStructCallback = [&OutStructs](int32 Index) -> void
+	{
+		GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index), OutStructs);
+		OutStructs.NumEntries++;
+	};
+
+	if (Package.HasStructs())
+	{
+		const DependencyManager& Structs = Package.GetSortedStructs();
+		Structs.VisitAllNodesWithCallback(GenerateStructCallback);
+	}
+
+	if (Package.HasClasses())
+	{
+		const DependencyManager& Classes = Package.GetSortedClasses();
+		Classes.VisitAllNodesWithCallback(GenerateStructCallback);
 	}
 }
 
+void MappingGenerator::MergePayload(PackagePayload& Payload, UsmapNameTable& NameTable, std::string& OutData)
+{
+	const std::vector<int32> GlobalNameIndices = Payload.Names.MergeInto(NameTable);
+
+	char* Data = Payload.Data.data();
+
+	for (const uint32 Offset : Payload.NameIndexOffsets)
+	{
+		int32 LocalNameIndex = 0x0;
+		memcpy(&LocalNameIndex, Data + Offset, sizeof(int32));
+		memcpy(Data + Offset, &GlobalNameIndices[LocalNameIndex], sizeof(int32));
+	}
+
+	OutData += Payload.Data;
+
+	/* Release the memory of the package early, the combined payload is about as large as all package-payloads together */
+	Payload.Data = std::string();
+	Payload.NameIndexOffsets = std::vector<uint32>();
+}
+
 
-std::stringstream MappingGenerator::GenerateFileData()
+std::string MappingGenerator::GenerateFileData(uint32 NumThreads)
 {
-	std::stringstream NameData;
-	std::stringstream StructData;
-	std::stringstream EnumData;
+	ProfilerScope Scope("MappingGenerator::GenerateFileData");
 
-	uint32 NumEnums = 0x0;
-	uint32 NumStructsAndClasse = 0x0;
+	constexpr bool bCheckForDuplicatedNames = Settings::MappingGenerator::bShouldCheckForDuplicatedNames;
+
+	/* Collect all packages up front, 'IterateOverPackageInfos()' must not be used from multiple threads */
+	std::vector<PackageInfoHandle> Packages;
+	Packages.reserve(PackageManager::GetPackageInfos().size());
 
-	/* Handle all Enums first */
 	for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
 	{
-		if (Package.IsEmpty())
-			continue;
+		if (!Package.IsEmpty())
+			Packages.push_back(Package);
+	}
 
-		/* Create files and handles namespaces and includes */
-		if (!Package.HasEnums())
-			continue;
+	std::vector<PackagePayload> EnumPayloads;
+	std::vector<PackagePayload> StructPayloads;
+	EnumPayloads.reserve(Packages.size());
+	StructPayloads.reserve(Packages.size());
 
-		for (int32 EnumIdx : Package.GetEnums())
-		{
-			GenerateEnum(ObjectArray::GetByIndex<UEEnum>(EnumIdx), EnumData, NameData);
-			NumEnums++;
-		}
+	for (size_t i = 0; i < Packages.size(); i++)
+	{
+		EnumPayloads.emplace_back(bCheckForDuplicatedNames);
+		StructPayloads.emplace_back(bCheckForDuplicatedNames);
 	}
-	
-	/* Handle all structs and classes in one go. From the mapping-files point of view classes are the exact same as structs. */
-	for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
+
+	ParallelUtils::ParallelFor(static_cast<int32>(Packages.size()), [&](int32 Index) -> void
 	{
-		if (Package.IsEmpty())
-			continue;
+		GeneratePackage(Packages[Index], EnumPayloads[Index], StructPayloads[Index]);
+	}, NumThreads);
 
-		/* Create files and handles namespaces and includes */
-		if (!Package.HasClasses() && !Package.HasStructs())
-			continue;
+	/* Scoped to this generation, indices of a previous run are never reused */
+	UsmapNameTable NameTable(bCheckForDuplicatedNames);
 
-		DependencyManager::OnVisitCallbackType GenerateStructCallback = [&](int32 Index) -> void
-		{
-			GenerateStruct(ObjectArray::GetByIndex<UEStruct>(Index), StructData, NameData);
-			NumStructsAndClasse++;
-		};
+	std::string StructData;
+	std::string EnumData;
 
-		if (Package.HasStructs())
-		{
-			const DependencyManager& Structs = Package.GetSortedStructs();
-			Structs.VisitAllNodesWithCallback(GenerateStructCallback);
-		}
+	uint32 NumEnums = 0x0;
+	uint32 NumStructsAndClasse = 0x0;
 
-		if (Package.HasClasses())
-		{
-			const DependencyManager& Classes = Package.GetSortedClasses();
-			Classes.VisitAllNodesWithCallback(GenerateStructCallback);
-		}
+	/*
+	* Merge in the same order the names were encountered when the file was generated on a single thread, all enums first, then all structs.
+	* Every package adds its names in the order of their first use, so the name-table and all indices are byte-identical to serial generation.
+	*/
+	for (PackagePayload& Payload : EnumPayloads)
+	{
+		MergePayload(Payload, NameTable, EnumData);
+		NumEnums += Payload.NumEntries;
 	}
 
-	/* Combine all of the stringstreams into one Data block representing the entire payload of the file */
-	std::stringstream ReturnBuffer;
+	for (PackagePayload& Payload : StructPayloads)
+	{
+		MergePayload(Payload, NameTable, StructData);
+		NumStructsAndClasse += Payload.NumEntries;
+	}
+
+	/* Combine all of the buffers into one Data block representing the entire payload of the file */
+	std::string ReturnBuffer;
+	ReturnBuffer.reserve(sizeof(uint32) * 3 + NameTable.GetData().size() + EnumData.size() + StructData.size());
 
 	/* Write Name-count and names */
-	WriteToStream(ReturnBuffer, static_cast<uint32>(NameCounter));
-	WriteToStream(ReturnBuffer, NameData);
+	WriteToStream(ReturnBuffer, static_cast<uint32>(NameTable.GetNumNames()));
+	WriteToStream(ReturnBuffer, NameTable.GetData());
 
 	if constexpr (Settings::Debug::bShouldPrintMappingDebugData)
-		std::cout << std::format("MappingGeneration: NameCounter = 0x{0:X} (Dec: {0})\n", static_cast<uint32>(NameCounter));
+		std::cout << std::format("MappingGeneration: NumNames = 0x{0:X} (Dec: {0})\n", static_cast<uint32>(NameTable.GetNumNames()));
 
 	/* Write Enum-count and enums */
 	WriteToStream(ReturnBuffer, static_cast<uint32>(NumEnums));
@@ -379,9 +422,66 @@ std::stringstream MappingGenerator::GenerateFileData()
 	return ReturnBuffer;
 }
 
+std::string MappingGenerator::GenerateFileData()
+{
+	return GenerateFileData(Settings::MappingGenerator::bGeneratePackagesInParallel ? Settings::MappingGenerator::NumGeneratorThreads : 1);
+}
+
 
-void MappingGenerator::GenerateFileHeader(StreamType& InUsmap, const std::stringstream& Data)
+bool MappingGenerator::CompressZStandard(const std::string& Data, std::string& OutCompressed, int32 CompressionLevel, uint32 NumWorkers, bool bUseLongDistanceMatching)
 {
+	ProfilerScope Scope("MappingGenerator::CompressZStandard");
+
+	OutCompressed.clear();
+
+	ZSTD_CCtx* Context = ZSTD_createCCtx();
+
+	if (!Context)
+		return false;
+
+	ZSTD_CCtx_setParameter(Context, ZSTD_c_compressionLevel, CompressionLevel);
+	ZSTD_CCtx_setParameter(Context, ZSTD_c_enableLongDistanceMatching, bUseLongDistanceMatching ? 1 : 0);
+
+	/* Workers compress jobs of the input in parallel. The output is the same for any NumWorkers > 0, but differs from single-threaded compression. */
+	if (NumWorkers > 0)
+		ZSTD_CCtx_setParameter(Context, ZSTD_c_nbWorkers, static_cast<int>(NumWorkers));
+
+	ZSTD_CCtx_setPledgedSrcSize(Context, Data.size());
+
+	/* With an output buffer of 'ZSTD_compressBound()' bytes compression can always complete without having to grow the buffer */
+	OutCompressed.resize(ZSTD_compressBound(Data.size()));
+
+	ZSTD_inBuffer Input = { Data.data(), Data.size(), 0x0 };
+	ZSTD_outBuffer Output = { OutCompressed.data(), OutCompressed.size(), 0x0 };
+
+	size_t NumBytesLeftToFlush = 0x0;
+
+	do
+	{
+		NumBytesLeftToFlush = ZSTD_compressStream2(Context, &Output, &Input, ZSTD_e_end);
+
+		if (ZSTD_isError(NumBytesLeftToFlush))
+		{
+			std::cout << std::format("MappingGeneration: ZStandard compression failed! Error: {}\n", ZSTD_getErrorName(NumBytesLeftToFlush));
+
+			ZSTD_freeCCtx(Context);
+			OutCompressed.clear();
+
+			return false;
+		}
+	} while (NumBytesLeftToFlush != 0x0);
+
+	ZSTD_freeCCtx(Context);
+
+	OutCompressed.resize(Output.pos);
+
+	return true;
+}
+
+void MappingGenerator::GenerateFileHeader(StreamType& InUsmap, const std::string& Data)
+{
+	namespace MappingSettings = Settings::MappingGenerator;
+
 	/* Write 2bytes unsigned */
 	WriteToStream(InUsmap, UsmapFileMagic);
 
@@ -391,58 +491,58 @@ void MappingGenerator::GenerateFileHeader(StreamType& InUsmap, const std::string
 	/* We're on 'LargeEnums' version, we need to write 'bool' (aka int32) bHasVersioning. (NoVersioning = false) -> no [int32 UE4Version, int32 UE5Version] and no [uint32 NetCL] */
 	WriteToStream(InUsmap, static_cast<int32>(false));
 
-	const uint32 UncompressedSize = static_cast<uint32>(Data.str().length());
+	const uint32 UncompressedSize = static_cast<uint32>(Data.length());
 
-	constexpr auto CompressionMethod = Settings::MappingGenerator::CompressionMethod;
+	EUsmapCompressionMethod CompressionMethod = MappingSettings::CompressionMethod;
 
-	/* Write 'CompressionMethod' to the compression byte */
-	WriteToStream(InUsmap, static_cast<uint8>(CompressionMethod));
+	std::string CompressedData;
 
-	size_t CompressedSize = UncompressedSize;
-	void* CompressedBuffer = nullptr;
+	if (CompressionMethod == EUsmapCompressionMethod::ZStandard)
+	{
+		const uint32 NumWorkers = ParallelUtils::GetNumWorkerThreads(MappingSettings::NumCompressionThreads);
 
-	switch (CompressionMethod)
+		/* Write the file uncompressed, rather than not at all */
+		if (!CompressZStandard(Data, CompressedData, MappingSettings::ZStandardCompressionLevel, NumWorkers, MappingSettings::bUseLongDistanceMatching))
+			CompressionMethod = EUsmapCompressionMethod::None;
+	}
+	else if (CompressionMethod != EUsmapCompressionMethod::None)
 	{
-	case EUsmapCompressionMethod::ZStandard:
-		CompressedSize = ZSTD_compressBound(UncompressedSize);
-		CompressedBuffer = malloc(CompressedSize);
-		CompressedSize = ZSTD_compress(CompressedBuffer, CompressedSize, Data.str().data(), UncompressedSize, ZSTD_maxCLevel());
-		break;
-	default:
-		CompressedBuffer = malloc(CompressedSize);
-		memcpy(CompressedBuffer, Data.str().data(), CompressedSize);
-		break;
+		/* Oodle and Brotli aren't supported, write the data uncompressed */
+		CompressionMethod = EUsmapCompressionMethod::None;
 	}
 
+	const std::string& Payload = CompressionMethod == EUsmapCompressionMethod::None ? Data : CompressedData;
+
+	/* Write 'CompressionMethod' to the compression byte */
+	WriteToStream(InUsmap, static_cast<uint8>(CompressionMethod));
+
 	if constexpr (Settings::Debug::bShouldPrintMappingDebugData)
 	{
-		std::cout << std::format("MappingGeneration: CompressedSize = 0x{0:X} (Dec: {0})\n", CompressedSize);
+		std::cout << std::format("MappingGeneration: CompressedSize = 0x{0:X} (Dec: {0})\n", Payload.size());
 		std::cout << std::format("MappingGeneration: DecompressedSize = 0x{0:X} (Dec: {0})\n\n", UncompressedSize);
 	}
 
 	/* Write compressed size */
-	WriteToStream(InUsmap, static_cast<uint32>(CompressedSize));
+	WriteToStream(InUsmap, static_cast<uint32>(Payload.size()));
 
 	/* Write uncompressed size */
 	WriteToStream(InUsmap, UncompressedSize);
 
 	/* Header is done, now write the payload to the file */
-	InUsmap.write(static_cast<const char*>(CompressedBuffer), static_cast<uint32>(CompressedSize));
+	InUsmap.write(Payload.data(), Payload.size());
 }
 
 void MappingGenerator::Generate()
 {
-	NameCounter = 0x0;
-
 	std::string MappingsFileName = (Settings::Generator::GameVersion + '-' + Settings::Generator::GameName + ".usmap");
 
 	FileNameHelper::MakeValidFileName(MappingsFileName);
 
-	/* Open the stream as binary data, else ofstream will add \r after numbers that can be interpreted as \n. */
-	std::ofstream UsmapFile(MainFolder / MappingsFileName, std::ios::binary);
+	/* Open the file as binary data, else newlines would be translated and \r added after numbers that can be interpreted as \n. */
+	StreamType UsmapFile(MainFolder / MappingsFileName, false);
 
 	/* Generate the payload of the file, containing all of the names, enums and structs. */
-	std::stringstream FileData = GenerateFileData();
+	std::string FileData = GenerateFileData();
 
 	/* Generate the header, and write both header and payload into the file. */
 	GenerateFileHeader(UsmapFile, FileData);
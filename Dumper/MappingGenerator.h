@@ -2,8 +2,12 @@
 #include "ObjectArray.h"
 #include "MemberWrappers.h"
 #include "EnumWrapper.h"
+#include "PackageManager.h"
+#include "OutputSink.h"
+#include "UsmapNameTable.h"
 
-#include <fstream>
+#include <string>
+#include <vector>
 
 /*
 * USMAP-Header:
@@ -61,7 +65,11 @@
 class MappingGenerator
 {
 private:
-    using StreamType = std::ofstream;
+    friend class MappingGeneratorTest;
+    friend class UsmapReaderTest;
+
+private:
+    using StreamType = BufferedFile;
 
 private:
     enum class EUsmapVersion : uint8
@@ -82,11 +90,31 @@ private:
         LatestPlusOne,
     };
 
+    /*
+    * Serialized enums, or structs, of a single package.
+    * 
+    * Name-indices in 'Data' refer to the package-local 'Names' until the payload is merged into the file, which replaces them by global indices.
+    */
+    struct PackagePayload
+    {
+        std::string Data;
+        UsmapNameTable Names;
+
+        /* Offsets of all int32 name-indices in 'Data' */
+        std::vector<uint32> NameIndexOffsets;
+
+        uint32 NumEntries = 0x0;
+
+        PackagePayload(bool bCheckForDuplicates)
+            : Names(bCheckForDuplicates, DefaultReserveNumNamesPerPackage)
+        {
+        }
+    };
+
 private:
     static constexpr uint16 UsmapFileMagic = 0x30C4;
 
-private:
-    static inline uint64 NameCounter = 0x0;
+    static constexpr size_t DefaultReserveNumNamesPerPackage = 0x100;
 
 public:
     static inline PredefinedMemberLookupMapType PredefinedMembers;
@@ -104,26 +132,54 @@ private:
         InStream.write(reinterpret_cast<const char*>(&Value), sizeof(T));
     }
 
-    template<typename InStreamType>
-    static void WriteToStream(InStreamType& InStream, const std::stringstream& Data)
+    /* All data is built in contiguous buffers, which are appended to each other and compressed without any further copies */
+    template<typename T>
+    static void WriteToStream(std::string& Buffer, T Value)
+    {
+        Buffer.append(reinterpret_cast<const char*>(&Value), sizeof(T));
+    }
+
+    static void WriteToStream(std::string& Buffer, const std::string& Data)
     {
-        InStream << Data.rdbuf();
+        Buffer += Data;
     }
 
 private:
     /* Utility Functions */
     static EMappingsTypeFlags GetMappingType(UEProperty Property);
-    static int32 AddNameToData(std::stringstream& NameTable, const std::string& Name);
+    static int32 AddStructName(UsmapNameTable& NameTable, const StructWrapper& Struct);
 
-private:
-    static void GeneratePropertyType(UEProperty Property, std::stringstream& Data, std::stringstream& NameTable);
-    static void GeneratePropertyInfo(const PropertyWrapper& Property, std::stringstream& Data, std::stringstream& NameTable, int32& Index);
-
-    static void GenerateStruct(const StructWrapper& Struct, std::stringstream& Data, std::stringstream& NameTable);
-    static void GenerateEnum(const EnumWrapper& Enum, std::stringstream& Data, std::stringstream& NameTable);
+    /* Writes a package-local name-index and records its offset, to be remapped to a global index later */
+    static void WriteNameIndex(PackagePayload& Payload, int32 LocalNameIndex);
 
-    static std::stringstream GenerateFileData();
-    static void GenerateFileHeader(StreamType& InUsmap, const std::stringstream& Data);
+private:
+    static void GeneratePropertyType(UEProperty Property, PackagePayload& Payload);
+    static void GeneratePropertyInfo(const PropertyWrapper& Property, PackagePayload& Payload, int32& Index);
+
+    static void GenerateStruct(const StructWrapper& Struct, PackagePayload& Payload);
+    static void GenerateEnum(const EnumWrapper& Enum, PackagePayload& Payload);
+
+    /* Serializes all enums, and all structs/classes, of the package. Packages are independent of each other and can be generated on any thread. */
+    static void GeneratePackage(PackageInfoHandle Package, PackagePayload& OutEnums, PackagePayload& OutStructs);
+
+    /* Adds the names of 'Payload' to 'NameTable', replaces its local name-indices by global ones and appends its data to 'OutData' */
+    static void MergePayload(PackagePayload& Payload, UsmapNameTable& NameTable, std::string& OutData);
+
+    /*
+    * Generates the payload of the file on 'NumThreads' threads (0 -> all hardware threads, 1 -> calling thread only).
+    * 
+    * Payloads of packages are merged in package order, so the output is byte-identical for any number of threads.
+    */
+    static std::string GenerateFileData(uint32 NumThreads);
+    static std::string GenerateFileData();
+    static void GenerateFileHeader(StreamType& InUsmap, const std::string& Data);
+
+    /*
+    * Compresses 'Data' with the streaming API of zstd, using 'NumWorkers' threads and optional long-distance-matching.
+    * 
+    * NumWorkers == 0 -> compress on the calling thread. Returns false, and leaves 'OutCompressed' empty, if compression failed.
+    */
+    static bool CompressZStandard(const std::string& Data, std::string& OutCompressed, int32 CompressionLevel, uint32 NumWorkers, bool bUseLongDistanceMatching);
 
 public:
     static void Generate();
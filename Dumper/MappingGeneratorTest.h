@@ -0,0 +1,280 @@
+#pragma once
+#include "MappingGenerator.h"
+#include "ParallelUtils.h"
+#include "TestBase.h"
+#include "ExternalDependencies/Compression/zstd.h"
+
+#include <chrono>
+
+
+class MappingGeneratorTest : protected TestBase
+{
+private:
+	static inline bool DecompressZStandard(const std::string& Compressed, size_t UncompressedSize, std::string& OutData)
+	{
+		OutData.resize(UncompressedSize);
+
+		const size_t NumBytesDecompressed = ZSTD_decompress(OutData.data(), OutData.size(), Compressed.data(), Compressed.size());
+
+		return !ZSTD_isError(NumBytesDecompressed) && NumBytesDecompressed == UncompressedSize;
+	}
+
+public:
+	template<bool bDoDebugPrinting = false>
+	static inline void TestAll()
+	{
+		TestCompressionRoundTrip<bDoDebugPrinting>();
+		TestNameTableDeduplication<bDoDebugPrinting>();
+		TestNameTableMerge<bDoDebugPrinting>();
+
+		PrintDbgMessage<bDoDebugPrinting>("");
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestCompressionRoundTrip()
+	{
+		/* Name-table like data, many short and repeated strings */
+		std::string Data;
+
+		for (int32 i = 0; i < 0x40000; i++)
+		{
+			const std::string Name = std::format("SyntheticName_{}", (i * 7919) % 0x1000);
+
+			MappingGenerator::WriteToStream(Data, static_cast<uint16>(Name.size()));
+			Data += Name;
+		}
+
+		bool bSucceeded = true;
+
+		for (const uint32 NumWorkers : { 0u, 4u })
+		{
+			for (const bool bUseLongDistanceMatching : { false, true })
+			{
+				std::string Compressed;
+				std::string Decompressed;
+
+				SetBoolIfFailed(bSucceeded, MappingGenerator::CompressZStandard(Data, Compressed, 3, NumWorkers, bUseLongDistanceMatching));
+				SetBoolIfFailed(bSucceeded, DecompressZStandard(Compressed, Data.size(), Decompressed) && Decompressed == Data);
+
+				PrintDbgMessage<bDoDebugPrinting>("{} --> Workers: {}, LDM: {}, Size: 0x{:X} -> 0x{:X}", __FUNCTION__, NumWorkers, bUseLongDistanceMatching, Data.size(), Compressed.size());
+			}
+		}
+
+		std::cout << __FUNCTION__ << ": " << (bSucceeded ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestNameTableDeduplication()
+	{
+		bool bSucceeded = true;
+
+		UsmapNameTable NameTable;
+
+		SetBoolIfFailed(bSucceeded, NameTable.AddName(std::string("Engine")) == 0);
+		SetBoolIfFailed(bSucceeded, NameTable.AddName(std::string("Actor")) == 1);
+		SetBoolIfFailed(bSucceeded, NameTable.AddName(std::string("Engine")) == 0);
+		SetBoolIfFailed(bSucceeded, NameTable.GetNumNames() == 2);
+
+		std::string ExpectedData;
+		MappingGenerator::WriteToStream(ExpectedData, static_cast<uint16>(6));
+		ExpectedData += "Engine";
+		MappingGenerator::WriteToStream(ExpectedData, static_cast<uint16>(5));
+		ExpectedData += "Actor";
+
+		SetBoolIfFailed(bSucceeded, NameTable.GetData() == ExpectedData);
+
+		/* A new table starts at index 0 again */
+		UsmapNameTable SecondNameTable;
+		SetBoolIfFailed(bSucceeded, SecondNameTable.AddName(std::string("Actor")) == 0);
+
+		/* Without duplicate-checks every name is written */
+		UsmapNameTable TableWithDuplicates(false);
+		TableWithDuplicates.AddName(std::string("Engine"));
+		SetBoolIfFailed(bSucceeded, TableWithDuplicates.AddName(std::string("Engine")) == 1);
+
+		std::cout << __FUNCTION__ << ": " << (bSucceeded ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestNameTableMerge()
+	{
+		const std::vector<std::vector<std::string>> PackageNames = {
+			{ "Engine", "Actor", "Vector" },
+			{ "CoreUObject", "Vector", "Object" },
+			{ "Actor", "Engine", "Pawn", "Pawn" },
+		};
+
+		bool bSucceeded = true;
+
+		for (const bool bCheckForDuplicates : { true, false })
+		{
+			/* All names added to one table, like single-threaded generation */
+			UsmapNameTable DirectTable(bCheckForDuplicates);
+			std::vector<int32> DirectIndices;
+
+			for (const std::vector<std::string>& Names : PackageNames)
+			{
+				for (const std::string& Name : Names)
+					DirectIndices.push_back(DirectTable.AddName(Name));
+			}
+
+			/* One table per package, merged in package order */
+			UsmapNameTable MergedTable(bCheckForDuplicates);
+			std::vector<int32> MergedIndices;
+
+			for (const std::vector<std::string>& Names : PackageNames)
+			{
+				UsmapNameTable PackageTable(bCheckForDuplicates);
+				std::vector<int32> LocalIndices;
+
+				for (const std::string& Name : Names)
+					LocalIndices.push_back(PackageTable.AddName(Name));
+
+				const std::vector<int32> GlobalIndices = PackageTable.MergeInto(MergedTable);
+
+				for (const int32 LocalIndex : LocalIndices)
+					MergedIndices.push_back(GlobalIndices[LocalIndex]);
+			}
+
+			SetBoolIfFailed(bSucceeded, DirectTable.GetData() == MergedTable.GetData());
+			SetBoolIfFailed(bSucceeded, DirectTable.GetNumNames() == MergedTable.GetNumNames());
+			SetBoolIfFailed(bSucceeded, DirectIndices == MergedIndices);
+
+			PrintDbgMessage<bDoDebugPrinting>("{} --> CheckForDuplicates: {}, NumNames: {}", __FUNCTION__, bCheckForDuplicates, MergedTable.GetNumNames());
+		}
+
+		std::cout << __FUNCTION__ << ": " << (bSucceeded ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	/*
+	* Generates the mappings of the current game on a single thread and on all threads, the output needs to be byte-identical.
+	*
+	* Requires an initialized PackageManager, StructManager and EnumManager.
+	*/
+	template<bool bDoDebugPrinting = false>
+	static inline void TestParallelGenerationMatchesSerial()
+	{
+		const std::string SerialData = MappingGenerator::GenerateFileData(1);
+		const std::string ParallelData = MappingGenerator::GenerateFileData(0);
+
+		const bool bSucceeded = !SerialData.empty() && SerialData == ParallelData;
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> Serial size: 0x{:X}, Parallel size: 0x{:X}", __FUNCTION__, SerialData.size(), ParallelData.size());
+		std::cout << __FUNCTION__ << ": " << (bSucceeded ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	/* Times the generation of the usmap payload of the current game, on a single thread and on all threads */
+	template<bool bDoDebugPrinting = true>
+	static inline void BenchmarkParallelGeneration()
+	{
+		for (const uint32 NumThreads : { 1u, 0u })
+		{
+			auto StartTime = std::chrono::high_resolution_clock::now();
+
+			const std::string Data = MappingGenerator::GenerateFileData(NumThreads);
+
+			const double Time = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - StartTime).count();
+
+			PrintDbgMessage<bDoDebugPrinting>("{} --> {} thread(s): 0x{:X} bytes in {:.2f}ms", __FUNCTION__, ParallelUtils::GetNumWorkerThreads(NumThreads), Data.size(), Time);
+		}
+	}
+
+	/*
+	* Generates the mappings of the current game twice, the second run needs to produce the exact same data.
+	*
+	* Requires an initialized PackageManager, StructManager and EnumManager.
+	*/
+	template<bool bDoDebugPrinting = false>
+	static inline void TestRepeatedGenerationIsIdentical()
+	{
+		const std::string FirstData = MappingGenerator::GenerateFileData();
+		const std::string SecondData = MappingGenerator::GenerateFileData();
+
+		const bool bSucceeded = !FirstData.empty() && FirstData == SecondData;
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> Size: 0x{:X}", __FUNCTION__, FirstData.size());
+		std::cout << __FUNCTION__ << ": " << (bSucceeded ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	/*
+	* Adds the names of all structs and their properties in GObjects to a name-table, once by FName and once by string (like the old
+	* 'AddNameToData'). Both tables need to be identical. Also times a full 'GenerateFileData()'.
+	*/
+	template<bool bDoDebugPrinting = true>
+	static inline void BenchmarkNameTable()
+	{
+		std::vector<UEStruct> Structs;
+
+		for (UEObject Obj : ObjectArray())
+		{
+			if (Obj.IsA(EClassCastFlags::Struct))
+				Structs.push_back(Obj.Cast<UEStruct>());
+		}
+
+		auto BuildNameTable = [&Structs](UsmapNameTable& NameTable, auto&& AddNameFunc) -> double
+		{
+			auto StartTime = std::chrono::high_resolution_clock::now();
+
+			for (UEStruct Struct : Structs)
+			{
+				AddNameFunc(NameTable, Struct);
+
+				for (UEProperty Property : Struct.GetProperties())
+					AddNameFunc(NameTable, Property);
+			}
+
+			return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - StartTime).count();
+		};
+
+		UsmapNameTable ByString;
+		UsmapNameTable ByFName;
+
+		const double StringTime = BuildNameTable(ByString, [](UsmapNameTable& NameTable, const auto& Object) { NameTable.AddName(Object.GetName()); });
+		const double FNameTime = BuildNameTable(ByFName, [](UsmapNameTable& NameTable, const auto& Object) { NameTable.AddNameOf(Object); });
+
+		const bool bTablesMatch = ByString.GetData() == ByFName.GetData();
+
+		auto StartTime = std::chrono::high_resolution_clock::now();
+
+		const std::string Data = MappingGenerator::GenerateFileData();
+
+		const double GenerationTime = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - StartTime).count();
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> {} structs, {} unique names (0x{:X} bytes): by string {:.2f}ms, by FName {:.2f}ms{}", __FUNCTION__,
+			Structs.size(), ByFName.GetNumNames(), ByFName.GetData().size(), StringTime, FNameTime, bTablesMatch ? "" : " [TABLES DIFFER]");
+		PrintDbgMessage<bDoDebugPrinting>("{} --> GenerateFileData: 0x{:X} bytes in {:.2f}ms", __FUNCTION__, Data.size(), GenerationTime);
+	}
+
+	/*
+	* Compresses the mappings of the current game at several levels, once single-threaded (like 'ZSTD_compress') and once with
+	* the settings used by the MappingGenerator (all worker-threads, long-distance-matching).
+	*
+	* Requires an initialized PackageManager, StructManager and EnumManager.
+	*/
+	template<bool bDoDebugPrinting = true>
+	static inline void BenchmarkCompressionLevels()
+	{
+		const std::string Data = MappingGenerator::GenerateFileData();
+
+		const uint32 NumWorkers = ParallelUtils::GetNumWorkerThreads(Settings::MappingGenerator::NumCompressionThreads);
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> Uncompressed size: {} bytes, {} worker-threads", __FUNCTION__, Data.size(), NumWorkers);
+
+		for (const int32 Level : { 1, 3, 6, 9, 15, 19, 22 })
+		{
+			for (const bool bMultiThreaded : { false, true })
+			{
+				std::string Compressed;
+
+				auto StartTime = std::chrono::high_resolution_clock::now();
+
+				const bool bSucceeded = MappingGenerator::CompressZStandard(Data, Compressed, Level, bMultiThreaded ? NumWorkers : 0, bMultiThreaded && Settings::MappingGenerator::bUseLongDistanceMatching);
+
+				const double Time = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - StartTime).count();
+
+				PrintDbgMessage<bDoDebugPrinting>("{} --> Level {:2} {:15}: {:10} bytes (ratio {:5.2f}) in {:9.2f}ms{}", __FUNCTION__, Level, bMultiThreaded ? "[MT + LDM]" : "[single-thread]",
+					Compressed.size(), static_cast<double>(Data.size()) / (Compressed.empty() ? 1 : Compressed.size()), Time, bSucceeded ? "" : " FAILED");
+			}
+		}
+	}
+};
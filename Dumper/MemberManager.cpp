@@ -13,6 +13,8 @@ MemberManager::MemberManager(UEStruct Str)
 	std::sort(Functions.begin(), Functions.end(), CompareUnrealFunctions);
 	std::sort(Members.begin(), Members.end(), CompareUnrealProperties);
 
+	const PredefinedMemberLookupMapType* PredefinedMemberLookup = GetPredefinedMemberLookupPtr();
+
 	if (!PredefinedMemberLookup)
 		return;
 
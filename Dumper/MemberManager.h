@@ -5,6 +5,8 @@
 #include "HashStringTable.h"
 #include "CollisionManager.h"
 #include "PredefinedMembers.h"
+#include "ParallelUtils.h"
+#include "Settings.h"
 
 
 template<bool bIsDeferredTemplateCreation = true>
@@ -178,9 +180,6 @@ private:
 	friend class CollisionManagerTest;
 
 private:
-	/* Map to lookup if a struct has predefined members */
-	static inline const PredefinedMemberLookupMapType* PredefinedMemberLookup = nullptr;
-
 	/* CollisionManager containing information on colliding member-/function-names */
 	static inline CollisionManager MemberNames;
 
@@ -211,9 +210,15 @@ public:
 	FunctionIterator<true> IterateFunctions() const;
 
 public:
+	/* Sets the map to lookup if a struct has predefined members. Only affects the calling thread, and the workers it starts with ParallelUtils::ParallelFor. */
 	static inline void SetPredefinedMemberLookupPtr(const PredefinedMemberLookupMapType* Lookup)
 	{
-		PredefinedMemberLookup = Lookup;
+		ParallelUtils::CurrentGeneratorContext.PredefinedMemberLookup = Lookup;
+	}
+
+	static inline const PredefinedMemberLookupMapType* GetPredefinedMemberLookupPtr()
+	{
+		return ParallelUtils::CurrentGeneratorContext.PredefinedMemberLookup;
 	}
 
 	/* Add special names like "Class", "Flags, "Parms", etc. to avoid collisions on them */
@@ -237,6 +242,14 @@ public:
 
 		MemberNames.AddReservedName("IN", true);
 		MemberNames.AddReservedName("OUT", true);
+
+		/* Member-reflection reserved names */
+		if constexpr (Settings::CppGenerator::bAddMemberReflection)
+		{
+			MemberNames.AddReservedName("ReflectedSuper", false);
+			MemberNames.AddReservedName("ReflectedTypeId", false);
+			MemberNames.AddReservedName("ReflectedMembers", false);
+		}
 	}
 
 	static inline void Init()
@@ -1,4 +1,5 @@
 #include "NameArray.h"
+#include "HotPathCounters.h"
 
 /* DEBUG */
 #include "ObjectArray.h"
@@ -15,6 +16,8 @@ std::string FNameEntry::GetString()
 	if (!Address)
 		return "";
 
+	HotPathCounters::Add(EHotPathCounter::FNameEntryDecode);
+
 	return GetStr(Address);
 }
 
@@ -533,48 +536,31 @@ bool NameArray::TryInit(int32 OffsetOverride, bool bIsNamePool)
 {
 	uintptr_t ImageBase = GetImageBase();
 
-	uint8* GNamesAddress = nullptr;
-
-	const bool bIsNameArrayOverride = !bIsNamePool;
-	const bool bIsNamePoolOverride = bIsNamePool;
-
-	bool bFoundNameArray = false;
-	bool bFoundnamePool = false;
-
 	Off::InSDK::NameArray::GNames = OffsetOverride;
 
-	if (bIsNameArrayOverride)
+	if (!bIsNamePool)
 	{
 		std::cout << std::format("Overwrote offset: 'TNameEntryArray GNames' set as offset 0x{:X}\n", Off::InSDK::NameArray::GNames) << std::endl;
-		GNamesAddress = *reinterpret_cast<uint8**>(ImageBase + Off::InSDK::NameArray::GNames);// Derefernce
-		Settings::Internal::bUseNamePool = false;
-		bFoundNameArray = true;
-	}
-	else if (bIsNamePoolOverride)
-	{
-		std::cout << std::format("Overwrote offset: 'FNamePool GNames' set as offset 0x{:X}\n", Off::InSDK::NameArray::GNames) << std::endl;
-		GNamesAddress = reinterpret_cast<uint8*>(ImageBase + Off::InSDK::NameArray::GNames); // No derefernce
-		Settings::Internal::bUseNamePool = true;
-		bFoundnamePool = true;
+		return TryInitFromAddress(*reinterpret_cast<uint8**>(ImageBase + Off::InSDK::NameArray::GNames) /* Derefernce */, false);
 	}
 
-	if (!bFoundNameArray && !bFoundnamePool)
-	{
-		std::cout << "\n\nCould not find GNames!\n\n" << std::endl;
-		return false;
-	}
+	std::cout << std::format("Overwrote offset: 'FNamePool GNames' set as offset 0x{:X}\n", Off::InSDK::NameArray::GNames) << std::endl;
+	return TryInitFromAddress(reinterpret_cast<uint8*>(ImageBase + Off::InSDK::NameArray::GNames) /* No derefernce */, true);
+}
 
-	if (bFoundNameArray && NameArray::InitializeNameArray(GNamesAddress))
+bool NameArray::TryInitFromAddress(uint8* GNamesAddress, bool bIsNamePool)
+{
+	Settings::Internal::bUseNamePool = bIsNamePool;
+
+	if (!bIsNamePool && NameArray::InitializeNameArray(GNamesAddress))
 	{
 		GNames = GNamesAddress;
-		Settings::Internal::bUseNamePool = false;
 		FNameEntry::Init();
 		return true;
 	}
-	else if (bFoundnamePool && NameArray::InitializeNamePool(reinterpret_cast<uint8_t*>(GNamesAddress)))
+	else if (bIsNamePool && NameArray::InitializeNamePool(GNamesAddress))
 	{
 		GNames = GNamesAddress;
-		Settings::Internal::bUseNamePool = true;
 		/* FNameEntry::Init() was moved into NameArray::InitializeNamePool to avoid duplicated logic */
 		return true;
 	}
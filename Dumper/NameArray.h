@@ -55,6 +55,9 @@ public:
 	static bool TryInit(bool bIsTestOnly = false);
 	static bool TryInit(int32 OffsetOverride, bool bIsNamePool);
 
+	/* TNameEntryArray* or FNamePool* at an absolute address, doesn't change Off::InSDK::NameArray::GNames */
+	static bool TryInitFromAddress(uint8* GNamesAddress, bool bIsNamePool);
+
 	/* Initializes the GNames offset, but doesn't call NameArray::InitializeNameArray() or NameArray::InitializedNamePool() */
 	static bool SetGNamesWithoutCommiting();
 
@@ -1,10 +1,11 @@
 #include <iostream>
-#include <fstream>
 #include <format>
 #include <filesystem>
 #include "ObjectArray.h"
 #include "Offsets.h"
 #include "Utils.h"
+#include "OutputSink.h"
+#include "HotPathCounters.h"
 
 namespace fs = std::filesystem;
 
@@ -336,10 +337,15 @@ void ObjectArray::Init(bool bScanAllMemory)
 
 void ObjectArray::Init(int32 GObjectsOffset, int32 ElementsPerChunk, bool bIsChunked)
 {
-	GObjects = reinterpret_cast<uint8_t*>(GetImageBase() + GObjectsOffset);
-
 	Off::InSDK::ObjArray::GObjects = GObjectsOffset;
 
+	ObjectArray::InitFromAddress(reinterpret_cast<void*>(GetImageBase() + GObjectsOffset), ElementsPerChunk, bIsChunked);
+}
+
+void ObjectArray::InitFromAddress(void* GObjectsAddress, int32 ElementsPerChunk, bool bIsChunked)
+{
+	GObjects = static_cast<uint8_t*>(GObjectsAddress);
+
 	std::cout << "GObjects: 0x" << (void*)GObjects << "\n" << std::endl;
 
 	if (!bIsChunked)
@@ -389,11 +395,11 @@ void ObjectArray::Init(int32 GObjectsOffset, int32 ElementsPerChunk, bool bIsChu
 
 void ObjectArray::DumpObjects(const fs::path& Path, bool bWithPathname)
 {
-	std::ofstream DumpStream(Path / "GObjects-Dump.txt");
+	BufferedFile DumpStream(Path / "GObjects-Dump.txt", true, 0x1000000);
 
 	DumpStream << "Object dump by Dumper-7\n\n";
 	DumpStream << (!Settings::Generator::GameVersion.empty() && !Settings::Generator::GameName.empty() ? (Settings::Generator::GameVersion + '-' + Settings::Generator::GameName) + "\n\n" : "");
-	DumpStream << "Count: " << Num() << "\n\n\n";
+	DumpStream << std::format("Count: {}\n\n\n", Num());
 
 	for (auto Object : ObjectArray())
 	{
@@ -419,14 +425,20 @@ int32 ObjectArray::Num()
 template<typename UEType>
 static UEType ObjectArray::GetByIndex(int32 Index)
 {
+	HotPathCounters::Add(EHotPathCounter::ObjectArrayGetByIndex);
+
 	return UEType(ByIndex(GObjects + Off::FUObjectArray::Ptr, Index, SizeOfFUObjectItem, FUObjectItemInitialOffset, NumElementsPerChunk));
 }
 
 template<typename UEType>
 UEType ObjectArray::FindObject(std::string FullName, EClassCastFlags RequiredType)
 {
+	HotPathCounters::Add(EHotPathCounter::FindObjectScans);
+
 	for (UEObject Object : ObjectArray())
 	{
+		HotPathCounters::Add(EHotPathCounter::FindObjectScannedObjects);
+
 		if (Object.IsA(RequiredType) && Object.GetFullName() == FullName)
 		{
 			return Object.Cast<UEType>();
@@ -439,10 +451,14 @@ UEType ObjectArray::FindObject(std::string FullName, EClassCastFlags RequiredTyp
 template<typename UEType>
 UEType ObjectArray::FindObjectFast(std::string Name, EClassCastFlags RequiredType)
 {
+	HotPathCounters::Add(EHotPathCounter::FindObjectScans);
+
 	auto ObjArray = ObjectArray();
 
 	for (UEObject Object : ObjArray)
 	{
+		HotPathCounters::Add(EHotPathCounter::FindObjectScannedObjects);
+
 		if (Object.IsA(RequiredType) && Object.GetName() == Name)
 		{
 			return Object.Cast<UEType>();
@@ -455,10 +471,14 @@ UEType ObjectArray::FindObjectFast(std::string Name, EClassCastFlags RequiredTyp
 template<typename UEType>
 static UEType ObjectArray::FindObjectFastInOuter(std::string Name, std::string Outer)
 {
+	HotPathCounters::Add(EHotPathCounter::FindObjectScans);
+
 	auto ObjArray = ObjectArray();
 
 	for (UEObject Object : ObjArray)
 	{
+		HotPathCounters::Add(EHotPathCounter::FindObjectScannedObjects);
+
 		if (Object.GetName() == Name && Object.GetOuter().GetName() == Outer)
 		{
 			return Object.Cast<UEType>();
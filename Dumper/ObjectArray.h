@@ -41,6 +41,9 @@ public:
 
 	static void Init(int32 GObjectsOffset, int32 NumElementsPerChunk, bool bIsChunked);
 
+	/* FFixedUObjectArray* or FChunkedFixedUObjectArray* at an absolute address, doesn't change Off::InSDK::ObjArray::GObjects */
+	static void InitFromAddress(void* GObjectsAddress, int32 NumElementsPerChunk, bool bIsChunked);
+
 	static void DumpObjects(const fs::path& Path, bool bWithPathname = false);
 
 	static int32 Num();
@@ -2,6 +2,7 @@
 
 #include <vector>
 #include "ObjectArray.h"
+#include "Profiler.h"
 
 namespace OffsetFinder
 {
@@ -54,6 +55,8 @@ namespace OffsetFinder
 	/* UObject */
 	inline void InitUObjectOffsets()
 	{
+		ProfilerScope Scope(__FUNCTION__);
+
 		uint8_t* ObjA = static_cast<uint8_t*>(ObjectArray::GetByIndex(0x055).GetAddress());
 		uint8_t* ObjB = static_cast<uint8_t*>(ObjectArray::GetByIndex(0x123).GetAddress());
 
@@ -121,6 +124,8 @@ namespace OffsetFinder
 
 	inline void FixupHardcodedOffsets()
 	{
+		ProfilerScope Scope(__FUNCTION__);
+
 		if (Settings::Internal::bUseCasePreservingName)
 		{
 			Off::FField::Flags += 0x8;
@@ -166,6 +171,8 @@ namespace OffsetFinder
 
 	inline void InitFNameSettings()
 	{
+		ProfilerScope Scope(__FUNCTION__);
+
 		UEObject FirstObject = ObjectArray::GetByIndex(0);
 
 		const uint8* NameAddress = static_cast<const uint8*>(FirstObject.GetFName().GetAddress());
@@ -244,6 +251,8 @@ namespace OffsetFinder
 
 	inline void PostInitFNameSettings()
 	{
+		ProfilerScope Scope(__FUNCTION__);
+
 		UEClass PlayerStart = ObjectArray::FindClassFast("PlayerStart");
 
 		const int32 FNameSize = PlayerStart.FindMember("PlayerStartTag").GetSize();
@@ -299,6 +308,8 @@ namespace OffsetFinder
 	/* UField */
 	inline int32_t FindUFieldNextOffset()
 	{
+		ProfilerScope Scope(__FUNCTION__);
+
 		const uint8_t* KismetSystemLibraryChild = reinterpret_cast<uint8_t*>(ObjectArray::FindObjectFast<UEStruct>("KismetSystemLibrary").GetChild().GetAddress());
 		const uint8_t* KismetStringLibraryChild = reinterpret_cast<uint8_t*>(ObjectArray::FindObjectFast<UEStruct>("KismetStringLibrary").GetChild().GetAddress());
 
@@ -308,6 +319,8 @@ namespace OffsetFinder
 	/* FField */
 	inline int32_t FindFFieldNextOffset()
 	{
+		ProfilerScope Scope(__FUNCTION__);
+
 		const uint8_t* GuidChildren   = reinterpret_cast<uint8_t*>(ObjectArray::FindObjectFast<UEStruct>("Guid").GetChildProperties().GetAddress());
 		const uint8_t* VectorChildren = reinterpret_cast<uint8_t*>(ObjectArray::FindObjectFast<UEStruct>("Vector").GetChildProperties().GetAddress());
 
@@ -316,6 +329,8 @@ namespace OffsetFinder
 
 	inline int32_t FindFFieldNameOffset()
 	{
+		ProfilerScope Scope(__FUNCTION__);
+
 		UEFField GuidChild = ObjectArray::FindObjectFast<UEStruct>("Guid").GetChildProperties();
 		UEFField VectorChild = ObjectArray::FindObjectFast<UEStruct>("Vector").GetChildProperties();
 
@@ -340,6 +355,8 @@ namespace OffsetFinder
 	/* UEnum */
 	inline int32_t FindEnumNamesOffset()
 	{
+		ProfilerScope Scope(__FUNCTION__);
+
 		std::vector<std::pair<void*, int32_t>> Infos;
 
 		Infos.push_back({ ObjectArray::FindObjectFast("ENetRole").GetAddress(), 0x5 });
@@ -371,6 +388,8 @@ namespace OffsetFinder
 	/* UStruct */
 	inline int32_t FindSuperOffset()
 	{
+		ProfilerScope Scope(__FUNCTION__);
+
 		std::vector<std::pair<void*, void*>> Infos;
 
 		Infos.push_back({ ObjectArray::FindObjectFast("Struct").GetAddress(), ObjectArray::FindObjectFast("Field").GetAddress() });
@@ -385,6 +404,8 @@ namespace OffsetFinder
 
 	inline int32_t FindChildOffset()
 	{
+		ProfilerScope Scope(__FUNCTION__);
+
 		std::vector<std::pair<void*, void*>> Infos;
 
 		Infos.push_back({ ObjectArray::FindObjectFast("PlayerController").GetAddress(), ObjectArray::FindObjectFastInOuter("WasInputKeyJustReleased", "PlayerController").GetAddress() });
@@ -409,6 +430,8 @@ namespace OffsetFinder
 
 	inline int32_t FindChildPropertiesOffset()
 	{
+		ProfilerScope Scope(__FUNCTION__);
+
 		uint8* ObjA = (uint8*)ObjectArray::FindObjectFast("Color").GetAddress();
 		uint8* ObjB = (uint8*)ObjectArray::FindObjectFast("Guid").GetAddress();
 
@@ -417,6 +440,8 @@ namespace OffsetFinder
 
 	inline int32_t FindStructSizeOffset()
 	{
+		ProfilerScope Scope(__FUNCTION__);
+
 		std::vector<std::pair<void*, int32_t>> Infos;
 
 		Infos.push_back({ ObjectArray::FindObjectFast("Color").GetAddress(), 0x04 });
@@ -427,6 +452,8 @@ namespace OffsetFinder
 
 	inline int32_t FindMinAlignmentOffset()
 	{
+		ProfilerScope Scope(__FUNCTION__);
+
 		std::vector<std::pair<void*, int32_t>> Infos;
 
 		Infos.push_back({ ObjectArray::FindObjectFast("Transform").GetAddress(), 0x10 });
@@ -438,6 +465,8 @@ namespace OffsetFinder
 	/* UFunction */
 	inline int32_t FindFunctionFlagsOffset()
 	{
+		ProfilerScope Scope(__FUNCTION__);
+
 		std::vector<std::pair<void*, EFunctionFlags>> Infos;
 
 		Infos.push_back({ ObjectArray::FindObjectFast("WasInputKeyJustPressed").GetAddress(), EFunctionFlags::Final | EFunctionFlags::Native | EFunctionFlags::Public | EFunctionFlags::BlueprintCallable | EFunctionFlags::BlueprintPure | EFunctionFlags::Const });
@@ -457,6 +486,8 @@ namespace OffsetFinder
 
 	inline int32_t FindFunctionNativeFuncOffset()
 	{
+		ProfilerScope Scope(__FUNCTION__);
+
 		std::vector<std::pair<void*, EFunctionFlags>> Infos;
 
 		uintptr_t WasInputKeyJustPressed = reinterpret_cast<uintptr_t>(ObjectArray::FindObjectFast("WasInputKeyJustPressed").GetAddress());
@@ -474,6 +505,8 @@ namespace OffsetFinder
 
 	inline int32_t FindNumParamsOffset()
 	{
+		ProfilerScope Scope(__FUNCTION__);
+
 		std::vector<std::pair<void*, uint8_t>> Infos;
 
 		Infos.push_back({ ObjectArray::FindObjectFast("SwitchLevel").GetAddress(), 0x1 });
@@ -486,6 +519,8 @@ namespace OffsetFinder
 
 	inline int32_t FindParamSizeOffset()
 	{
+		ProfilerScope Scope(__FUNCTION__);
+
 		std::vector<std::pair<void*, uint16_t>> Infos;
 
 		// TODO (encryqed) : Fix it anyways somehow, for some reason its one byte off? Idk why i just add a byte manually
@@ -507,6 +542,8 @@ namespace OffsetFinder
 	/* UClass */
 	inline int32_t FindCastFlagsOffset()
 	{
+		ProfilerScope Scope(__FUNCTION__);
+
 		std::vector<std::pair<void*, EClassCastFlags>> Infos;
 
 		Infos.push_back({ ObjectArray::FindObjectFast("Actor").GetAddress(), EClassCastFlags::Actor });
@@ -517,6 +554,8 @@ namespace OffsetFinder
 
 	inline int32_t FindDefaultObjectOffset()
 	{
+		ProfilerScope Scope(__FUNCTION__);
+
 		std::vector<std::pair<void*, void*>> Infos;
 
 		Infos.push_back({ ObjectArray::FindObjectFast("Object").GetAddress(), ObjectArray::FindObjectFast("Default__Object").GetAddress() });
@@ -528,6 +567,8 @@ namespace OffsetFinder
 	/* Property */
 	inline int32_t FindElementSizeOffset()
 	{
+		ProfilerScope Scope(__FUNCTION__);
+
 		std::vector<std::pair<void*, int32_t>> Infos;
 
 		UEStruct Guid = ObjectArray::FindObjectFast("Guid", EClassCastFlags::Struct).Cast<UEStruct>();
@@ -541,6 +582,8 @@ namespace OffsetFinder
 
 	inline int32_t FindArrayDimOffset()
 	{
+		ProfilerScope Scope(__FUNCTION__);
+
 		std::vector<std::pair<void*, int32_t>> Infos;
 
 		UEStruct Guid = ObjectArray::FindObjectFast("Guid", EClassCastFlags::Struct).Cast<UEStruct>();
@@ -557,6 +600,8 @@ namespace OffsetFinder
 
 	inline int32_t FindPropertyFlagsOffset()
 	{
+		ProfilerScope Scope(__FUNCTION__);
+
 		std::vector<std::pair<void*, EPropertyFlags>> Infos;
 
 
@@ -585,6 +630,8 @@ namespace OffsetFinder
 
 	inline int32_t FindOffsetInternalOffset()
 	{
+		ProfilerScope Scope(__FUNCTION__);
+
 		std::vector<std::pair<void*, int32_t>> Infos;
 
 		UEStruct Color = ObjectArray::FindObjectFast("Color", EClassCastFlags::Struct).Cast<UEStruct>();
@@ -599,6 +646,8 @@ namespace OffsetFinder
 	/* BoolProperty */
 	inline int32_t FindBoolPropertyBaseOffset()
 	{
+		ProfilerScope Scope(__FUNCTION__);
+
 		std::vector<std::pair<void*, uint8_t>> Infos;
 
 		UEClass Engine = ObjectArray::FindClassFast("Engine");
@@ -612,6 +661,8 @@ namespace OffsetFinder
 	/* ArrayProperty */
 	inline int32_t FindInnerTypeOffset(const int32 PropertySize)
 	{
+		ProfilerScope Scope(__FUNCTION__);
+
 		if (!Settings::Internal::bUseFProperty)
 			return PropertySize;
 
@@ -629,6 +680,8 @@ namespace OffsetFinder
 	/* SetProperty */
 	inline int32_t FindSetPropertyBaseOffset(const int32 PropertySize)
 	{
+		ProfilerScope Scope(__FUNCTION__);
+
 		if (!Settings::Internal::bUseFProperty)
 			return PropertySize;
 
@@ -646,6 +699,8 @@ namespace OffsetFinder
 	/* MapProperty */
 	inline int32_t FindMapPropertyBaseOffset(const int32 PropertySize)
 	{
+		ProfilerScope Scope(__FUNCTION__);
+
 		if (!Settings::Internal::bUseFProperty)
 			return PropertySize;
 
@@ -663,6 +718,8 @@ namespace OffsetFinder
 	/* InSDK -> ULevel */
 	inline int32_t FindLevelActorsOffset()
 	{
+		ProfilerScope Scope(__FUNCTION__);
+
 		UEObject Level = nullptr;
 		uintptr_t Lvl = 0x0;
 
@@ -711,6 +768,8 @@ namespace OffsetFinder
 	/* InSDK -> UDataTable */
 	inline int32_t FindDatatableRowMapOffset()
 	{
+		ProfilerScope Scope(__FUNCTION__);
+
 		const UEClass DataTable = ObjectArray::FindClassFast("DataTable");
 
 		constexpr int32 UObjectOuterSize = 0x8;
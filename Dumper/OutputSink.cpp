@@ -0,0 +1,394 @@
+#include <iostream>
+#include <fstream>
+#include <format>
+
+#include "OutputSink.h"
+#include "Settings.h"
+#include "Profiler.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+
+void OutputSink::WriterThreadMain()
+{
+	while (true)
+	{
+		PendingFile File;
+
+		{
+			std::unique_lock Lock(QueueLock);
+
+			QueueCondition.wait(Lock, []() -> bool { return !PendingFiles.empty() || bShouldStopWriterThread; });
+
+			if (PendingFiles.empty())
+				return;
+
+			File = std::move(PendingFiles.front());
+			PendingFiles.pop_front();
+		}
+
+		const uint64 FileSize = File.Data.size();
+
+		WriteToDisk(File);
+
+		{
+			std::scoped_lock Lock(QueueLock);
+
+			NumFilesInFlight--;
+			NumPendingBytes -= FileSize;
+		}
+
+		/* Wakes up Submit() waiting for memory, as well as Flush() */
+		QueueCondition.notify_all();
+	}
+}
+
+std::string OutputSink::TranslateNewlines(const std::string& Data)
+{
+	std::string Translated;
+	Translated.reserve(Data.size() + (Data.size() / 16));
+
+	size_t LastPos = 0x0;
+
+	for (size_t Pos = Data.find('\n'); Pos != std::string::npos; Pos = Data.find('\n', LastPos))
+	{
+		Translated.append(Data, LastPos, Pos - LastPos);
+		Translated.append("\r\n");
+
+		LastPos = Pos + 1;
+	}
+
+	Translated.append(Data, LastPos);
+
+	return Translated;
+}
+
+bool OutputSink::WriteToDisk(const PendingFile& File)
+{
+#ifdef _WIN32
+	/* Match std::ofstream in text-mode, so the files on disk don't change compared to older versions of the Dumper */
+	const std::string TranslatedData = File.bIsTextFile ? TranslateNewlines(File.Data) : std::string();
+	const std::string& Data = File.bIsTextFile ? TranslatedData : File.Data;
+
+	if (IsUnchangedSinceLastRun(File.Path, Data))
+	{
+		NumFilesSkipped.fetch_add(1, std::memory_order_relaxed);
+		return true;
+	}
+
+	HANDLE FileHandle = CreateFileW(File.Path.c_str(), GENERIC_WRITE, 0x0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+	if (FileHandle == INVALID_HANDLE_VALUE)
+	{
+		std::cout << "Error opening file \"" << File.Path.string() << "\"" << std::endl;
+		return false;
+	}
+#else
+	const std::string& Data = File.Data;
+
+	if (IsUnchangedSinceLastRun(File.Path, Data))
+	{
+		NumFilesSkipped.fetch_add(1, std::memory_order_relaxed);
+		return true;
+	}
+
+	const int FileHandle = open(File.Path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+	if (FileHandle < 0)
+	{
+		std::cout << "Error opening file \"" << File.Path.string() << "\"" << std::endl;
+		return false;
+	}
+#endif
+
+	uint64 NumBytesLeft = Data.size();
+	const char* Current = Data.data();
+
+	bool bSucceeded = true;
+
+	while (NumBytesLeft > 0x0)
+	{
+		const uint64 NumBytesToWrite = NumBytesLeft < MaxBytesPerWriteCall ? NumBytesLeft : MaxBytesPerWriteCall;
+
+		NumWriteCalls.fetch_add(1, std::memory_order_relaxed);
+
+#ifdef _WIN32
+		DWORD NumBytesWrittenThisCall = 0x0;
+		bSucceeded = WriteFile(FileHandle, Current, static_cast<DWORD>(NumBytesToWrite), &NumBytesWrittenThisCall, nullptr) && NumBytesWrittenThisCall > 0x0;
+#else
+		const ssize_t NumBytesWrittenThisCall = ::write(FileHandle, Current, NumBytesToWrite);
+		bSucceeded = NumBytesWrittenThisCall > 0x0;
+#endif
+
+		if (!bSucceeded)
+		{
+			std::cout << "Error writing to file \"" << File.Path.string() << "\"" << std::endl;
+			break;
+		}
+
+		Current += NumBytesWrittenThisCall;
+		NumBytesLeft -= NumBytesWrittenThisCall;
+	}
+
+#ifdef _WIN32
+	CloseHandle(FileHandle);
+#else
+	::close(FileHandle);
+#endif
+
+	NumFilesWritten.fetch_add(1, std::memory_order_relaxed);
+	NumBytesWritten.fetch_add(Data.size() - NumBytesLeft, std::memory_order_relaxed);
+
+	return bSucceeded;
+}
+
+uint64 OutputSink::HashFileContent(const std::string& Data)
+{
+	uint64 Hash = 0xCBF29CE484222325;
+
+	for (const char C : Data)
+	{
+		Hash ^= static_cast<uint8>(C);
+		Hash *= 0x100000001B3;
+	}
+
+	return Hash;
+}
+
+bool OutputSink::IsUnchangedSinceLastRun(const fs::path& Path, const std::string& Data)
+{
+	/* Files written before a manifest was loaded (or without one) are always written */
+	if (!bHasLoadedManifest)
+		return false;
+
+	const ManifestEntry Entry = { HashFileContent(Data), Data.size() };
+
+	std::string RelativePath = Path.lexically_relative(ManifestFolder).generic_string();
+
+	bool bIsUnchanged = false;
+
+	{
+		std::scoped_lock Lock(ManifestLock);
+
+		auto It = PreviousManifest.find(RelativePath);
+
+		bIsUnchanged = It != PreviousManifest.end() && It->second.Hash == Entry.Hash && It->second.Size == Entry.Size;
+
+		CurrentManifest[std::move(RelativePath)] = Entry;
+	}
+
+	/* The file might have been deleted, or modified by the user, since the last run */
+	std::error_code Error;
+	return bIsUnchanged && fs::file_size(Path, Error) == Entry.Size && !Error;
+}
+
+void OutputSink::Submit(fs::path&& Path, std::string&& Data, bool bIsTextFile)
+{
+	Profiler::OnBytesWritten(Data.size());
+
+	if constexpr (!Settings::Generator::bWriteFilesOnBackgroundThread)
+	{
+		WriteToDisk(PendingFile{ std::move(Path), std::move(Data), bIsTextFile });
+		return;
+	}
+
+	{
+		std::unique_lock Lock(QueueLock);
+
+		if (!WriterThread.joinable())
+		{
+			bShouldStopWriterThread = false;
+			WriterThread = std::thread(&OutputSink::WriterThreadMain);
+		}
+
+		/* Wait for the writer to catch up, if too much data is queued already. Always allow at least one file to be queued. */
+		QueueCondition.wait(Lock, []() -> bool { return NumPendingBytes < MaxPendingBytes || NumFilesInFlight == 0x0; });
+
+		NumFilesInFlight++;
+		NumPendingBytes += Data.size();
+
+		PendingFiles.push_back(PendingFile{ std::move(Path), std::move(Data), bIsTextFile });
+	}
+
+	QueueCondition.notify_all();
+}
+
+void OutputSink::Flush()
+{
+	std::unique_lock Lock(QueueLock);
+
+	QueueCondition.wait(Lock, []() -> bool { return NumFilesInFlight == 0x0; });
+}
+
+void OutputSink::Shutdown()
+{
+	bool bIsWriterThreadRunning = false;
+
+	{
+		std::scoped_lock Lock(QueueLock);
+
+		bIsWriterThreadRunning = WriterThread.joinable();
+		bShouldStopWriterThread = true;
+	}
+
+	if (bIsWriterThreadRunning)
+	{
+		QueueCondition.notify_all();
+
+		/* The writer thread only exits once the queue is empty */
+		WriterThread.join();
+	}
+
+	SaveManifest();
+}
+
+void OutputSink::LoadManifest(const fs::path& Folder)
+{
+	/* Make sure all files of an older manifest were written */
+	Flush();
+
+	std::scoped_lock Lock(ManifestLock);
+
+	ManifestFolder = Folder;
+	PreviousManifest.clear();
+	CurrentManifest.clear();
+
+	bHasLoadedManifest = true;
+
+	std::ifstream ManifestFile(Folder / ManifestFileName);
+
+	/* First run in this folder, every file is written */
+	if (!ManifestFile.is_open())
+		return;
+
+	/* Format: "<Hash> <Size> <RelativePath>\n", one line per file */
+	std::string Line;
+
+	while (std::getline(ManifestFile, Line))
+	{
+		if (!Line.empty() && Line.back() == '\r')
+			Line.pop_back();
+
+		const size_t HashEnd = Line.find(' ');
+		const size_t SizeEnd = HashEnd != std::string::npos ? Line.find(' ', HashEnd + 1) : std::string::npos;
+
+		/* Malformed line, the file is simply written again */
+		if (SizeEnd == std::string::npos || SizeEnd + 1 >= Line.size())
+			continue;
+
+		try
+		{
+			const uint64 Hash = std::stoull(Line.substr(0x0, HashEnd), nullptr, 16);
+			const uint64 Size = std::stoull(Line.substr(HashEnd + 1, SizeEnd - HashEnd - 1));
+
+			PreviousManifest[Line.substr(SizeEnd + 1)] = ManifestEntry{ Hash, Size };
+		}
+		catch (const std::exception&)
+		{
+			continue;
+		}
+	}
+}
+
+void OutputSink::SaveManifest()
+{
+	std::scoped_lock Lock(ManifestLock);
+
+	if (!bHasLoadedManifest)
+		return;
+
+	/* Remove files that were generated by the last run, but not by this one (eg. a package that doesn't exist anymore) */
+	for (const auto& [RelativePath, Entry] : PreviousManifest)
+	{
+		if (CurrentManifest.contains(RelativePath))
+			continue;
+
+		std::error_code Error;
+		fs::remove(ManifestFolder / RelativePath, Error);
+	}
+
+	/* std::map is sorted, so the manifest itself is deterministic as well */
+	std::string ManifestData;
+
+	for (const auto& [RelativePath, Entry] : CurrentManifest)
+		ManifestData += std::format("{:016X} {} {}\n", Entry.Hash, Entry.Size, RelativePath);
+
+	std::ofstream ManifestFile(ManifestFolder / ManifestFileName, std::ios::binary | std::ios::trunc);
+	ManifestFile << ManifestData;
+
+	PreviousManifest = std::move(CurrentManifest);
+	CurrentManifest.clear();
+	bHasLoadedManifest = false;
+}
+
+OutputSinkStats OutputSink::GetStats()
+{
+	return OutputSinkStats{
+		.NumFiles = NumFilesWritten.load(),
+		.NumBytes = NumBytesWritten.load(),
+		.NumWriteCalls = NumWriteCalls.load(),
+		.NumFilesSkipped = NumFilesSkipped.load(),
+	};
+}
+
+void OutputSink::ResetStats()
+{
+	NumFilesWritten = 0x0;
+	NumBytesWritten = 0x0;
+	NumWriteCalls = 0x0;
+	NumFilesSkipped = 0x0;
+}
+
+
+BufferedFile::BufferedFile(const fs::path& FilePath, bool bIsText, size_t ReserveSize)
+	: Path(FilePath), bIsTextFile(bIsText), bIsOpen(true)
+{
+	Buffer.reserve(ReserveSize);
+}
+
+BufferedFile::BufferedFile(BufferedFile&& Other) noexcept
+	: Path(std::move(Other.Path)), Buffer(std::move(Other.Buffer)), bIsTextFile(Other.bIsTextFile), bIsOpen(Other.bIsOpen)
+{
+	Other.bIsOpen = false;
+}
+
+BufferedFile::~BufferedFile()
+{
+	close();
+}
+
+BufferedFile& BufferedFile::operator=(BufferedFile&& Other) noexcept
+{
+	if (this == &Other)
+		return *this;
+
+	/* Hand the current content to the sink before taking over the other file */
+	close();
+
+	Path = std::move(Other.Path);
+	Buffer = std::move(Other.Buffer);
+	bIsTextFile = Other.bIsTextFile;
+	bIsOpen = Other.bIsOpen;
+
+	Other.bIsOpen = false;
+
+	return *this;
+}
+
+void BufferedFile::close()
+{
+	if (!bIsOpen)
+		return;
+
+	bIsOpen = false;
+
+	OutputSink::Submit(std::move(Path), std::move(Buffer), bIsTextFile);
+
+	Path.clear();
+	Buffer.clear();
+}
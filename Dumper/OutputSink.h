@@ -0,0 +1,204 @@
+#pragma once
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+
+#include "Enums.h"
+
+namespace fs = std::filesystem;
+
+
+struct OutputSinkStats
+{
+	/* Number of files written to disk */
+	uint64 NumFiles = 0x0;
+
+	/* Number of bytes written to disk, after newline translation */
+	uint64 NumBytes = 0x0;
+
+	/* Number of write-calls (WriteFile/write) issued, excluding calls to open/close the files */
+	uint64 NumWriteCalls = 0x0;
+
+	/* Number of files that were not written, because their content didn't change since the last run */
+	uint64 NumFilesSkipped = 0x0;
+};
+
+/*
+* Output layer shared by all generators.
+*
+* Generators append to in-memory BufferedFiles, which are handed to the OutputSink as a whole once they're closed.
+* A background thread then writes every file with as few write-calls as possible (usually one per file).
+*
+* Note: Windows has no io_uring, and vectored I/O (WriteFileGather) requires unbuffered, page-aligned writes. Since every file
+*       is already a single contiguous buffer, a single large WriteFile per file is used instead.
+*/
+class OutputSink
+{
+private:
+	friend class OutputSinkTest;
+
+private:
+	struct PendingFile
+	{
+		fs::path Path;
+		std::string Data;
+		bool bIsTextFile;
+	};
+
+	struct ManifestEntry
+	{
+		uint64 Hash;
+		uint64 Size;
+	};
+
+	/* Key: Path relative to the manifest folder, using '/' as seperator */
+	using ManifestType = std::map<std::string, ManifestEntry>;
+
+private:
+	/* WriteFile takes a DWORD as the number of bytes to write, larger files are split into multiple writes */
+	static constexpr uint64 MaxBytesPerWriteCall = 0x40000000;
+
+	/* Submit() blocks while more than this many bytes are waiting to be written, to limit memory usage */
+	static constexpr uint64 MaxPendingBytes = 0x20000000;
+
+	/* Stored in the folder passed to LoadManifest(), lists the hash and size of every file written by the last run */
+	static constexpr const char* ManifestFileName = "OutputManifest.txt";
+
+private:
+	static inline std::mutex QueueLock;
+	static inline std::condition_variable QueueCondition;
+
+	static inline std::deque<PendingFile> PendingFiles;
+	static inline std::thread WriterThread;
+
+	/* Files that were submitted but not yet written (queued + currently being written). Guarded by QueueLock. */
+	static inline uint64 NumFilesInFlight = 0x0;
+	static inline uint64 NumPendingBytes = 0x0;
+
+	static inline bool bShouldStopWriterThread = false;
+
+	static inline std::atomic<uint64> NumFilesWritten = 0x0;
+	static inline std::atomic<uint64> NumBytesWritten = 0x0;
+	static inline std::atomic<uint64> NumWriteCalls = 0x0;
+	static inline std::atomic<uint64> NumFilesSkipped = 0x0;
+
+private:
+	/* Manifests of the previous and the current run, only used after LoadManifest(). The Generator loads one if Settings::Generator::bOnlyWriteChangedFiles is enabled. */
+	static inline std::mutex ManifestLock;
+	static inline fs::path ManifestFolder;
+	static inline ManifestType PreviousManifest;
+	static inline ManifestType CurrentManifest;
+	static inline bool bHasLoadedManifest = false;
+
+private:
+	static void WriterThreadMain();
+
+	/* Translates '\n' to "\r\n", as std::ofstream in text-mode would */
+	static std::string TranslateNewlines(const std::string& Data);
+
+	static bool WriteToDisk(const PendingFile& File);
+
+	/* FNV-1a, 64bit */
+	static uint64 HashFileContent(const std::string& Data);
+
+	/* Records the file in the current manifest, returns true if it is unchanged since the last run and doesn't need to be written */
+	static bool IsUnchangedSinceLastRun(const fs::path& Path, const std::string& Data);
+
+public:
+	/* Queues the file to be written, the background writer is started on first use */
+	static void Submit(fs::path&& Path, std::string&& Data, bool bIsTextFile);
+
+	/* Blocks until every file submitted so far has been written */
+	static void Flush();
+
+	/* Flushes all pending files and stops the background writer. Saves the manifest, if one was loaded. */
+	static void Shutdown();
+
+public:
+	/* Loads the manifest of the previous run from 'Folder'. Files submitted afterwards are only written if their content changed. */
+	static void LoadManifest(const fs::path& Folder);
+
+	/* Saves the manifest of this run and removes files of the previous run, that weren't generated again */
+	static void SaveManifest();
+
+	static OutputSinkStats GetStats();
+	static void ResetStats();
+};
+
+
+/* In-memory file. Its content is handed to the OutputSink when the file is closed, or destroyed. */
+class BufferedFile
+{
+private:
+	/* Default reserve, to avoid frequent reallocations on typical SDK files */
+	static constexpr size_t DefaultReserveSize = 0x10000;
+
+private:
+	fs::path Path;
+	std::string Buffer;
+
+	bool bIsTextFile = true;
+	bool bIsOpen = false;
+
+public:
+	BufferedFile() = default;
+	BufferedFile(const fs::path& FilePath, bool bIsText = true, size_t ReserveSize = DefaultReserveSize);
+
+	BufferedFile(const BufferedFile&) = delete;
+	BufferedFile(BufferedFile&& Other) noexcept;
+
+	~BufferedFile();
+
+public:
+	BufferedFile& operator=(const BufferedFile&) = delete;
+	BufferedFile& operator=(BufferedFile&& Other) noexcept;
+
+public:
+	/* Lower-case names match std::ofstream, allowing BufferedFile to replace 'StreamType = std::ofstream' in the generators */
+	inline bool is_open() const { return bIsOpen; }
+
+	void close();
+
+	/* Like with std::ofstream, writes to a file that isn't open are discarded */
+	inline BufferedFile& write(const char* Data, size_t Size)
+	{
+		if (bIsOpen)
+			Buffer.append(Data, Size);
+
+		return *this;
+	}
+
+	inline BufferedFile& operator<<(std::string_view Str)
+	{
+		if (bIsOpen)
+			Buffer.append(Str);
+
+		return *this;
+	}
+
+	inline BufferedFile& operator<<(char C)
+	{
+		if (bIsOpen)
+			Buffer.push_back(C);
+
+		return *this;
+	}
+
+public:
+	/* Closes the file without handing its content to the OutputSink, nothing is written to disk */
+	inline void Discard()
+	{
+		bIsOpen = false;
+		Buffer.clear();
+	}
+
+public:
+	inline std::string& GetBuffer() { return Buffer; }
+	inline const fs::path& GetPath() const { return Path; }
+};
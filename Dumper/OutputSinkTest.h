@@ -0,0 +1,184 @@
+#pragma once
+#include "OutputSink.h"
+#include "TestBase.h"
+
+#include <fstream>
+#include <chrono>
+
+
+class OutputSinkTest : protected TestBase
+{
+private:
+	/* Mimics the output of CppGenerator for a single package: a lot of small writes into every file */
+	template<typename StreamType>
+	static inline void WriteSyntheticPackage(StreamType& File, int32 PackageIdx, int32 NumStructs, int32 NumMembersPerStruct)
+	{
+		File << std::format("#pragma once\n\n// Package: SyntheticPackage_{}\n\n#include \"Basic.hpp\"\n\nnamespace SDK\n{{\n", PackageIdx);
+
+		for (int32 i = 0; i < NumStructs; i++)
+		{
+			File << std::format("\n// ScriptStruct SyntheticPackage_{0}.SyntheticStruct_{1}\n// 0x{2:04X} (0x{2:04X} - 0x0000)\nstruct FSyntheticStruct_{0}_{1} final\n{{\npublic:\n", PackageIdx, i, NumMembersPerStruct * 0x8);
+
+			for (int32 j = 0; j < NumMembersPerStruct; j++)
+				File << std::format("\t{:{}} {:{}} // 0x{:04X}(0x0008)(Edit, BlueprintVisible, NativeAccessSpecifierPublic)\n", "class UObject*", 45, std::format("Member_{};", j), 50, j * 0x8);
+
+			File << "};\n";
+		}
+
+		File << "\n}\n\n";
+	}
+
+	template<typename StreamType>
+	static inline double GenerateSyntheticSDK(const fs::path& Directory, int32 NumPackages, auto&& CreateStream)
+	{
+		fs::remove_all(Directory);
+		fs::create_directories(Directory);
+
+		auto StartTime = std::chrono::high_resolution_clock::now();
+
+		for (int32 i = 0; i < NumPackages; i++)
+		{
+			/* Vary package sizes, like in a real SDK, from a few hundred bytes to a few hundred kilobytes */
+			const int32 NumStructs = 1 + (i * 7919) % 60;
+
+			for (const char* Postfix : { "_classes.hpp", "_structs.hpp", "_parameters.hpp", "_functions.cpp" })
+			{
+				StreamType File = CreateStream(Directory / std::format("SyntheticPackage_{}{}", i, Postfix));
+				WriteSyntheticPackage(File, i, NumStructs, 12);
+			}
+		}
+
+		OutputSink::Flush();
+
+		return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - StartTime).count();
+	}
+
+public:
+	template<bool bDoDebugPrinting = false>
+	static inline void TestAll(const fs::path& TempDirectory)
+	{
+		TestWriteAndReadBack<bDoDebugPrinting>(TempDirectory);
+		TestNewlineTranslation<bDoDebugPrinting>();
+		TestSkipUnchangedFiles<bDoDebugPrinting>(TempDirectory);
+
+		PrintDbgMessage<bDoDebugPrinting>("");
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestWriteAndReadBack(const fs::path& TempDirectory)
+	{
+		fs::create_directories(TempDirectory);
+
+		const fs::path FilePath = TempDirectory / "OutputSinkTest.bin";
+
+		std::string Expected;
+
+		for (int32 i = 0; i < 0x10000; i++)
+			Expected.push_back(static_cast<char>(i % 0xFF));
+
+		{
+			BufferedFile File(FilePath, false);
+			File.write(Expected.data(), Expected.size());
+
+			BufferedFile NotOpenedFile;
+			NotOpenedFile << "Discarded, the file was never opened";
+		}
+
+		OutputSink::Flush();
+
+		std::ifstream ReadBack(FilePath, std::ios::binary);
+		std::string Actual((std::istreambuf_iterator<char>(ReadBack)), std::istreambuf_iterator<char>());
+
+		const bool bSucceeded = Actual == Expected;
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> Expected size: 0x{:X}, Actual size: 0x{:X}", __FUNCTION__, Expected.size(), Actual.size());
+		std::cout << __FUNCTION__ << ": " << (bSucceeded ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestNewlineTranslation()
+	{
+		bool bSucceeded = true;
+
+		SetBoolIfFailed(bSucceeded, OutputSink::TranslateNewlines("") == "");
+		SetBoolIfFailed(bSucceeded, OutputSink::TranslateNewlines("NoNewline") == "NoNewline");
+		SetBoolIfFailed(bSucceeded, OutputSink::TranslateNewlines("\n") == "\r\n");
+		SetBoolIfFailed(bSucceeded, OutputSink::TranslateNewlines("A\nB\n\nC") == "A\r\nB\r\n\r\nC");
+
+		std::cout << __FUNCTION__ << ": " << (bSucceeded ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestSkipUnchangedFiles(const fs::path& TempDirectory)
+	{
+		/* Loads the manifest directly, the Generator only does so if Settings::Generator::bOnlyWriteChangedFiles is enabled */
+		const fs::path ManifestDirectory = TempDirectory / "ManifestTest";
+
+		fs::remove_all(ManifestDirectory);
+		fs::create_directories(ManifestDirectory);
+
+		const fs::path UnchangedPath = ManifestDirectory / "Unchanged.hpp";
+		const fs::path ChangedPath = ManifestDirectory / "Changed.hpp";
+		const fs::path StalePath = ManifestDirectory / "Stale.hpp";
+
+		auto WriteFiles = [&](std::string_view ChangedContent, bool bWriteStaleFile) -> void
+		{
+			OutputSink::LoadManifest(ManifestDirectory);
+
+			BufferedFile(UnchangedPath) << "struct FUnchanged { };\n";
+			BufferedFile(ChangedPath) << ChangedContent;
+
+			if (bWriteStaleFile)
+				BufferedFile(StalePath) << "struct FStale { };\n";
+
+			OutputSink::Flush();
+			OutputSink::SaveManifest();
+		};
+
+		WriteFiles("struct FChanged { int A; };\n", true);
+
+		const fs::file_time_type UnchangedWriteTime = fs::last_write_time(UnchangedPath);
+		const uint64 NumSkippedBefore = OutputSink::GetStats().NumFilesSkipped;
+
+		WriteFiles("struct FChanged { int A; int B; };\n", false);
+
+		std::ifstream ChangedFile(ChangedPath, std::ios::binary);
+		std::string ChangedContent((std::istreambuf_iterator<char>(ChangedFile)), std::istreambuf_iterator<char>());
+
+		bool bSucceeded = true;
+
+		SetBoolIfFailed(bSucceeded, OutputSink::GetStats().NumFilesSkipped == (NumSkippedBefore + 1));
+		SetBoolIfFailed(bSucceeded, fs::last_write_time(UnchangedPath) == UnchangedWriteTime);
+		SetBoolIfFailed(bSucceeded, ChangedContent.find("int B;") != std::string::npos);
+		SetBoolIfFailed(bSucceeded, !fs::exists(StalePath));
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> Skipped: {}, Stale file removed: {}", __FUNCTION__, OutputSink::GetStats().NumFilesSkipped - NumSkippedBefore, !fs::exists(StalePath));
+		std::cout << __FUNCTION__ << ": " << (bSucceeded ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	/*
+	* Writes a synthetic SDK of 'NumPackages' packages (4 files each) once through std::ofstream and once through the OutputSink.
+	*
+	* Pass a RAM-disk for 'MemoryDirectory' to measure the overhead of the writes themselves, and a directory on a physical drive for 'DiskDirectory'.
+	*/
+	template<bool bDoDebugPrinting = true>
+	static inline void BenchmarkSyntheticSDK(const fs::path& MemoryDirectory, const fs::path& DiskDirectory, int32 NumPackages = 4000)
+	{
+		auto CreateOfstream = [](const fs::path& Path) -> std::ofstream { return std::ofstream(Path); };
+		auto CreateBufferedFile = [](const fs::path& Path) -> BufferedFile { return BufferedFile(Path); };
+
+		for (const fs::path& Directory : { MemoryDirectory, DiskDirectory })
+		{
+			const double OfstreamTime = GenerateSyntheticSDK<std::ofstream>(Directory / "Ofstream", NumPackages, CreateOfstream);
+
+			OutputSink::ResetStats();
+
+			const double SinkTime = GenerateSyntheticSDK<BufferedFile>(Directory / "OutputSink", NumPackages, CreateBufferedFile);
+
+			const OutputSinkStats Stats = OutputSink::GetStats();
+
+			PrintDbgMessage<bDoDebugPrinting>("{} --> [{}] {} packages: std::ofstream {:.2f}ms, OutputSink {:.2f}ms ({} files, {} bytes, {} write-calls)",
+				__FUNCTION__, Directory.string(), NumPackages, OfstreamTime, SinkTime, Stats.NumFiles, Stats.NumBytes, Stats.NumWriteCalls);
+		}
+	}
+};
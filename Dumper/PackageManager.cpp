@@ -577,7 +577,6 @@ void PackageManager::Init()
 
 	bIsInitialized = true;
 
-	PackageInfos.reserve(0x800);
 
 	InitDependencies();
 	InitNames();
@@ -689,6 +688,8 @@ void PackageManager::IterateDependenciesImplementation(const PackageManagerItera
 
 void PackageManager::IterateDependencies(const IteratePackagesCallbackType& CallbackForEachPackage)
 {
+	std::scoped_lock Lock(DependencyIterationLock);
+
 	VisitedNodeContainerType VisitedNodes;
 
 	PackageManagerIterationParams Params = {
@@ -716,6 +717,8 @@ void PackageManager::IterateDependencies(const IteratePackagesCallbackType& Call
 
 void PackageManager::FindCycle(const FindCycleCallbackType& OnFoundCycle)
 {
+	std::scoped_lock Lock(DependencyIterationLock);
+
 	VisitedNodeContainerType VisitedNodes;
 
 	PackageManagerIterationParams Params = {
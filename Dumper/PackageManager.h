@@ -1,4 +1,5 @@
 #pragma once
+#include <mutex>
 
 #include "Enums.h"
 
@@ -29,7 +30,8 @@ struct VisitedNodeInformation
 	mutable uint64 ClassesIterationHitCount = 0x0;
 };
 
-using DependencyListType = std::unordered_map<int32, RequirementInfo>;
+/* Ordered by package-index, to write #includes in the same order on every run */
+using DependencyListType = std::map<int32, RequirementInfo>;
 
 
 struct DependencyInfo
@@ -131,7 +133,8 @@ public:
 	void ErasePackageDependencyFromClasses(int32 Package) const;
 };
 
-using PackageManagerOverrideMapType = std::unordered_map<int32 /* PackageIndex */, PackageInfo>;
+/* Ordered, packages are iterated (and name-collisions are resolved) in the same order on every run */
+using PackageManagerOverrideMapType = std::map<int32 /* PackageIndex */, PackageInfo>;
 
 struct PackageInfoIterator
 {
@@ -144,17 +147,16 @@ private:
 
 private:
 	const MapType& PackageInfos;
-	uint8 CurrentIterationHitCount;
 	IteratorType It;
 
 private:
-	explicit PackageInfoIterator(const MapType& Infos, uint8 IterationHitCount, IteratorType ItPos)
-		: PackageInfos(Infos), CurrentIterationHitCount(IterationHitCount), It(ItPos)
+	explicit PackageInfoIterator(const MapType& Infos, IteratorType ItPos)
+		: PackageInfos(Infos), It(ItPos)
 	{
 	}
 
-	explicit PackageInfoIterator(const MapType& Infos, uint8 IterationHitCount)
-		: PackageInfos(Infos), CurrentIterationHitCount(IterationHitCount), It(Infos.cbegin())
+	explicit PackageInfoIterator(const MapType& Infos)
+		: PackageInfos(Infos), It(Infos.cbegin())
 	{
 	}
 
@@ -166,8 +168,8 @@ public:
 	inline bool operator!=(const PackageInfoIterator& Other) const { return It != Other.It; }
 
 public:
-	PackageInfoIterator begin() const { return PackageInfoIterator(PackageInfos, CurrentIterationHitCount, PackageInfos.cbegin()); }
-	PackageInfoIterator end() const   { return PackageInfoIterator(PackageInfos, CurrentIterationHitCount, PackageInfos.cend());   }
+	PackageInfoIterator begin() const { return PackageInfoIterator(PackageInfos, PackageInfos.cbegin()); }
+	PackageInfoIterator end() const   { return PackageInfoIterator(PackageInfos, PackageInfos.cend());   }
 };
 
 struct PackageManagerIterationParams
@@ -220,9 +222,12 @@ private:
 	/* Map containing infos on all Packages. Implemented due to information missing in the Unreal's reflection system (PackageSize). */
 	static inline OverrideMaptType PackageInfos;
 
-	/* Count to track how often the PackageInfos was iterated. Allows for up to 2^64 iterations of this list. */
+	/* Count to track how often the package-dependencies were iterated. Allows for up to 2^64 iterations of this list. Guarded by DependencyIterationLock. */
 	static inline uint64 CurrentIterationHitCount = 0x0;
 
+	/* Dependency-iterations mark visited packages in their DependencyInfo, so only one of them can run at a time */
+	static inline std::mutex DependencyIterationLock;
+
 	static inline bool bIsInitialized = false;
 	static inline bool bIsPostInitialized = false;
 
@@ -287,10 +292,9 @@ public:
 		return PackageInfos.at(Package.GetIndex());
 	}
 
+	/* Doesn't modify any state, can be used from multiple threads at the same time */
 	static inline PackageInfoIterator IterateOverPackageInfos()
 	{
-		CurrentIterationHitCount++;
-
-		return PackageInfoIterator(PackageInfos, CurrentIterationHitCount);
+		return PackageInfoIterator(PackageInfos);
 	}
 };
@@ -5,6 +5,7 @@
 #include "ObjectArray.h"
 
 #include <cassert>
+#include <thread>
 
 
 class PackageManagerTest : protected TestBase
@@ -17,6 +18,7 @@ public:
 		TestInfo<bDoDebugPrinting>();
 		TestIncludeTypes<bDoDebugPrinting>();
 		TestMutliIterations<bDoDebugPrinting>();
+		TestConcurrentIterations<bDoDebugPrinting>();
 		TestFindCyclidDependencies<bDoDebugPrinting>();
 		TestCyclicDependencyDetection<bDoDebugPrinting>();
 		TestUniquePackageNameGeneration<bDoDebugPrinting>();
@@ -170,6 +172,74 @@ public:
 		std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
 	}
 
+	/* Generators can run concurrently, iterating packages and visiting their sorted structs/classes from several threads must give the same order as on one thread */
+	template<bool bDoDebugPrinting = false>
+	static inline void TestConcurrentIterations()
+	{
+		PackageManager::Init();
+
+		auto CollectVisitOrder = []() -> std::vector<int32>
+		{
+			std::vector<int32> VisitedIndices;
+
+			DependencyManager::OnVisitCallbackType OnVisit = [&VisitedIndices](int32 Index) -> void
+			{
+				VisitedIndices.push_back(Index);
+			};
+
+			for (PackageInfoHandle Package : PackageManager::IterateOverPackageInfos())
+			{
+				VisitedIndices.push_back(Package.GetIndex());
+
+				if (Package.HasStructs())
+					Package.GetSortedStructs().VisitAllNodesWithCallback(OnVisit);
+
+				if (Package.HasClasses())
+					Package.GetSortedClasses().VisitAllNodesWithCallback(OnVisit);
+			}
+
+			return VisitedIndices;
+		};
+
+		const std::vector<int32> ExpectedOrder = CollectVisitOrder();
+
+		constexpr int32 NumThreads = 0x4;
+
+		std::vector<std::vector<int32>> OrderPerThread(NumThreads);
+		std::vector<std::thread> Threads;
+
+		for (int32 i = 0; i < NumThreads; i++)
+			Threads.emplace_back([&, i]() -> void { OrderPerThread[i] = CollectVisitOrder(); });
+
+		std::vector<int32> DependencyOrder;
+
+		/* Dependency-iteration on this thread, while the other threads iterate the packages */
+		PackageManager::IterateDependencies([&](const PackageManagerIterationParams& OldParams, const PackageManagerIterationParams& NewParams, bool bIsStruct) -> void
+		{
+			DependencyOrder.push_back(OldParams.RequiredPackage);
+		});
+
+		for (std::thread& Thread : Threads)
+			Thread.join();
+
+		bool bSuccededTestWithoutError = true;
+
+		for (const std::vector<int32>& Order : OrderPerThread)
+			SetBoolIfFailed(bSuccededTestWithoutError, Order == ExpectedOrder);
+
+		std::vector<int32> SerialDependencyOrder;
+
+		PackageManager::IterateDependencies([&](const PackageManagerIterationParams& OldParams, const PackageManagerIterationParams& NewParams, bool bIsStruct) -> void
+		{
+			SerialDependencyOrder.push_back(OldParams.RequiredPackage);
+		});
+
+		SetBoolIfFailed(bSuccededTestWithoutError, DependencyOrder == SerialDependencyOrder);
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> {} visits per thread, {} dependency visits", __FUNCTION__, ExpectedOrder.size(), DependencyOrder.size());
+		std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
 	template<bool bDoDebugPrinting = false>
 	static inline void TestFindCyclidDependencies()
 	{
@@ -0,0 +1,90 @@
+#pragma once
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <algorithm>
+
+#include "Enums.h"
+#include "PredefinedMembers.h"
+#include "Profiler.h"
+
+
+namespace ParallelUtils
+{
+	/*
+	* State of the generator running on the current thread. Generators can run concurrently, so this state can't be global.
+	*
+	* ParallelFor copies the context of the calling thread to all of its workers.
+	*/
+	struct GeneratorContext
+	{
+		/* Predefined members and functions of the generator, used by MemberManager */
+		const PredefinedMemberLookupMapType* PredefinedMemberLookup = nullptr;
+	};
+
+	inline thread_local GeneratorContext CurrentGeneratorContext;
+
+	/* Returns the number of worker threads to use. 'RequestedNumThreads' == 0 -> use all hardware threads */
+	inline uint32 GetNumWorkerThreads(uint32 RequestedNumThreads = 0)
+	{
+		if (RequestedNumThreads > 0)
+			return RequestedNumThreads;
+
+		const uint32 NumHardwareThreads = std::thread::hardware_concurrency();
+
+		return NumHardwareThreads > 0 ? NumHardwareThreads : 1;
+	}
+
+	/*
+	* Calls 'Callback(Index)' for every index in [0, NumItems), distributed over a small pool of worker threads.
+	*
+	* Indices are handed out in ascending order through a shared atomic counter, so large items picked up early don't stall the others.
+	* The order in which items *finish* is not deterministic, any output that needs a stable order must be merged by the caller afterwards.
+	*
+	* The calling thread participates in the work and this function only returns once all items have been processed.
+	*/
+	template<typename CallbackType>
+	inline void ParallelFor(int32 NumItems, CallbackType&& Callback, uint32 RequestedNumThreads = 0)
+	{
+		if (NumItems <= 0)
+			return;
+
+		const uint32 NumThreads = std::min<uint32>(GetNumWorkerThreads(RequestedNumThreads), static_cast<uint32>(NumItems));
+
+		if (NumThreads <= 1)
+		{
+			for (int32 i = 0; i < NumItems; i++)
+				Callback(i);
+
+			return;
+		}
+
+		std::atomic<int32> NextIndex = 0x0;
+
+		const GeneratorContext CallerContext = CurrentGeneratorContext;
+
+		auto WorkerLoop = [&]() -> void
+		{
+			CurrentGeneratorContext = CallerContext;
+
+			for (int32 Index = NextIndex.fetch_add(1, std::memory_order_relaxed); Index < NumItems; Index = NextIndex.fetch_add(1, std::memory_order_relaxed))
+				Callback(Index);
+		};
+
+		/* Profiler-scopes around this loop include the work done on the worker-threads */
+		ProfilerChildCounters WorkerCounters;
+
+		std::vector<std::thread> Workers;
+		Workers.reserve(NumThreads - 1);
+
+		for (uint32 i = 0; i < (NumThreads - 1); i++)
+			Workers.emplace_back([&]() -> void { WorkerCounters.Run(WorkerLoop); });
+
+		WorkerLoop();
+
+		for (std::thread& Worker : Workers)
+			Worker.join();
+
+		WorkerCounters.AddToCurrentThread();
+	}
+}
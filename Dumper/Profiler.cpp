@@ -0,0 +1,271 @@
+#include <iostream>
+#include <fstream>
+#include <format>
+#include <algorithm>
+#include <unordered_map>
+#include <new>
+#include <cstdlib>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <time.h>
+#endif
+
+#include "Profiler.h"
+#include "ExternalDependencies/Dumpspace/JsonWriter.h"
+
+
+/*
+* Replacements for the global operator new/delete of this module, to count allocations per thread.
+* Only compiled if DUMPER7_COUNT_ALLOCATIONS is defined (eg. in the project's preprocessor definitions), otherwise the default allocator is used and no allocations are counted.
+*/
+#ifdef DUMPER7_COUNT_ALLOCATIONS
+static_assert(Settings::Debug::bEnableProfiler, "DUMPER7_COUNT_ALLOCATIONS requires Settings::Debug::bEnableProfiler.");
+
+void* operator new(size_t Size)
+{
+	Profiler::OnAllocation(Size);
+
+	if (Size == 0x0)
+		Size = 0x1;
+
+	while (true)
+	{
+		if (void* Ptr = std::malloc(Size))
+			return Ptr;
+
+		std::new_handler Handler = std::get_new_handler();
+
+		if (!Handler)
+			throw std::bad_alloc();
+
+		Handler();
+	}
+}
+
+void operator delete(void* Ptr) noexcept
+{
+	std::free(Ptr);
+}
+
+void operator delete(void* Ptr, [[maybe_unused]] size_t Size) noexcept
+{
+	std::free(Ptr);
+}
+#endif // DUMPER7_COUNT_ALLOCATIONS
+
+
+uint32 Profiler::GetThreadId()
+{
+	static thread_local const uint32 ThreadId = NumThreadIds.fetch_add(1, std::memory_order_relaxed);
+
+	return ThreadId;
+}
+
+uint64 Profiler::GetThreadCpuTimeNs()
+{
+#ifdef _WIN32
+	FILETIME CreationTime, ExitTime, KernelTime, UserTime;
+
+	if (!GetThreadTimes(GetCurrentThread(), &CreationTime, &ExitTime, &KernelTime, &UserTime))
+		return 0x0;
+
+	const uint64 Kernel = (static_cast<uint64>(KernelTime.dwHighDateTime) << 32) | KernelTime.dwLowDateTime;
+	const uint64 User = (static_cast<uint64>(UserTime.dwHighDateTime) << 32) | UserTime.dwLowDateTime;
+
+	/* FILETIME is in 100ns intervals */
+	return (Kernel + User) * 100;
+#else
+	timespec Time;
+
+	if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &Time) != 0)
+		return 0x0;
+
+	return static_cast<uint64>(Time.tv_sec) * 1000000000 + static_cast<uint64>(Time.tv_nsec);
+#endif
+}
+
+uint64 Profiler::GetTimeSinceStartNs()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - StartTime).count();
+}
+
+ProfilerCounters Profiler::GetThreadCounters()
+{
+	ProfilerCounters Counters = ThreadCounters;
+	Counters.CpuTimeNs += GetThreadCpuTimeNs();
+
+	return Counters;
+}
+
+void Profiler::AddChildThreadCounters(const ProfilerCounters& Counters)
+{
+	ThreadCounters += Counters;
+}
+
+void Profiler::AddEvent(Event&& NewEvent)
+{
+	std::scoped_lock Lock(EventsLock);
+
+	Events.push_back(std::move(NewEvent));
+}
+
+std::string Profiler::CreateChromeTrace(const std::vector<Event>& EventsToWrite)
+{
+	std::string Trace;
+	Trace.reserve(EventsToWrite.size() * 0x100);
+
+	JsonWriter Writer(Trace);
+
+	Writer.beginObject();
+	Writer.key("displayTimeUnit");
+	Writer.value("ms");
+
+	Writer.key("traceEvents");
+	Writer.beginArray();
+
+	for (const Event& Evt : EventsToWrite)
+	{
+		/* "Complete" event, timestamps are in microseconds */
+		Writer.beginObject();
+		Writer.key("name");
+		Writer.value(Evt.Name);
+		Writer.key("cat");
+		Writer.value("Dumper-7");
+		Writer.key("ph");
+		Writer.value("X");
+		Writer.key("ts");
+		Writer.value(Evt.StartNs / 1000);
+		Writer.key("dur");
+		Writer.value(Evt.DurationNs / 1000);
+		Writer.key("pid");
+		Writer.value(0x1);
+		Writer.key("tid");
+		Writer.value(Evt.ThreadId);
+
+		Writer.key("args");
+		Writer.beginObject();
+		if (!Evt.Detail.empty())
+		{
+			Writer.key("detail");
+			Writer.value(Evt.Detail);
+		}
+		Writer.key("cpu_us");
+		Writer.value(Evt.Counters.CpuTimeNs / 1000);
+		Writer.key("allocations");
+		Writer.value(Evt.Counters.NumAllocations);
+		Writer.key("allocated_bytes");
+		Writer.value(Evt.Counters.NumAllocatedBytes);
+		Writer.key("bytes_written");
+		Writer.value(Evt.Counters.NumBytesWritten);
+		Writer.endObject();
+
+		Writer.endObject();
+	}
+
+	Writer.endArray();
+	Writer.endObject();
+
+	return Trace;
+}
+
+std::string Profiler::CreateSummaryTable(const std::vector<Event>& EventsToWrite)
+{
+	struct SummaryRow
+	{
+		const char* Name;
+		uint64 NumCalls = 0x0;
+		uint64 TotalNs = 0x0;
+		uint64 MaxNs = 0x0;
+		ProfilerCounters Counters;
+	};
+
+	std::vector<SummaryRow> Rows;
+	std::unordered_map<std::string_view, size_t> RowIndices;
+
+	for (const Event& Evt : EventsToWrite)
+	{
+		auto [It, bInserted] = RowIndices.try_emplace(Evt.Name, Rows.size());
+
+		if (bInserted)
+			Rows.push_back({ Evt.Name });
+
+		SummaryRow& Row = Rows[It->second];
+		Row.NumCalls++;
+		Row.TotalNs += Evt.DurationNs;
+		Row.MaxNs = std::max(Row.MaxNs, Evt.DurationNs);
+		Row.Counters += Evt.Counters;
+	}
+
+	std::stable_sort(Rows.begin(), Rows.end(), [](const SummaryRow& Left, const SummaryRow& Right) -> bool
+	{
+		return Left.TotalNs > Right.TotalNs;
+	});
+
+	constexpr double NsPerMs = 1000000.0;
+	constexpr double BytesPerMB = 1024.0 * 1024.0;
+
+	std::string Table = std::format("{:<56} {:>8} {:>12} {:>12} {:>12} {:>12} {:>12} {:>12}\n", "Scope", "Calls", "Wall [ms]", "Max [ms]", "CPU [ms]", "Allocations", "Alloc [MB]", "Written [MB]");
+	Table += std::string(56 + 1 + 8 + (7 * 13), '-') + '\n';
+
+	for (const SummaryRow& Row : Rows)
+	{
+		Table += std::format("{:<56} {:>8} {:>12.2f} {:>12.2f} {:>12.2f} {:>12} {:>12.2f} {:>12.2f}\n", Row.Name, Row.NumCalls, Row.TotalNs / NsPerMs, Row.MaxNs / NsPerMs,
+			Row.Counters.CpuTimeNs / NsPerMs, Row.Counters.NumAllocations, Row.Counters.NumAllocatedBytes / BytesPerMB, Row.Counters.NumBytesWritten / BytesPerMB);
+	}
+
+	Table += "\nNested scopes are included in their parents. Scopes around parallel work include the CPU time and allocations of their worker-threads.\n";
+
+	return Table;
+}
+
+void Profiler::WriteResults(const fs::path& Folder)
+{
+	if constexpr (!IsEnabled())
+		return;
+
+	std::vector<Event> EventsToWrite;
+	{
+		std::scoped_lock Lock(EventsLock);
+		EventsToWrite = Events;
+	}
+
+	std::sort(EventsToWrite.begin(), EventsToWrite.end(), [](const Event& Left, const Event& Right) -> bool
+	{
+		return Left.StartNs < Right.StartNs;
+	});
+
+	const std::string Trace = CreateChromeTrace(EventsToWrite);
+	const std::string Summary = CreateSummaryTable(EventsToWrite);
+
+	std::ofstream TraceFile(Folder / TraceFileName, std::ios::binary);
+	TraceFile.write(Trace.data(), Trace.size());
+
+	std::ofstream SummaryFile(Folder / SummaryFileName);
+	SummaryFile << Summary;
+
+	std::cout << "\n" << Summary << std::endl;
+}
+
+
+void ProfilerScope::Begin(const char* InName)
+{
+	Name = InName;
+	StartCounters = Profiler::GetThreadCounters();
+	StartNs = Profiler::GetTimeSinceStartNs();
+}
+
+void ProfilerScope::End()
+{
+	const uint64 EndNs = Profiler::GetTimeSinceStartNs();
+
+	Profiler::AddEvent({
+		.Name = Name,
+		.Detail = std::move(Detail),
+		.ThreadId = Profiler::GetThreadId(),
+		.StartNs = StartNs,
+		.DurationNs = EndNs - StartNs,
+		.Counters = Profiler::GetThreadCounters() - StartCounters,
+	});
+}
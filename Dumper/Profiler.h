@@ -0,0 +1,220 @@
+#pragma once
+#include <filesystem>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <concepts>
+
+#include "Enums.h"
+#include "Settings.h"
+
+namespace fs = std::filesystem;
+
+
+struct ProfilerCounters
+{
+	/* CPU time of the thread (user + kernel), including finished worker-threads started by it */
+	uint64 CpuTimeNs = 0x0;
+
+	/* Calls to operator new, and the number of bytes requested. Only counted if DUMPER7_COUNT_ALLOCATIONS is defined, see Profiler.cpp. */
+	uint64 NumAllocations = 0x0;
+	uint64 NumAllocatedBytes = 0x0;
+
+	/* Bytes of files handed to the OutputSink */
+	uint64 NumBytesWritten = 0x0;
+
+public:
+	inline ProfilerCounters& operator+=(const ProfilerCounters& Other)
+	{
+		CpuTimeNs += Other.CpuTimeNs;
+		NumAllocations += Other.NumAllocations;
+		NumAllocatedBytes += Other.NumAllocatedBytes;
+		NumBytesWritten += Other.NumBytesWritten;
+
+		return *this;
+	}
+
+	inline ProfilerCounters operator-(const ProfilerCounters& Other) const
+	{
+		return { CpuTimeNs - Other.CpuTimeNs, NumAllocations - Other.NumAllocations, NumAllocatedBytes - Other.NumAllocatedBytes, NumBytesWritten - Other.NumBytesWritten };
+	}
+};
+
+/*
+* Records named, timed scopes (see ProfilerScope) of all threads and writes them as a Chrome trace ("chrome://tracing", Perfetto) and a summary table.
+*
+* Only active if Settings::Debug::bEnableProfiler is set. Otherwise every function of the profiler compiles to nothing.
+*/
+class Profiler
+{
+private:
+	friend class ProfilerScope;
+	friend class ProfilerTest;
+
+private:
+	struct Event
+	{
+		/* String literal, events are grouped by name in the summary */
+		const char* Name;
+
+		/* Optional, eg. the name of a package */
+		std::string Detail;
+
+		uint32 ThreadId;
+
+		/* Relative to the first use of the profiler */
+		uint64 StartNs;
+		uint64 DurationNs;
+
+		ProfilerCounters Counters;
+	};
+
+private:
+	static constexpr const char* TraceFileName = "ProfilerTrace.json";
+	static constexpr const char* SummaryFileName = "ProfilerSummary.txt";
+
+private:
+	static inline const std::chrono::steady_clock::time_point StartTime = std::chrono::steady_clock::now();
+
+	static inline std::mutex EventsLock;
+	static inline std::vector<Event> Events;
+
+	static inline std::atomic<uint32> NumThreadIds = 0x0;
+
+	/* Counters that can't be queried from the OS, plus the counters of finished child-threads */
+	static inline thread_local ProfilerCounters ThreadCounters;
+
+private:
+	static uint32 GetThreadId();
+	static uint64 GetThreadCpuTimeNs();
+
+	static uint64 GetTimeSinceStartNs();
+
+	static void AddEvent(Event&& NewEvent);
+
+private:
+	static std::string CreateChromeTrace(const std::vector<Event>& EventsToWrite);
+	static std::string CreateSummaryTable(const std::vector<Event>& EventsToWrite);
+
+public:
+	static consteval bool IsEnabled() { return Settings::Debug::bEnableProfiler; }
+
+	static consteval bool IsCountingAllocations()
+	{
+#ifdef DUMPER7_COUNT_ALLOCATIONS
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	/* Counters of the calling thread */
+	static ProfilerCounters GetThreadCounters();
+
+	/* Adds the counters of finished child-threads to the calling thread, so scopes on the calling thread include the work done by them */
+	static void AddChildThreadCounters(const ProfilerCounters& Counters);
+
+	static inline void OnAllocation(size_t Size)
+	{
+		if constexpr (IsEnabled())
+		{
+			ThreadCounters.NumAllocations++;
+			ThreadCounters.NumAllocatedBytes += Size;
+		}
+	}
+
+	static inline void OnBytesWritten(size_t Size)
+	{
+		if constexpr (IsEnabled())
+			ThreadCounters.NumBytesWritten += Size;
+	}
+
+	/* Writes ProfilerTrace.json and ProfilerSummary.txt to 'Folder', directly and not through the OutputSink, so writing the SDK is included */
+	static void WriteResults(const fs::path& Folder);
+};
+
+/* Records the time and counters between construction and destruction as one event */
+class ProfilerScope
+{
+private:
+	const char* Name = nullptr;
+	std::string Detail;
+
+	uint64 StartNs = 0x0;
+	ProfilerCounters StartCounters;
+
+public:
+	/* 'InName' must be a string literal */
+	explicit inline ProfilerScope(const char* InName)
+	{
+		if constexpr (Profiler::IsEnabled())
+			Begin(InName);
+	}
+
+	/* 'GetDetail' is only called if the profiler is enabled, eg. [&]() { return Package.GetName(); } */
+	template<typename DetailProviderType> requires std::invocable<DetailProviderType>
+	inline ProfilerScope(const char* InName, DetailProviderType&& GetDetail)
+	{
+		if constexpr (Profiler::IsEnabled())
+		{
+			Detail = GetDetail();
+			Begin(InName);
+		}
+	}
+
+	inline ~ProfilerScope()
+	{
+		if constexpr (Profiler::IsEnabled())
+			End();
+	}
+
+	ProfilerScope(const ProfilerScope&) = delete;
+	ProfilerScope& operator=(const ProfilerScope&) = delete;
+
+private:
+	void Begin(const char* InName);
+	void End();
+};
+
+/*
+* Collects the counters of worker-threads, to add them to the thread that started the workers once they finished.
+*
+* Without this, a scope around a parallel loop would only contain the CPU time and allocations of the thread that started the loop.
+*/
+class ProfilerChildCounters
+{
+private:
+	std::mutex Lock;
+	ProfilerCounters Sum;
+
+public:
+	/* Called on the worker-thread */
+	template<typename CallbackType>
+	inline void Run(CallbackType&& Callback)
+	{
+		if constexpr (Profiler::IsEnabled())
+		{
+			const ProfilerCounters StartCounters = Profiler::GetThreadCounters();
+
+			Callback();
+
+			const ProfilerCounters Delta = Profiler::GetThreadCounters() - StartCounters;
+
+			std::scoped_lock ScopedLock(Lock);
+			Sum += Delta;
+		}
+		else
+		{
+			Callback();
+		}
+	}
+
+	/* Called on the thread that started the workers, after they were joined */
+	inline void AddToCurrentThread()
+	{
+		if constexpr (Profiler::IsEnabled())
+			Profiler::AddChildThreadCounters(Sum);
+	}
+};
@@ -0,0 +1,94 @@
+#pragma once
+#include "Profiler.h"
+#include "ExternalDependencies/Json/json.hpp"
+#include "TestBase.h"
+
+
+/* Works on handcrafted events, so the tests don't depend on Settings::Debug::bEnableProfiler */
+class ProfilerTest : protected TestBase
+{
+private:
+	static inline std::vector<Profiler::Event> CreateTestEvents()
+	{
+		std::vector<Profiler::Event> TestEvents;
+
+		TestEvents.push_back({ "Generator::Generate", "", 0x0, 0x0, 10000000, { 9000000, 100, 4096, 2048 } });
+		TestEvents.push_back({ "CppGenerator::GeneratePackage", "Engine", 0x1, 1000, 3000000, { 3000000, 40, 1024, 1024 } });
+		TestEvents.push_back({ "CppGenerator::GeneratePackage", "Core\"UObject", 0x2, 2000, 5000000, { 4000000, 60, 2048, 1024 } });
+
+		return TestEvents;
+	}
+
+public:
+	template<bool bDoDebugPrinting = false>
+	static inline void TestAll()
+	{
+		TestChromeTrace<bDoDebugPrinting>();
+		TestSummaryTable<bDoDebugPrinting>();
+
+		PrintDbgMessage<bDoDebugPrinting>("");
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestChromeTrace()
+	{
+		bool bSucceeded = true;
+
+		const std::vector<Profiler::Event> TestEvents = CreateTestEvents();
+		const std::string Trace = Profiler::CreateChromeTrace(TestEvents);
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> {}", __FUNCTION__, Trace);
+
+		const nlohmann::json Parsed = nlohmann::json::parse(Trace, nullptr, false);
+
+		SetBoolIfFailed(bSucceeded, !Parsed.is_discarded() && Parsed.contains("traceEvents"));
+
+		if (bSucceeded)
+		{
+			const nlohmann::json& TraceEvents = Parsed["traceEvents"];
+
+			SetBoolIfFailed(bSucceeded, TraceEvents.size() == TestEvents.size());
+
+			for (int32 i = 0; bSucceeded && i < static_cast<int32>(TestEvents.size()); i++)
+			{
+				const Profiler::Event& Expected = TestEvents[i];
+				const nlohmann::json& Evt = TraceEvents[i];
+
+				SetBoolIfFailed(bSucceeded, Evt["name"] == Expected.Name && Evt["ph"] == "X");
+				SetBoolIfFailed(bSucceeded, Evt["ts"] == Expected.StartNs / 1000 && Evt["dur"] == Expected.DurationNs / 1000 && Evt["tid"] == Expected.ThreadId);
+				SetBoolIfFailed(bSucceeded, Evt["args"]["allocations"] == Expected.Counters.NumAllocations && Evt["args"]["bytes_written"] == Expected.Counters.NumBytesWritten);
+				SetBoolIfFailed(bSucceeded, Expected.Detail.empty() ? !Evt["args"].contains("detail") : Evt["args"]["detail"] == Expected.Detail);
+			}
+		}
+
+		std::cout << __FUNCTION__ << ": " << (bSucceeded ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestSummaryTable()
+	{
+		bool bSucceeded = true;
+
+		const std::string Table = Profiler::CreateSummaryTable(CreateTestEvents());
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> \n{}", __FUNCTION__, Table);
+
+		const size_t GenerateRow = Table.find("Generator::Generate ");
+		const size_t PackageRow = Table.find("CppGenerator::GeneratePackage ");
+
+		/* One row per name, sorted by total wall time (10ms > 3ms + 5ms) */
+		SetBoolIfFailed(bSucceeded, GenerateRow != std::string::npos && PackageRow != std::string::npos && GenerateRow < PackageRow);
+		SetBoolIfFailed(bSucceeded, Table.find("CppGenerator::GeneratePackage ", PackageRow + 1) == std::string::npos);
+
+		/* Aggregated row: 2 calls, 8ms wall, 5ms max, 7ms CPU, 100 allocations */
+		if (PackageRow != std::string::npos)
+		{
+			const std::string Row = Table.substr(PackageRow, Table.find('\n', PackageRow) - PackageRow);
+			const std::string ExpectedRow = std::format("{:<56} {:>8} {:>12.2f} {:>12.2f} {:>12.2f} {:>12}", "CppGenerator::GeneratePackage", 2, 8.0, 5.0, 7.0, 100);
+
+			SetBoolIfFailed(bSucceeded, Row.starts_with(ExpectedRow));
+		}
+
+		std::cout << __FUNCTION__ << ": " << (bSucceeded ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+};
@@ -12,6 +12,15 @@ namespace Settings
 		inline std::string GameVersion = "";
 
 		inline constexpr const char* SDKGenerationPath = "C:/Dumper-7";
+
+		/* Whether generated files are written to disk by a background thread, while generation continues. Generators always write into memory first. */
+		inline constexpr bool bWriteFilesOnBackgroundThread = true;
+
+		/* Whether files whose content didn't change since the last run are left untouched (keeping their timestamps), instead of moving the old SDK to a "_OLD" folder and rewriting everything. Enable for incremental rebuilds of the SDK. */
+		inline constexpr bool bOnlyWriteChangedFiles = false;
+
+		/* Whether all generators (Cpp, Mappings, IDAMappings, Dumpspace) run at the same time, each on its own thread. The output is identical either way. */
+		inline constexpr bool bRunGeneratorsConcurrently = true;
 	}
 
 	namespace CppGenerator
@@ -50,6 +59,48 @@ R"(
 
 		/* This will allow the user to manually initialize global variable addresses in the SDK (eg. GObjects, GNames, AppendString). */
 		constexpr bool bAddManualOverrideOptions = true;
+
+		/* Whether UObject::FindObject/FindObjectFast in the SDK use a lazily built index of GObjects by FName, instead of comparing the name of every object on every call. */
+		constexpr bool bAddObjectNameIndex = true;
+
+		/* Whether Basic.cpp contains 'ObjectNameIndex::Benchmark()', which times lookups with and without the index. Requires bAddObjectNameIndex. */
+		constexpr bool bAddObjectNameIndexBenchmark = false;
+
+		/* Whether the generated functions in '*_functions.cpp' get their UFunction* from a per-package table, resolved with one pass over GObjects, instead of calling UClass::GetFunction. */
+		constexpr bool bAddFunctionTables = true;
+
+		/* Whether the SDK gets 'InitAll()', which resolves the UClass of every StaticClass() with a single pass over GObjects into a perfect-hash table, also used by UObject::FindClassFast/FindClass. Ignored if XORString is used, the table contains the plain class-names. */
+		constexpr bool bAddStaticClassTable = true;
+
+		/* Whether UObject::IsA<T>() and UStruct::IsSubclassOf in the SDK use cached ancestor-arrays (and cast-flags), instead of walking the Super-chain on every call. */
+		constexpr bool bAddClassBaseChains = true;
+
+		/* Whether Basic.cpp contains 'ClassBaseChain::Benchmark()', which times inheritance checks with and without the base-chains. Requires bAddClassBaseChains. */
+		constexpr bool bAddClassBaseChainBenchmark = false;
+
+		/*
+		* Whether generated wrappers of native functions call the UFunction's ExecFunction with a minimal FFrame, instead of going through ProcessEvent.
+		* Skips ProcessEvent and doesn't modify UFunction::FunctionFlags. Off by default, the layout of FFrame has to match the games' engine version (see 'NativeCall' in Basic.hpp).
+		*/
+		constexpr bool bCallNativeFunctionsDirectly = false;
+
+		/* Whether Basic.cpp contains 'ContainerLookup::Benchmark()', which times the hashed TSet/TMap lookups on a synthetic container. The lookups are tested by UnrealFixtureTest::TestContainerLookup. */
+		constexpr bool bAddContainerLookupBenchmark = false;
+
+		/* Whether Basic.cpp contains 'ObjectIteration::Benchmark()', which times passes over GObjects with GetByIndex, the iterator, ForEachObject and ForEachObjectParallel. */
+		constexpr bool bAddObjectIterationBenchmark = false;
+
+		/* Whether FName::GetCachedString() is added to the SDK, which converts each name once and returns a std::string_view into a table of cached names. */
+		constexpr bool bAddNameCache = true;
+
+		/* Whether every generated struct and class gets 'ReflectedMembers', a constexpr array of its members (name, offset, size, kind, bit-mask, type-id), visited by 'MemberReflection::ForEachMember'. Adds a line per member to the SDK. */
+		constexpr bool bAddMemberReflection = false;
+
+		/* Whether packages should be generated on multiple threads. Every package writes to its own files, the output is identical either way. */
+		constexpr bool bGeneratePackagesInParallel = true;
+
+		/* Number of threads used to generate packages in parallel -> 0 = std::thread::hardware_concurrency() */
+		constexpr uint32 NumGeneratorThreads = 0;
 	}
 
 	namespace MappingGenerator
@@ -60,8 +111,32 @@ R"(
 		/* Whether EditorOnly should be excluded from the mapping file. */
 		constexpr bool bExcludeEditorOnlyProperties = false;
 
+		/* Whether packages should be serialized on multiple threads. The payloads are merged in package order, the file is identical either way. */
+		constexpr bool bGeneratePackagesInParallel = true;
+
+		/* Number of threads used to serialize packages in parallel -> 0 = std::thread::hardware_concurrency() */
+		constexpr uint32 NumGeneratorThreads = 0;
+
 		/* Which compression method to use when generating the file. */
 		constexpr EUsmapCompressionMethod CompressionMethod = EUsmapCompressionMethod::ZStandard;
+
+		/* ZStandard compression level, 1 (fastest) to 22 (smallest). Levels above 19 are a lot slower while only saving a few percent. */
+		constexpr int32 ZStandardCompressionLevel = 19;
+
+		/* Number of threads used for ZStandard compression. 0 -> use all hardware threads */
+		constexpr uint32 NumCompressionThreads = 0;
+
+		/* Whether ZStandard should use long-distance-matching, which finds repetitions far apart in the mappings (eg. similar structs in different packages). */
+		constexpr bool bUseLongDistanceMatching = true;
+	}
+
+	namespace DumpspaceGenerator
+	{
+		/* Whether packages should be baked on multiple threads. Every package is baked into its own fragment, fragments are written in package order. */
+		constexpr bool bGeneratePackagesInParallel = true;
+
+		/* Number of threads used to bake packages in parallel -> 0 = std::thread::hardware_concurrency() */
+		constexpr uint32 NumGeneratorThreads = 0;
 	}
 
 	/* Partially implemented  */
@@ -75,9 +150,18 @@ R"(
 		/* Adds static_assert for member-offsets */
 		inline constexpr bool bGenerateInlineAssertionsForStructMembers = true;
 
+		/* Adds static_asserts re-hashing every name of the StaticClass() table while Basic.cpp is compiled. The CppGenerator already checks the table, this makes compiling the SDK slower. */
+		inline constexpr bool bValidateStaticClassTableAtCompileTime = false;
+
 
 		/* Prints debug information during Mapping-Generation */
 		inline constexpr bool bShouldPrintMappingDebugData = false;
+
+		/* Records wall time, CPU time, allocations and written bytes of every init-step, generator and package. Writes "ProfilerTrace.json" (chrome://tracing) and "ProfilerSummary.txt" next to the SDK. Allocations are only counted if DUMPER7_COUNT_ALLOCATIONS is defined. */
+		inline constexpr bool bEnableProfiler = false;
+
+		/* Counts calls to GetByIndex, IsBadReadPtr, FName resolution, FindObject-scans, HashStringTable lookups and GetProperties. Writes "HotPathStats.json" next to the SDK. */
+		inline constexpr bool bEnableHotPathCounters = false;
 	}
 
 	//* * * * * * * * * * * * * * * * * * * * *// 
@@ -2,8 +2,44 @@
 #include <iostream>
 #include <format>
 
+#include "Enums.h"
+#include "Profiler.h"
+
 class TestBase
 {
+protected:
+	/*
+	* Counts calls to operator new of the calling thread while this object is alive.
+	*
+	* Uses the allocation counters of the Profiler, if DUMPER7_COUNT_ALLOCATIONS isn't defined 'IsSupported()' returns false and the count always stays 0.
+	*/
+	class ScopedAllocationCounter
+	{
+	private:
+		uint64 StartNumAllocations = 0x0;
+
+	public:
+		inline ScopedAllocationCounter()
+		{
+			if constexpr (Profiler::IsCountingAllocations())
+				StartNumAllocations = Profiler::GetThreadCounters().NumAllocations;
+		}
+
+	public:
+		static constexpr bool IsSupported()
+		{
+			return Profiler::IsCountingAllocations();
+		}
+
+		inline uint64 GetNumAllocations() const
+		{
+			if constexpr (Profiler::IsCountingAllocations())
+				return Profiler::GetThreadCounters().NumAllocations - StartNumAllocations;
+
+			return 0x0;
+		}
+	};
+
 protected:
 	template<bool bPrint, bool bFlushWithEndl = true, typename... FmtArgs>
 	static inline void PrintDbgMessage(const char* FmtStr, FmtArgs&&... Args)
@@ -21,4 +57,4 @@ protected:
 	{
 		BoolToSet = BoolToSet && bSucceded;
 	}
-};
\ No newline at end of file
+};
@@ -0,0 +1,63 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <format>
+#include <iterator>
+#include <deque>
+
+#include "Enums.h"
+
+
+namespace TextBuffer
+{
+	/* Formats directly into the end of 'Out', without creating a temporary std::string like std::format does */
+	template<typename... ArgTypes>
+	inline void AppendFormat(std::string& Out, std::format_string<ArgTypes...> Fmt, ArgTypes&&... Args)
+	{
+		std::format_to(std::back_inserter(Out), Fmt, std::forward<ArgTypes>(Args)...);
+	}
+
+	/*
+	* Temporary string borrowed from a per-thread pool. The string is empty when borrowed and returned to the pool when this object is destroyed.
+	*
+	* Clearing a std::string keeps its capacity, so once the pool is warmed up no further heap-allocations are made for temporary text.
+	* Scratch strings can be nested (eg. recursive struct generation), each nesting-level uses a different string of the pool.
+	*/
+	class ScratchString
+	{
+	private:
+		/* std::deque never moves its elements when growing, references to pooled strings stay valid */
+		static inline thread_local std::deque<std::string> Pool;
+		static inline thread_local uint32 NumStringsInUse = 0x0;
+
+	private:
+		std::string* Str;
+
+	public:
+		inline ScratchString()
+		{
+			if (NumStringsInUse >= Pool.size())
+				Pool.emplace_back();
+
+			Str = &Pool[NumStringsInUse++];
+			Str->clear();
+		}
+
+		inline ~ScratchString()
+		{
+			NumStringsInUse--;
+		}
+
+		ScratchString(const ScratchString&) = delete;
+		ScratchString& operator=(const ScratchString&) = delete;
+
+	public:
+		inline std::string& Get() { return *Str; }
+		inline const std::string& Get() const { return *Str; }
+
+		inline operator std::string_view() const { return *Str; }
+
+		inline std::string* operator->() { return Str; }
+		inline std::string& operator*() { return *Str; }
+	};
+}
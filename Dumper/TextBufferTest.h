@@ -0,0 +1,132 @@
+#pragma once
+#include "TextBuffer.h"
+#include "TestBase.h"
+
+#include <chrono>
+
+
+class TextBufferTest : protected TestBase
+{
+private:
+	/* Member-lines as CppGenerator used to create them, a temporary std::string for every part of the line */
+	static inline void AppendMemberLineWithTemporaries(std::string& Out, int32 Index)
+	{
+		std::string Comment = std::format("0x{:04X} (0x{:04X}) ({})", Index * 0x8, 0x8, "Edit, BlueprintVisible, NativeAccessSpecifierPublic");
+		std::string Type = std::format("TArray<{}>", std::format("class {}*", "UObject"));
+		std::string Name = std::format("Member_{}", Index);
+
+		Out += std::format("\t{:{}} {:{}} // {}\n", Type, 45, Name + ";", 50, std::move(Comment));
+	}
+
+	/* Member-lines as CppGenerator creates them now, formatted in-place into scratch-strings and the output */
+	static inline void AppendMemberLineInPlace(std::string& Out, int32 Index)
+	{
+		TextBuffer::ScratchString Comment;
+		TextBuffer::ScratchString Type;
+		TextBuffer::ScratchString Name;
+
+		TextBuffer::AppendFormat(*Comment, "0x{:04X} (0x{:04X}) ({})", Index * 0x8, 0x8, "Edit, BlueprintVisible, NativeAccessSpecifierPublic");
+		TextBuffer::AppendFormat(*Type, "TArray<class {}*>", "UObject");
+		TextBuffer::AppendFormat(*Name, "Member_{};", Index);
+
+		TextBuffer::AppendFormat(Out, "\t{:{}} {:{}} // {}\n", Type.Get(), 45, Name.Get(), 50, Comment.Get());
+	}
+
+	template<typename AppendFuncType>
+	static inline std::pair<double, uint64> MeasureMemberEmission(std::string& Out, int32 NumMembers, AppendFuncType&& AppendFunc)
+	{
+		Out.clear();
+
+		ScopedAllocationCounter AllocationCounter;
+
+		auto StartTime = std::chrono::high_resolution_clock::now();
+
+		for (int32 i = 0; i < NumMembers; i++)
+			AppendFunc(Out, i);
+
+		const double Time = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - StartTime).count();
+
+		return { Time, AllocationCounter.GetNumAllocations() };
+	}
+
+public:
+	template<bool bDoDebugPrinting = false>
+	static inline void TestAll()
+	{
+		TestScratchStringNesting<bDoDebugPrinting>();
+		TestInPlaceOutputMatches<bDoDebugPrinting>();
+
+		PrintDbgMessage<bDoDebugPrinting>("");
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestScratchStringNesting()
+	{
+		bool bSucceeded = true;
+
+		const std::string* OuterAddress = nullptr;
+
+		{
+			TextBuffer::ScratchString Outer;
+			*Outer = "Outer";
+
+			OuterAddress = &Outer.Get();
+
+			{
+				TextBuffer::ScratchString Inner;
+
+				SetBoolIfFailed(bSucceeded, &Inner.Get() != &Outer.Get());
+				SetBoolIfFailed(bSucceeded, Inner->empty());
+
+				*Inner = "Inner";
+			}
+
+			SetBoolIfFailed(bSucceeded, Outer.Get() == "Outer");
+		}
+
+		/* The same string is handed out again, cleared, but with its capacity kept */
+		{
+			TextBuffer::ScratchString Reused;
+
+			SetBoolIfFailed(bSucceeded, &Reused.Get() == OuterAddress);
+			SetBoolIfFailed(bSucceeded, Reused->empty());
+		}
+
+		std::cout << __FUNCTION__ << ": " << (bSucceeded ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestInPlaceOutputMatches()
+	{
+		std::string WithTemporaries;
+		std::string InPlace;
+
+		for (int32 i = 0; i < 0x100; i++)
+		{
+			AppendMemberLineWithTemporaries(WithTemporaries, i);
+			AppendMemberLineInPlace(InPlace, i);
+		}
+
+		const bool bSucceeded = WithTemporaries == InPlace;
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> Size with temporaries: 0x{:X}, Size in-place: 0x{:X}", __FUNCTION__, WithTemporaries.size(), InPlace.size());
+		std::cout << __FUNCTION__ << ": " << (bSucceeded ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	/* Allocation counts require DUMPER7_COUNT_ALLOCATIONS, see 'ScopedAllocationCounter' */
+	template<bool bDoDebugPrinting = true>
+	static inline void BenchmarkMemberEmission(int32 NumMembers = 1000000)
+	{
+		std::string Out;
+		Out.reserve(static_cast<size_t>(NumMembers) * 0x80);
+
+		/* Warm up the scratch-string pool of this thread, like the first struct of a package would */
+		AppendMemberLineInPlace(Out, 0);
+
+		auto [TemporariesTime, TemporariesAllocations] = MeasureMemberEmission(Out, NumMembers, &AppendMemberLineWithTemporaries);
+		auto [InPlaceTime, InPlaceAllocations] = MeasureMemberEmission(Out, NumMembers, &AppendMemberLineInPlace);
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> {} members: temporaries {:.2f}ms ({} allocations), in-place {:.2f}ms ({} allocations){}",
+			__FUNCTION__, NumMembers, TemporariesTime, TemporariesAllocations, InPlaceTime, InPlaceAllocations, ScopedAllocationCounter::IsSupported() ? "" : " [allocations are only counted if DUMPER7_COUNT_ALLOCATIONS is defined]");
+	}
+};
@@ -0,0 +1,1057 @@
+#include <cstring>
+#include <algorithm>
+
+#include "UnrealFixture.h"
+
+
+namespace
+{
+	constexpr EObjectFlags NativeObjectFlags = EObjectFlags::Public | EObjectFlags::Standalone | EObjectFlags::MarkAsNative | EObjectFlags::MarkAsRootSet;
+	constexpr EObjectFlags DefaultObjectFlags = EObjectFlags::Public | EObjectFlags::ClassDefaultObject | EObjectFlags::ArchetypeObject;
+	constexpr EObjectFlags InstanceObjectFlags = EObjectFlags::Public | EObjectFlags::Transactional;
+
+	/* RF_Public | RF_MarkAsNative | RF_Transient, what the engine uses for native FFields */
+	constexpr EObjectFlags FieldObjectFlags = EObjectFlags::Public | EObjectFlags::MarkAsNative | EObjectFlags::Transient;
+
+	constexpr int32 PackageObjectSize = 0x80;
+
+	constexpr EFunctionFlags StaticLibraryFunctionFlags = EFunctionFlags::Final | EFunctionFlags::Native | EFunctionFlags::Static | EFunctionFlags::Public | EFunctionFlags::BlueprintCallable;
+	constexpr EFunctionFlags PureMemberFunctionFlags = EFunctionFlags::Final | EFunctionFlags::Native | EFunctionFlags::Public | EFunctionFlags::BlueprintCallable | EFunctionFlags::BlueprintPure | EFunctionFlags::Const;
+	constexpr EFunctionFlags MemberFunctionFlags = EFunctionFlags::Final | EFunctionFlags::Native | EFunctionFlags::Public | EFunctionFlags::BlueprintCallable;
+	constexpr EFunctionFlags ExecFunctionFlags = EFunctionFlags::Exec | EFunctionFlags::Native | EFunctionFlags::Public;
+
+	/* The flags OffsetFinder::FindPropertyFlagsOffset() searches for */
+	constexpr EPropertyFlags GuidMemberFlags = EPropertyFlags::Edit | EPropertyFlags::ZeroConstructor | EPropertyFlags::SaveGame | EPropertyFlags::IsPlainOldData | EPropertyFlags::NoDestructor | EPropertyFlags::HasGetValueTypeHash;
+	constexpr EPropertyFlags ColorMemberFlags = GuidMemberFlags | EPropertyFlags::BlueprintVisible;
+}
+
+
+UnrealFixtureLayout UnrealFixtureLayout::Create(bool bUseFProperty)
+{
+	UnrealFixtureLayout Layout;
+
+	if (bUseFProperty)
+		return Layout;
+
+	/* UStruct without ChildProperties, UnresolvedScriptProperties and UnversionedSchema */
+	Layout.UStructChildProperties = -1;
+	Layout.UStructSize = 0x50;
+	Layout.UStructMinAlignment = 0x54;
+	Layout.UStructStructSize = 0x98;
+
+	Layout.UClassCastFlags = 0xB8;
+	Layout.UClassDefaultObject = 0x100;
+	Layout.UClassSize = 0x218;
+
+	Layout.UScriptStructSize = 0xA8;
+
+	Layout.UFunctionFunctionFlags = 0x98;
+	Layout.UFunctionNumParms = 0x9C;
+	Layout.UFunctionParmsSize = 0x9E;
+	Layout.UFunctionReturnValueOffset = 0xA0;
+	Layout.UFunctionExecFunction = 0xC0;
+	Layout.UFunctionSize = 0xC8;
+
+	/* UProperty : UField */
+	Layout.PropertyArrayDim = 0x30;
+	Layout.PropertyElementSize = 0x34;
+	Layout.PropertyFlags = 0x38;
+	Layout.PropertyOffsetInternal = 0x44;
+	Layout.PropertySize = 0x70;
+
+	return Layout;
+}
+
+
+uint8* UnrealFixture::MemoryArena::Allocate(uint64 Size)
+{
+	Size = Align<uint64>(Size, 0x10);
+
+	NumBytesAllocated += Size;
+
+	/* Big allocations, like GObjects chunks, get a block of their own */
+	if (Size > (BlockSize / 0x4))
+	{
+		Blocks.push_back(std::make_unique<uint8[]>(Size));
+		return Blocks.back().get();
+	}
+
+	if (Size > NumBytesLeft)
+	{
+		Blocks.push_back(std::make_unique<uint8[]>(BlockSize));
+		Current = Blocks.back().get();
+		NumBytesLeft = BlockSize;
+	}
+
+	uint8* Allocation = Current;
+
+	Current += Size;
+	NumBytesLeft -= Size;
+
+	return Allocation;
+}
+
+
+UnrealFixture::UnrealFixture(const UnrealFixtureConfig& FixtureConfig)
+	: Config(FixtureConfig), Layout(UnrealFixtureLayout::Create(FixtureConfig.bUseFProperty))
+{
+	for (void*& Entry : VTable)
+		Entry = reinterpret_cast<void*>(&UnusedVirtualFunction);
+
+	VTable[ProcessEventIndex] = reinterpret_cast<void*>(&ProcessEvent);
+
+	/* The first fixture stays active, others (eg. for benchmarks) can be created and destroyed alongside of it */
+	if (!ActiveFixture)
+		ActiveFixture = this;
+
+	Objects.reserve(std::max(Config.NumObjects, 0x800) + 0x400);
+
+	InitNameTable();
+
+	CreateCoreUObject();
+	CreateEngine();
+
+	for (int32 i = 0; i < Config.NumPackages; i++)
+		CreateGeneratedPackage(i);
+
+	CreateCyclicPackages();
+
+	CreateInstances();
+
+	FinalizeObjectArray();
+}
+
+UnrealFixture::~UnrealFixture()
+{
+	if (ActiveFixture != this)
+		return;
+
+	ActiveFixture = nullptr;
+	GWorld = nullptr;
+}
+
+const UnrealFixture::PropertyTypeInfo& UnrealFixture::GetTypeInfo(EPropertyType Type)
+{
+	static const PropertyTypeInfo TypeInfos[static_cast<int32>(EPropertyType::Num)] =
+	{
+		{ "ByteProperty", EClassCastFlags::ByteProperty | EClassCastFlags::NumericProperty | EClassCastFlags::Property, 0x01, 0x1 },
+		{ "IntProperty", EClassCastFlags::IntProperty | EClassCastFlags::NumericProperty | EClassCastFlags::Property, 0x04, 0x4 },
+		{ "FloatProperty", EClassCastFlags::FloatProperty | EClassCastFlags::NumericProperty | EClassCastFlags::Property, 0x04, 0x4 },
+		{ "BoolProperty", EClassCastFlags::BoolProperty | EClassCastFlags::Property, 0x01, 0x1 },
+		{ "NameProperty", EClassCastFlags::NameProperty | EClassCastFlags::Property, 0x08, 0x4 },
+		{ "StrProperty", EClassCastFlags::StrProperty | EClassCastFlags::Property, 0x10, 0x8 },
+		{ "TextProperty", EClassCastFlags::TextProperty | EClassCastFlags::Property, 0x18, 0x8 },
+		{ "ObjectProperty", EClassCastFlags::ObjectProperty | EClassCastFlags::ObjectPropertyBase | EClassCastFlags::Property, 0x08, 0x8 },
+		{ "ClassProperty", EClassCastFlags::ClassProperty | EClassCastFlags::ObjectProperty | EClassCastFlags::ObjectPropertyBase | EClassCastFlags::Property, 0x08, 0x8 },
+		{ "SoftObjectProperty", EClassCastFlags::SoftObjectProperty | EClassCastFlags::ObjectPropertyBase | EClassCastFlags::Property, 0x28, 0x8 },
+		{ "StructProperty", EClassCastFlags::StructProperty | EClassCastFlags::Property, 0x00, 0x1 },
+		{ "ArrayProperty", EClassCastFlags::ArrayProperty | EClassCastFlags::Property, 0x10, 0x8 },
+		{ "MapProperty", EClassCastFlags::MapProperty | EClassCastFlags::Property, 0x50, 0x8 },
+		{ "SetProperty", EClassCastFlags::SetProperty | EClassCastFlags::Property, 0x50, 0x8 },
+		{ "EnumProperty", EClassCastFlags::EnumProperty | EClassCastFlags::Property, 0x01, 0x1 },
+		{ "DelegateProperty", EClassCastFlags::DelegateProperty | EClassCastFlags::Property, 0x10, 0x4 },
+		{ "FieldPathProperty", EClassCastFlags::FieldPathProperty | EClassCastFlags::Property, 0x20, 0x8 },
+	};
+
+	return TypeInfos[static_cast<int32>(Type)];
+}
+
+void UnrealFixture::ExecFunction(void* Context, void* Stack, void* Result)
+{
+	/* Only the address matters, OffsetFinder::FindFunctionNativeFuncOffset() checks if it's inside of the image */
+}
+
+void UnrealFixture::UnusedVirtualFunction()
+{
+}
+
+void UnrealFixture::ProcessEvent(void* Object, void* Function, void* Params)
+{
+	/* Only Conv_StringToText is implemented, Off::InSDK::Text::InitTextOffsets() calls it to find the layout of FText */
+	if (!ActiveFixture || Function != ActiveFixture->ConvStringToText)
+		return;
+
+	/*
+	* Params: { FString InString; FText ReturnValue; }
+	* FText: { FTextData* TextData; void* SharedReferenceCount; uint32 Flags; }, the FTextData stores a copy of the FString at offset 0x28
+	*/
+	uint8* ParamsPtr = static_cast<uint8*>(Params);
+	uint8* TextData = ActiveFixture->TextData;
+
+	memcpy(TextData + 0x28, ParamsPtr, 0x10);
+
+	Write<uint8*>(ParamsPtr, 0x10, TextData);
+}
+
+
+void UnrealFixture::InitNameTable()
+{
+	if (Config.bUseNamePool)
+	{
+		/* FNamePool { FRWLock Lock; uint32 CurrentBlock; uint32 CurrentByteCursor; uint8* Blocks[8192]; } */
+		GNames = Arena.Allocate(0x10 + (NamePoolMaxBlocks * sizeof(void*)));
+
+		Write<uint8*>(GNames, 0x10, Arena.Allocate(NamePoolBlockSize));
+	}
+	else
+	{
+		/* TNameEntryArray { FNameEntry** Chunks[128]; int32 NumElements; int32 NumChunks; }, the size is what NameArray::InitializeNameArray() scans */
+		GNames = Arena.Allocate(0x800);
+	}
+
+	/* NameArray::InitializeNamePool() requires "None" and "ByteProperty" to be the first two names, "/Script/CoreUObject" has to follow shortly after */
+	AddName("None");
+
+	for (int32 i = 0; i < static_cast<int32>(EPropertyType::Num); i++)
+		AddName(GetTypeInfo(static_cast<EPropertyType>(i)).Name);
+}
+
+int32 UnrealFixture::AddName(const std::string& Name)
+{
+	auto [It, bInserted] = NameIndices.try_emplace(Name, 0x0);
+
+	if (!bInserted)
+		return It->second;
+
+	const int32 NameLength = static_cast<int32>(Name.length());
+
+	if (Config.bUseNamePool)
+	{
+		/* FNameEntry { uint16 bIsWide : 1; uint16 LowercaseProbeHash : 5; uint16 Len : 10; char AnsiName[Len]; }, with an alignment of 2 */
+		const int32 EntrySize = Align(static_cast<int32>(sizeof(uint16)) + NameLength, 0x2);
+
+		if ((CurrentNameByteCursor + EntrySize) > NamePoolBlockSize)
+			StartNewNameBlock();
+
+		uint8* Entry = Read<uint8*>(GNames, 0x10 + (CurrentNameBlock * sizeof(void*))) + CurrentNameByteCursor;
+
+		Write<uint16>(Entry, 0x0, static_cast<uint16>(NameLength << 6));
+		memcpy(Entry + sizeof(uint16), Name.data(), NameLength);
+
+		It->second = (CurrentNameBlock << 16) | (CurrentNameByteCursor / 0x2);
+
+		CurrentNameByteCursor += EntrySize;
+
+		Write<uint32>(GNames, 0x8, CurrentNameBlock);
+		Write<uint32>(GNames, 0xC, CurrentNameByteCursor);
+	}
+	else
+	{
+		/* FNameEntry { FNameEntry* HashNext; int32 Index; char AnsiName[]; } */
+		const int32 ChunkIndex = NumNames / NameArrayElementsPerChunk;
+
+		if (!Read<uint8*>(GNames, ChunkIndex * sizeof(void*)))
+			Write<uint8*>(GNames, ChunkIndex * sizeof(void*), Arena.Allocate(NameArrayElementsPerChunk * sizeof(void*)));
+
+		uint8* Entry = Arena.Allocate(0xC + NameLength + 0x1);
+
+		Write<int32>(Entry, 0x8, NumNames << 1);
+		memcpy(Entry + 0xC, Name.data(), NameLength);
+
+		Write<uint8*>(Read<uint8*>(GNames, ChunkIndex * sizeof(void*)), (NumNames % NameArrayElementsPerChunk) * sizeof(void*), Entry);
+
+		It->second = NumNames;
+
+		Write<int32>(GNames, NameArrayMaxChunks * sizeof(void*), NumNames + 1);
+		Write<int32>(GNames, (NameArrayMaxChunks * sizeof(void*)) + 0x4, ChunkIndex + 1);
+	}
+
+	NumNames++;
+
+	return It->second;
+}
+
+void UnrealFixture::StartNewNameBlock()
+{
+	CurrentNameBlock++;
+	CurrentNameByteCursor = 0x0;
+
+	Write<uint8*>(GNames, 0x10 + (CurrentNameBlock * sizeof(void*)), Arena.Allocate(NamePoolBlockSize));
+
+	Write<uint32>(GNames, 0x8, CurrentNameBlock);
+	Write<uint32>(GNames, 0xC, CurrentNameByteCursor);
+}
+
+void UnrealFixture::WriteName(uint8* Address, int32 Offset, const std::string& Name, int32 Number)
+{
+	Write<int32>(Address, Offset, AddName(Name));
+	Write<int32>(Address, Offset + 0x4, Number);
+}
+
+
+uint8* UnrealFixture::CreateObject(int32 Size, uint8* Class, const std::string& Name, uint8* Outer, EObjectFlags Flags, int32 Number)
+{
+	uint8* Object = Arena.Allocate(std::max(Size, Layout.UObjectSize));
+
+	Write<void*>(Object, Layout.UObjectVft, VTable);
+	Write<EObjectFlags>(Object, Layout.UObjectFlags, Flags);
+	Write<int32>(Object, Layout.UObjectIndex, static_cast<int32>(Objects.size()));
+	Write<uint8*>(Object, Layout.UObjectClass, Class);
+	WriteName(Object, Layout.UObjectName, Name, Number);
+	Write<uint8*>(Object, Layout.UObjectOuter, Outer);
+
+	Objects.push_back(Object);
+
+	return Object;
+}
+
+uint8* UnrealFixture::CreatePackage(const std::string& Name)
+{
+	/* OffsetFinder::InitUObjectOffsets() finds 'Outer' using the objects at index 0x55 and 0x123, those can't be packages */
+	while (Objects.size() == 0x55 || Objects.size() == 0x123)
+		CreateObject(Layout.UObjectSize, ObjectClass, "FixturePadding", CoreUObjectPackage, InstanceObjectFlags, static_cast<int32>(Objects.size()));
+
+	return CreateObject(PackageObjectSize, PackageClass, Name, nullptr, NativeObjectFlags);
+}
+
+uint8* UnrealFixture::CreateEnum(const std::string& Name, uint8* Outer, const std::vector<std::string>& ValueNames)
+{
+	uint8* Enum = CreateObject(Layout.UEnumSize, EnumClass, Name, Outer, NativeObjectFlags);
+
+	/* TArray<TPair<FName, int64>> Names */
+	uint8* Names = Arena.Allocate(ValueNames.size() * 0x10);
+
+	for (int32 i = 0; i < static_cast<int32>(ValueNames.size()); i++)
+	{
+		WriteName(Names, i * 0x10, Name + "::" + ValueNames[i]);
+		Write<int64>(Names, (i * 0x10) + 0x8, i);
+	}
+
+	WriteArray(Enum, Layout.UEnumNames, Names, static_cast<int32>(ValueNames.size()));
+
+	return Enum;
+}
+
+
+std::pair<int32, int32> UnrealFixture::GetSizeAndAlignment(EPropertyType Type, const uint8* Reference) const
+{
+	if (Type == EPropertyType::Struct)
+		return { Read<int32>(Reference, Layout.UStructSize), Read<int32>(Reference, Layout.UStructMinAlignment) };
+
+	const PropertyTypeInfo& Info = GetTypeInfo(Type);
+
+	return { Info.Size, Info.Alignment };
+}
+
+uint8* UnrealFixture::CreateProperty(EPropertyType Type, const std::string& Name, uint8* Owner, bool bIsOwnerObject, int32 Offset, EPropertyFlags Flags, int32 ElementSize)
+{
+	/* The largest subclass, FMapProperty, adds 0x10 bytes to FProperty */
+	const int32 AllocationSize = Layout.PropertySize + 0x10;
+
+	uint8* Property = nullptr;
+
+	if (Config.bUseFProperty)
+	{
+		Property = Arena.Allocate(AllocationSize);
+
+		Write<void*>(Property, Layout.FFieldVft, VTable);
+		Write<uint8*>(Property, Layout.FFieldClass, PropertyClasses[static_cast<int32>(Type)]);
+		Write<uint8*>(Property, Layout.FFieldOwner, Owner);
+		Write<bool>(Property, Layout.FFieldOwner + 0x8, bIsOwnerObject);
+		WriteName(Property, Layout.FFieldName, Name);
+		Write<EObjectFlags>(Property, Layout.FFieldFlags, FieldObjectFlags);
+	}
+	else
+	{
+		Property = CreateObject(AllocationSize, PropertyClasses[static_cast<int32>(Type)], Name, Owner, NativeObjectFlags);
+	}
+
+	Write<int32>(Property, Layout.PropertyArrayDim, 0x1);
+	Write<int32>(Property, Layout.PropertyElementSize, ElementSize);
+	Write<EPropertyFlags>(Property, Layout.PropertyFlags, Flags);
+	Write<int32>(Property, Layout.PropertyOffsetInternal, Offset);
+
+	return Property;
+}
+
+uint8* UnrealFixture::CreateMemberProperty(const MemberInfo& Member, EPropertyType Type, const std::string& Name, uint8* Owner, bool bIsOwnerObject, int32 Offset)
+{
+	uint8* Property = CreateProperty(Type, Name, Owner, bIsOwnerObject, Offset, Member.Flags, GetSizeAndAlignment(Type, Member.Reference).first);
+
+	const int32 Base = Layout.PropertySize;
+
+	switch (Type)
+	{
+	case EPropertyType::Byte:
+	case EPropertyType::Struct:
+	case EPropertyType::Delegate:
+		Write<uint8*>(Property, Base, Member.Reference);
+		break;
+	case EPropertyType::Bool:
+		/* { uint8 FieldSize; uint8 ByteOffset; uint8 ByteMask; uint8 FieldMask; }, native bools use a FieldMask of 0xFF */
+		Write<uint8>(Property, Base + 0x0, 0x1);
+		Write<uint8>(Property, Base + 0x1, 0x0);
+		Write<uint8>(Property, Base + 0x2, Member.FieldMask == 0xFF ? 0x1 : Member.FieldMask);
+		Write<uint8>(Property, Base + 0x3, Member.FieldMask);
+		break;
+	case EPropertyType::Object:
+	case EPropertyType::SoftObject:
+		Write<uint8*>(Property, Base, Member.Reference ? Member.Reference : ObjectClass);
+		break;
+	case EPropertyType::Class:
+		Write<uint8*>(Property, Base, ClassClass);
+		Write<uint8*>(Property, Base + 0x8, Member.MetaClass ? Member.MetaClass : ObjectClass);
+		break;
+	case EPropertyType::Array:
+	case EPropertyType::Set:
+		Write<uint8*>(Property, Base, CreateMemberProperty(Member, Member.InnerType, Name, Property, false, 0x0));
+		break;
+	case EPropertyType::Map:
+		Write<uint8*>(Property, Base, CreateMemberProperty(Member, Member.InnerType, Name + "_Key", Property, false, 0x0));
+		Write<uint8*>(Property, Base + 0x8, CreateMemberProperty(Member, Member.ValueType, Name + "_Value", Property, false, 0x0));
+		break;
+	case EPropertyType::Enum:
+		Write<uint8*>(Property, Base, CreateProperty(EPropertyType::Byte, "UnderlyingType", Property, false, 0x0, Member.Flags, 0x1));
+		Write<uint8*>(Property, Base + 0x8, Member.Reference);
+		break;
+	default:
+		break;
+	}
+
+	return Property;
+}
+
+int32 UnrealFixture::CreateMembers(uint8* Struct, int32 StartOffset, const std::vector<MemberInfo>& Members, std::vector<uint8*>& OutProperties, int32& InOutAlignment)
+{
+	int32 CurrentOffset = StartOffset;
+	int32 LastBitfieldOffset = -1;
+
+	for (const MemberInfo& Member : Members)
+	{
+		const auto [Size, Alignment] = GetSizeAndAlignment(Member.Type, Member.Reference);
+
+		const bool bIsBitfield = Member.Type == EPropertyType::Bool && Member.FieldMask != 0xFF;
+
+		int32 Offset = Align(CurrentOffset, Alignment);
+
+		if (Member.Offset >= 0)
+		{
+			Offset = Member.Offset;
+		}
+		else if (bIsBitfield && Member.FieldMask != 0x1 && LastBitfieldOffset >= 0)
+		{
+			/* Following bits of a bitfield share the byte of the first one */
+			Offset = LastBitfieldOffset;
+		}
+
+		LastBitfieldOffset = bIsBitfield ? Offset : -1;
+
+		OutProperties.push_back(CreateMemberProperty(Member, Member.Type, Member.Name, Struct, true, Offset));
+
+		CurrentOffset = std::max(CurrentOffset, Offset + Size);
+		InOutAlignment = std::max(InOutAlignment, Alignment);
+	}
+
+	return CurrentOffset;
+}
+
+void UnrealFixture::LinkChildren(uint8* Struct, const std::vector<uint8*>& Properties, const std::vector<uint8*>& Functions)
+{
+	/* FProperties are linked through FField::Next, UFunctions (and UProperties) through UField::Next */
+	const int32 PropertyNextOffset = Config.bUseFProperty ? Layout.FFieldNext : Layout.UFieldNext;
+
+	for (int32 i = 1; i < static_cast<int32>(Properties.size()); i++)
+		Write<uint8*>(Properties[i - 1], PropertyNextOffset, Properties[i]);
+
+	for (int32 i = 1; i < static_cast<int32>(Functions.size()); i++)
+		Write<uint8*>(Functions[i - 1], Layout.UFieldNext, Functions[i]);
+
+	uint8* FirstProperty = !Properties.empty() ? Properties.front() : nullptr;
+	uint8* FirstFunction = !Functions.empty() ? Functions.front() : nullptr;
+
+	if (Config.bUseFProperty)
+	{
+		Write<uint8*>(Struct, Layout.UStructChildProperties, FirstProperty);
+		Write<uint8*>(Struct, Layout.UStructChildren, FirstFunction);
+		return;
+	}
+
+	/* UProperties come first in 'Children', OffsetFinder::FindChildOffset() relies on this to detect the property system */
+	if (FirstProperty)
+		Write<uint8*>(Properties.back(), Layout.UFieldNext, FirstFunction);
+
+	Write<uint8*>(Struct, Layout.UStructChildren, FirstProperty ? FirstProperty : FirstFunction);
+}
+
+
+uint8* UnrealFixture::CreateClass(const std::string& Name, uint8* Package, uint8* Super, EClassCastFlags CastFlags, const std::vector<MemberInfo>& Members, const std::vector<FunctionInfo>& Functions, int32 ExplicitSize)
+{
+	uint8* Class = CreateObject(Layout.UClassSize, ClassClass, Name, Package, NativeObjectFlags);
+
+	const int32 SuperSize = Super ? Read<int32>(Super, Layout.UStructSize) : Layout.UObjectSize;
+	int32 Alignment = Super ? Read<int32>(Super, Layout.UStructMinAlignment) : 0x8;
+
+	std::vector<uint8*> Properties;
+	const int32 EndOffset = CreateMembers(Class, SuperSize, Members, Properties, Alignment);
+
+	const int32 Size = ExplicitSize >= 0 ? ExplicitSize : Align(EndOffset, Alignment);
+
+	Write<uint8*>(Class, Layout.UStructSuper, Super);
+	Write<int32>(Class, Layout.UStructSize, Size);
+	Write<int32>(Class, Layout.UStructMinAlignment, Alignment);
+	Write<EClassCastFlags>(Class, Layout.UClassCastFlags, (Super ? Read<EClassCastFlags>(Super, Layout.UClassCastFlags) : EClassCastFlags::None) | CastFlags);
+
+	std::vector<uint8*> FunctionObjects;
+	FunctionObjects.reserve(Functions.size());
+
+	for (const FunctionInfo& Function : Functions)
+		FunctionObjects.push_back(CreateFunction(Function.Name, Class, Function.Flags, Function.Params));
+
+	LinkChildren(Class, Properties, FunctionObjects);
+
+	Write<uint8*>(Class, Layout.UClassDefaultObject, CreateObject(Size, Class, "Default__" + Name, Package, DefaultObjectFlags));
+
+	return Class;
+}
+
+uint8* UnrealFixture::CreateScriptStruct(const std::string& Name, uint8* Package, const std::vector<MemberInfo>& Members, int32 ExplicitSize, int32 ExplicitAlignment)
+{
+	uint8* Struct = CreateObject(Layout.UScriptStructSize, ScriptStructClass, Name, Package, NativeObjectFlags);
+
+	int32 Alignment = 0x1;
+
+	std::vector<uint8*> Properties;
+	const int32 EndOffset = CreateMembers(Struct, 0x0, Members, Properties, Alignment);
+
+	if (ExplicitAlignment > 0)
+		Alignment = ExplicitAlignment;
+
+	Write<int32>(Struct, Layout.UStructSize, ExplicitSize >= 0 ? ExplicitSize : Align(EndOffset, Alignment));
+	Write<int32>(Struct, Layout.UStructMinAlignment, Alignment);
+
+	LinkChildren(Struct, Properties, {});
+
+	return Struct;
+}
+
+uint8* UnrealFixture::CreateFunction(const std::string& Name, uint8* Outer, EFunctionFlags Flags, const std::vector<MemberInfo>& Params, bool bIsDelegate)
+{
+	uint8* Function = CreateObject(Layout.UFunctionSize, bIsDelegate ? DelegateFunctionClass : FunctionClass, Name, Outer, NativeObjectFlags);
+
+	std::vector<MemberInfo> Parameters = Params;
+
+	/* Like UHT, FUNC_HasOutParms is only set for out-parameters that aren't the return value */
+	bool bHasOutParms = false;
+
+	for (MemberInfo& Param : Parameters)
+	{
+		/* Out-parameters (non-const references) are marked by the caller, all other flags are the same for every parameter */
+		const bool bIsOutParm = Param.Flags & EPropertyFlags::OutParm;
+
+		Param.Flags = EPropertyFlags::Parm | EPropertyFlags::ZeroConstructor | EPropertyFlags::IsPlainOldData | EPropertyFlags::NoDestructor;
+
+		if (bIsOutParm)
+			Param.Flags |= EPropertyFlags::OutParm;
+
+		if (Param.Name == "ReturnValue")
+		{
+			Param.Flags |= EPropertyFlags::OutParm | EPropertyFlags::ReturnParm;
+		}
+		else if (bIsOutParm)
+		{
+			bHasOutParms = true;
+		}
+	}
+
+	if (bHasOutParms)
+		Flags |= EFunctionFlags::HasOutParms;
+
+	int32 Alignment = 0x1;
+
+	std::vector<uint8*> Properties;
+
+	/* Unlike for structs and classes the size of the parameters isn't aligned, OffsetFinder::FindParamSizeOffset() relies on that */
+	const int32 ParmsSize = CreateMembers(Function, 0x0, Parameters, Properties, Alignment);
+
+	uint16 ReturnValueOffset = 0xFFFF;
+
+	for (int32 i = 0; i < static_cast<int32>(Parameters.size()); i++)
+	{
+		if (Parameters[i].Name == "ReturnValue")
+			ReturnValueOffset = static_cast<uint16>(Read<int32>(Properties[i], Layout.PropertyOffsetInternal));
+	}
+
+	Write<int32>(Function, Layout.UStructSize, ParmsSize);
+	Write<int32>(Function, Layout.UStructMinAlignment, Alignment);
+
+	Write<EFunctionFlags>(Function, Layout.UFunctionFunctionFlags, bIsDelegate ? (Flags | EFunctionFlags::Delegate) : Flags);
+	Write<uint8>(Function, Layout.UFunctionNumParms, static_cast<uint8>(Parameters.size()));
+	Write<uint16>(Function, Layout.UFunctionParmsSize, static_cast<uint16>(ParmsSize));
+	Write<uint16>(Function, Layout.UFunctionReturnValueOffset, ReturnValueOffset);
+	Write<void*>(Function, Layout.UFunctionExecFunction, reinterpret_cast<void*>(&ExecFunction));
+
+	LinkChildren(Function, Properties, {});
+
+	return Function;
+}
+
+
+void UnrealFixture::CreateCoreUObject()
+{
+	/* Bootstrapping, 'Package' and 'Class' don't exist yet. Their objects get the correct class once those were created. */
+	CoreUObjectPackage = CreateObject(PackageObjectSize, nullptr, "/Script/CoreUObject", nullptr, NativeObjectFlags);
+	EnginePackage = CreateObject(PackageObjectSize, nullptr, "/Script/Engine", nullptr, NativeObjectFlags);
+
+	ObjectClass = CreateClass("Object", CoreUObjectPackage, nullptr, EClassCastFlags::None, {}, {}, Layout.UObjectSize);
+	uint8* FieldClass = CreateClass("Field", CoreUObjectPackage, ObjectClass, EClassCastFlags::Field, {}, {}, Layout.UFieldSize);
+	uint8* StructClass = CreateClass("Struct", CoreUObjectPackage, FieldClass, EClassCastFlags::Struct, {}, {}, Layout.UStructStructSize);
+	ClassClass = CreateClass("Class", CoreUObjectPackage, StructClass, EClassCastFlags::Class, {}, {}, Layout.UClassSize);
+	PackageClass = CreateClass("Package", CoreUObjectPackage, ObjectClass, EClassCastFlags::Package, {}, {}, PackageObjectSize);
+
+	for (uint8* Object : Objects)
+	{
+		if (Read<uint8*>(Object, Layout.UObjectClass))
+			continue;
+
+		Write<uint8*>(Object, Layout.UObjectClass, Object == CoreUObjectPackage || Object == EnginePackage ? PackageClass : ClassClass);
+	}
+
+	ScriptStructClass = CreateClass("ScriptStruct", CoreUObjectPackage, StructClass, EClassCastFlags::ScriptStruct, {}, {}, Layout.UScriptStructSize);
+	FunctionClass = CreateClass("Function", CoreUObjectPackage, StructClass, EClassCastFlags::Function, {}, {}, Layout.UFunctionSize);
+	DelegateFunctionClass = CreateClass("DelegateFunction", CoreUObjectPackage, FunctionClass, EClassCastFlags::DelegateFunction, {}, {}, Layout.UFunctionSize);
+	EnumClass = CreateClass("Enum", CoreUObjectPackage, FieldClass, EClassCastFlags::Enum, {}, {}, Layout.UEnumSize);
+	CreateClass("Interface", CoreUObjectPackage, ObjectClass, EClassCastFlags::None, {}, {}, Layout.UObjectSize);
+
+	if (Config.bUseFProperty)
+	{
+		/* FFieldClass { FName Name; uint64 Id; uint64 CastFlags; EClassFlags ClassFlags; FFieldClass* SuperClass; FField* DefaultObject; } */
+		for (int32 i = 0; i < static_cast<int32>(EPropertyType::Num); i++)
+		{
+			const PropertyTypeInfo& Info = GetTypeInfo(static_cast<EPropertyType>(i));
+
+			uint8* FieldClass = Arena.Allocate(Layout.FFieldClassSize);
+
+			WriteName(FieldClass, Layout.FFieldClassName, Info.Name);
+			Write<EClassCastFlags>(FieldClass, Layout.FFieldClassCastFlags, Info.CastFlags);
+
+			PropertyClasses[i] = FieldClass;
+		}
+	}
+	else
+	{
+		uint8* PropertyClass = CreateClass("Property", CoreUObjectPackage, FieldClass, EClassCastFlags::Property, {}, {}, Layout.PropertySize);
+
+		for (int32 i = 0; i < static_cast<int32>(EPropertyType::Num); i++)
+		{
+			const PropertyTypeInfo& Info = GetTypeInfo(static_cast<EPropertyType>(i));
+
+			PropertyClasses[i] = CreateClass(Info.Name, CoreUObjectPackage, PropertyClass, Info.CastFlags, {}, {}, Layout.PropertySize + 0x10);
+		}
+	}
+
+	auto Members = [](EPropertyType Type, std::initializer_list<const char*> Names, EPropertyFlags Flags = EPropertyFlags::Edit | EPropertyFlags::BlueprintVisible | EPropertyFlags::ZeroConstructor | EPropertyFlags::IsPlainOldData) -> std::vector<MemberInfo>
+	{
+		std::vector<MemberInfo> RetMembers;
+
+		for (const char* Name : Names)
+			RetMembers.push_back({ .Type = Type, .Name = Name, .Flags = Flags });
+
+		return RetMembers;
+	};
+
+	CreateScriptStruct("Guid", CoreUObjectPackage, Members(EPropertyType::Int, { "A", "B", "C", "D" }, GuidMemberFlags));
+	VectorStruct = CreateScriptStruct("Vector", CoreUObjectPackage, Members(EPropertyType::Float, { "X", "Y", "Z" }));
+	CreateScriptStruct("Vector4", CoreUObjectPackage, Members(EPropertyType::Float, { "X", "Y", "Z", "W" }), 0x10, 0x10);
+	CreateScriptStruct("Vector2D", CoreUObjectPackage, Members(EPropertyType::Float, { "X", "Y" }));
+	uint8* Quat = CreateScriptStruct("Quat", CoreUObjectPackage, Members(EPropertyType::Float, { "X", "Y", "Z", "W" }), 0x10, 0x10);
+	CreateScriptStruct("Color", CoreUObjectPackage, Members(EPropertyType::Byte, { "B", "G", "R", "A" }, ColorMemberFlags));
+	CreateScriptStruct("LinearColor", CoreUObjectPackage, Members(EPropertyType::Float, { "R", "G", "B", "A" }));
+
+	CreateScriptStruct("Transform", CoreUObjectPackage,
+	{
+		{ .Type = EPropertyType::Struct, .Name = "Rotation", .Reference = Quat },
+		{ .Type = EPropertyType::Struct, .Name = "Translation", .Reference = VectorStruct, .Offset = 0x10 },
+		{ .Type = EPropertyType::Struct, .Name = "Scale3D", .Reference = VectorStruct, .Offset = 0x20 },
+	}, 0x30, 0x10);
+
+	CreateScriptStruct("SoftObjectPath", CoreUObjectPackage,
+	{
+		{ .Type = EPropertyType::Name, .Name = "AssetPathName" },
+		{ .Type = EPropertyType::Str, .Name = "SubPathString" },
+	});
+}
+
+void UnrealFixture::CreateEngine()
+{
+	ENetRoleEnum = CreateEnum("ENetRole", EnginePackage, { "ROLE_None", "ROLE_SimulatedProxy", "ROLE_AutonomousProxy", "ROLE_Authority", "ROLE_MAX" });
+
+	std::vector<std::string> TraceTypeQueryNames;
+	for (int32 i = 1; i <= 0x21; i++)
+		TraceTypeQueryNames.push_back("TraceTypeQuery" + std::to_string(i));
+
+	TraceTypeQueryNames.push_back("TraceTypeQuery_MAX");
+
+	CreateEnum("ETraceTypeQuery", EnginePackage, TraceTypeQueryNames);
+
+	uint8* LinearColor = nullptr;
+	for (uint8* Object : Objects)
+	{
+		if (Read<uint8*>(Object, Layout.UObjectClass) == ScriptStructClass && Read<int32>(Object, Layout.UObjectName) == AddName("LinearColor"))
+			LinearColor = Object;
+	}
+
+	uint8* Key = CreateScriptStruct("Key", EnginePackage, { { .Type = EPropertyType::Name, .Name = "KeyName" } }, 0x18, 0x8);
+
+	uint8* HitResult = CreateScriptStruct("HitResult", EnginePackage,
+	{
+		{ .Type = EPropertyType::Float, .Name = "Time" },
+		{ .Type = EPropertyType::Float, .Name = "Distance" },
+		{ .Type = EPropertyType::Struct, .Name = "Location", .Reference = VectorStruct },
+		{ .Type = EPropertyType::Struct, .Name = "ImpactPoint", .Reference = VectorStruct },
+	}, 0x88, 0x4);
+
+	CreateScriptStruct("URL", EnginePackage,
+	{
+		{ .Type = EPropertyType::Str, .Name = "Protocol" },
+		{ .Type = EPropertyType::Str, .Name = "Host" },
+		{ .Type = EPropertyType::Int, .Name = "Port" },
+		{ .Type = EPropertyType::Int, .Name = "Valid" },
+		{ .Type = EPropertyType::Str, .Name = "Map" },
+		{ .Type = EPropertyType::Str, .Name = "RedirectURL" },
+		{ .Type = EPropertyType::Array, .Name = "Op", .InnerType = EPropertyType::Str },
+		{ .Type = EPropertyType::Str, .Name = "Portal" },
+	});
+
+	ActorClass = CreateClass("Actor", EnginePackage, ObjectClass, EClassCastFlags::Actor,
+	{
+		{ .Type = EPropertyType::Bool, .Name = "bHidden" },
+		{ .Type = EPropertyType::Byte, .Name = "Role", .Reference = ENetRoleEnum },
+		{ .Type = EPropertyType::Object, .Name = "Owner" },
+		{ .Type = EPropertyType::Array, .Name = "Tags", .InnerType = EPropertyType::Name },
+	}, {});
+
+	uint8* ActorComponent = CreateClass("ActorComponent", EnginePackage, ObjectClass, EClassCastFlags::None,
+	{
+		{ .Type = EPropertyType::Bool, .Name = "bAutoActivate" },
+		{ .Type = EPropertyType::Array, .Name = "ComponentTags", .InnerType = EPropertyType::Name },
+	}, {});
+
+	uint8* SceneComponent = CreateClass("SceneComponent", EnginePackage, ActorComponent, EClassCastFlags::SceneComponent, { { .Type = EPropertyType::Struct, .Name = "RelativeLocation", .Reference = VectorStruct } }, {});
+
+	uint8* OnQueueSubtitles = CreateFunction("OnQueueSubtitles__DelegateSignature", EnginePackage, EFunctionFlags::Public,
+	{
+		{ .Type = EPropertyType::Array, .Name = "Subtitles", .InnerType = EPropertyType::Text },
+		{ .Type = EPropertyType::Float, .Name = "CueDuration" },
+	}, true);
+
+	CreateClass("AudioComponent", EnginePackage, SceneComponent, EClassCastFlags::None, { { .Type = EPropertyType::Delegate, .Name = "OnQueueSubtitles", .Reference = OnQueueSubtitles } }, {});
+
+	uint8* Pawn = CreateClass("Pawn", EnginePackage, ActorClass, EClassCastFlags::Pawn, { { .Type = EPropertyType::Object, .Name = "Controller" } }, {});
+
+	/* The first child of 'Controller' and 'PlayerController' is what OffsetFinder::FindChildOffset() checks for */
+	uint8* Controller = CreateClass("Controller", EnginePackage, ActorClass, EClassCastFlags::None, { { .Type = EPropertyType::Object, .Name = "Pawn", .Reference = Pawn } },
+	{
+		{ "UnPossess", MemberFunctionFlags, {} },
+		{ "Possess", MemberFunctionFlags, { { .Type = EPropertyType::Object, .Name = "InPawn", .Reference = Pawn } } },
+	});
+
+	/* NumParms and ParmsSize of these functions are what the OffsetFinder searches for */
+	CreateClass("PlayerController", EnginePackage, Controller, EClassCastFlags::PlayerController, { { .Type = EPropertyType::Bool, .Name = "bAutoManageActiveCameraTarget" } },
+	{
+		{ "WasInputKeyJustReleased", PureMemberFunctionFlags, { { .Type = EPropertyType::Struct, .Name = "Key", .Reference = Key }, { .Type = EPropertyType::Bool, .Name = "ReturnValue" } } },
+		{ "WasInputKeyJustPressed", PureMemberFunctionFlags, { { .Type = EPropertyType::Struct, .Name = "Key", .Reference = Key }, { .Type = EPropertyType::Bool, .Name = "ReturnValue" } } },
+		{ "ToggleSpeaking", ExecFunctionFlags, { { .Type = EPropertyType::Bool, .Name = "bInSpeaking" } } },
+		{ "SwitchLevel", ExecFunctionFlags, { { .Type = EPropertyType::Str, .Name = "URL" } } },
+		{ "SetViewTargetWithBlend", MemberFunctionFlags,
+			{
+				{ .Type = EPropertyType::Object, .Name = "NewViewTarget", .Reference = ActorClass },
+				{ .Type = EPropertyType::Float, .Name = "BlendTime" },
+				{ .Type = EPropertyType::Byte, .Name = "BlendFunc" },
+				{ .Type = EPropertyType::Float, .Name = "BlendExp" },
+				{ .Type = EPropertyType::Bool, .Name = "bLockOutgoing" },
+			}
+		},
+		{ "SetHapticsByValue", MemberFunctionFlags,
+			{
+				{ .Type = EPropertyType::Float, .Name = "Frequency" },
+				{ .Type = EPropertyType::Float, .Name = "Amplitude" },
+				{ .Type = EPropertyType::Byte, .Name = "Hand" },
+			}
+		},
+	});
+
+	CreateClass("PlayerStart", EnginePackage, ActorClass, EClassCastFlags::None, { { .Type = EPropertyType::Name, .Name = "PlayerStartTag" } }, {});
+
+	uint8* World = CreateClass("World", EnginePackage, ObjectClass, EClassCastFlags::None, { { .Type = EPropertyType::Object, .Name = "PersistentLevel" } }, {});
+
+	/* OffsetFinder::FindLevelActorsOffset() searches for 'Actors' between the end of FURL and 'OwningWorld' */
+	uint8* Level = CreateClass("Level", EnginePackage, ObjectClass, EClassCastFlags::Level, { { .Type = EPropertyType::Object, .Name = "OwningWorld", .Reference = World, .Offset = Layout.LevelOwningWorld } }, {}, 0x100);
+
+	CreateScriptStruct("LevelCollection", EnginePackage, { { .Type = EPropertyType::Set, .Name = "Levels", .Reference = Level, .InnerType = EPropertyType::Object } });
+
+	CreateClass("DataTable", EnginePackage, ObjectClass, EClassCastFlags::None, { { .Type = EPropertyType::Object, .Name = "RowStruct", .Reference = ScriptStructClass } }, {});
+
+	CreateClass("Engine", EnginePackage, ObjectClass, EClassCastFlags::None,
+	{
+		{ .Type = EPropertyType::Bool, .Name = "bIsOverridingSelectedColor" },
+		{ .Type = EPropertyType::Bool, .Name = "bSubtitlesEnabled", .FieldMask = 0b00000001 },
+		{ .Type = EPropertyType::Bool, .Name = "bEnableOnScreenDebugMessagesDisplay", .FieldMask = 0b00000010 },
+	}, {});
+
+	CreateClass("GameViewportClient", EnginePackage, ObjectClass, EClassCastFlags::None, { { .Type = EPropertyType::Array, .Name = "DebugProperties", .InnerType = EPropertyType::Name } }, {});
+
+	CreateClass("UserDefinedEnum", EnginePackage, EnumClass, EClassCastFlags::None, { { .Type = EPropertyType::Map, .Name = "DisplayNameMap", .InnerType = EPropertyType::Name, .ValueType = EPropertyType::Text } }, {});
+
+	uint8* BlueprintFunctionLibrary = CreateClass("BlueprintFunctionLibrary", EnginePackage, ObjectClass, EClassCastFlags::None, {}, {});
+
+	CreateClass("KismetSystemLibrary", EnginePackage, BlueprintFunctionLibrary, EClassCastFlags::None, {},
+	{
+		{ "SphereTraceSingleForObjects", StaticLibraryFunctionFlags,
+			{
+				{ .Type = EPropertyType::Object, .Name = "WorldContextObject" },
+				{ .Type = EPropertyType::Struct, .Name = "Start", .Reference = VectorStruct },
+				{ .Type = EPropertyType::Struct, .Name = "End", .Reference = VectorStruct },
+				{ .Type = EPropertyType::Float, .Name = "Radius" },
+				{ .Type = EPropertyType::Array, .Name = "ObjectTypes", .InnerType = EPropertyType::Byte },
+				{ .Type = EPropertyType::Bool, .Name = "bTraceComplex" },
+				{ .Type = EPropertyType::Array, .Name = "ActorsToIgnore", .Reference = ActorClass, .InnerType = EPropertyType::Object },
+				{ .Type = EPropertyType::Byte, .Name = "DrawDebugType" },
+				{ .Type = EPropertyType::Struct, .Name = "OutHit", .Reference = HitResult },
+				{ .Type = EPropertyType::Bool, .Name = "bIgnoreSelf" },
+				{ .Type = EPropertyType::Struct, .Name = "TraceColor", .Reference = LinearColor },
+				{ .Type = EPropertyType::Struct, .Name = "TraceHitColor", .Reference = LinearColor },
+				{ .Type = EPropertyType::Float, .Name = "DrawTime" },
+				{ .Type = EPropertyType::Bool, .Name = "ReturnValue", .Offset = 0x108 },
+			}
+		},
+		{ "LoadAsset", StaticLibraryFunctionFlags, { { .Type = EPropertyType::Object, .Name = "WorldContextObject" }, { .Type = EPropertyType::SoftObject, .Name = "Asset" } } },
+		{ "SetFieldPathPropertyByName", StaticLibraryFunctionFlags,
+			{
+				{ .Type = EPropertyType::Object, .Name = "Object" },
+				{ .Type = EPropertyType::Name, .Name = "PropertyName" },
+				{ .Type = EPropertyType::FieldPath, .Name = "Value" },
+			}
+		},
+		{ "GetEngineVersion", StaticLibraryFunctionFlags, { { .Type = EPropertyType::Str, .Name = "ReturnValue" } } },
+	});
+
+	/* FMod has an out-parameter besides the return value, which the SDK's NativeCall::Invoke has to pass through FFrame::OutParms */
+	CreateClass("KismetMathLibrary", EnginePackage, BlueprintFunctionLibrary, EClassCastFlags::None, {},
+	{
+		{ "FMod", StaticLibraryFunctionFlags | EFunctionFlags::BlueprintPure,
+			{
+				{ .Type = EPropertyType::Float, .Name = "Dividend" },
+				{ .Type = EPropertyType::Float, .Name = "Divisor" },
+				{ .Type = EPropertyType::Float, .Name = "Remainder", .Flags = EPropertyFlags::OutParm },
+				{ .Type = EPropertyType::Int, .Name = "ReturnValue" },
+			}
+		},
+	});
+
+	CreateClass("KismetStringLibrary", EnginePackage, BlueprintFunctionLibrary, EClassCastFlags::None, {},
+	{
+		{ "Concat_StrStr", StaticLibraryFunctionFlags | EFunctionFlags::BlueprintPure, { { .Type = EPropertyType::Str, .Name = "A" }, { .Type = EPropertyType::Str, .Name = "B" }, { .Type = EPropertyType::Str, .Name = "ReturnValue" } } },
+		{ "Len", StaticLibraryFunctionFlags | EFunctionFlags::BlueprintPure, { { .Type = EPropertyType::Str, .Name = "S" }, { .Type = EPropertyType::Int, .Name = "ReturnValue" } } },
+	});
+
+	uint8* KismetTextLibrary = CreateClass("KismetTextLibrary", EnginePackage, BlueprintFunctionLibrary, EClassCastFlags::None, {},
+	{
+		{ "Conv_StringToText", StaticLibraryFunctionFlags | EFunctionFlags::BlueprintPure, { { .Type = EPropertyType::Str, .Name = "InString" }, { .Type = EPropertyType::Text, .Name = "ReturnValue" } } },
+	});
+
+	ConvStringToText = Read<uint8*>(KismetTextLibrary, Layout.UStructChildren);
+
+	/* The map that's loaded, OffsetFinder::FindLevelActorsOffset() and Off::InSDK::World::InitGWorld() need instances of 'Level' and 'World' */
+	uint8* MapPackage = CreatePackage("/Game/Maps/FixtureMap");
+	uint8* WorldInstance = CreateObject(Read<int32>(World, Layout.UStructSize), World, "FixtureMap", MapPackage, InstanceObjectFlags);
+	uint8* LevelInstance = CreateObject(Read<int32>(Level, Layout.UStructSize), Level, "PersistentLevel", WorldInstance, InstanceObjectFlags);
+
+	uint8** Actors = reinterpret_cast<uint8**>(Arena.Allocate(0x4 * sizeof(void*)));
+	Actors[0] = CreateObject(Read<int32>(ActorClass, Layout.UStructSize), ActorClass, "Actor", LevelInstance, InstanceObjectFlags, 0x1);
+
+	WriteArray(LevelInstance, Layout.LevelActors, Actors, 0x1);
+	Write<uint8*>(LevelInstance, Layout.LevelOwningWorld, WorldInstance);
+	Write<uint8*>(WorldInstance, Layout.UObjectSize, LevelInstance);
+
+	if (ActiveFixture == this)
+		GWorld = WorldInstance;
+}
+
+void UnrealFixture::CreateGeneratedPackage(int32 PackageIndex)
+{
+	static constexpr EPropertyType MemberTypes[] =
+	{
+		EPropertyType::Int, EPropertyType::Float, EPropertyType::Bool, EPropertyType::Byte, EPropertyType::Name,
+		EPropertyType::Str, EPropertyType::Object, EPropertyType::Struct, EPropertyType::Array, EPropertyType::Map,
+		EPropertyType::Set, EPropertyType::Enum, EPropertyType::Text, EPropertyType::Class, EPropertyType::SoftObject,
+	};
+
+	constexpr int32 NumMemberTypes = sizeof(MemberTypes) / sizeof(MemberTypes[0]);
+
+	const std::string Suffix = std::to_string(PackageIndex);
+
+	uint8* Package = CreatePackage("/Script/FixturePackage" + Suffix);
+
+	std::vector<uint8*> Enums;
+	std::vector<uint8*> Structs;
+	std::vector<uint8*> Classes;
+
+	/* Members only reference types that were created before, there are no cyclic dependencies between the generated structs */
+	auto GenerateMembers = [&](int32 Seed) -> std::vector<MemberInfo>
+	{
+		std::vector<MemberInfo> Members;
+		Members.reserve(Config.NumMembersPerStruct);
+
+		for (int32 i = 0; i < Config.NumMembersPerStruct; i++)
+		{
+			MemberInfo Member = { .Type = MemberTypes[(Seed + i) % NumMemberTypes], .Name = "Member" + std::to_string(i) };
+
+			switch (Member.Type)
+			{
+			case EPropertyType::Byte:
+			case EPropertyType::Enum:
+				Member.Reference = !Enums.empty() ? Enums[i % Enums.size()] : ENetRoleEnum;
+				break;
+			case EPropertyType::Struct:
+				Member.Reference = !Structs.empty() ? Structs.back() : VectorStruct;
+				break;
+			case EPropertyType::Object:
+			case EPropertyType::SoftObject:
+				Member.Reference = !Classes.empty() ? Classes.back() : ActorClass;
+				break;
+			case EPropertyType::Class:
+				Member.MetaClass = ActorClass;
+				break;
+			case EPropertyType::Map:
+				Member.InnerType = EPropertyType::Name;
+				break;
+			default:
+				break;
+			}
+
+			Members.push_back(std::move(Member));
+		}
+
+		return Members;
+	};
+
+	for (int32 i = 0; i < Config.NumEnumsPerPackage; i++)
+	{
+		const std::string EnumName = "EFixtureEnum" + Suffix + "_" + std::to_string(i);
+
+		Enums.push_back(CreateEnum(EnumName, Package, { "Value0", "Value1", "Value2", "Value3", EnumName + "_MAX" }));
+	}
+
+	for (int32 i = 0; i < Config.NumStructsPerPackage; i++)
+		Structs.push_back(CreateScriptStruct("FixtureStruct" + Suffix + "_" + std::to_string(i), Package, GenerateMembers(PackageIndex + i)));
+
+	for (int32 i = 0; i < Config.NumClassesPerPackage; i++)
+	{
+		std::vector<FunctionInfo> Functions;
+		Functions.reserve(Config.NumFunctionsPerClass);
+
+		for (int32 j = 0; j < Config.NumFunctionsPerClass; j++)
+		{
+			Functions.push_back({ "FixtureFunction" + std::to_string(j), MemberFunctionFlags,
+				{
+					{ .Type = EPropertyType::Int, .Name = "Value" },
+					{ .Type = EPropertyType::Bool, .Name = "ReturnValue" },
+				}
+			});
+		}
+
+		/* Inheritance chains inside of the package, the first class derives from either UObject or AActor */
+		uint8* Super = !Classes.empty() ? Classes.back() : ((PackageIndex % 2) ? ActorClass : ObjectClass);
+
+		Classes.push_back(CreateClass("FixtureClass" + Suffix + "_" + std::to_string(i), Package, Super, EClassCastFlags::None, GenerateMembers(PackageIndex + i + 0x3), Functions));
+	}
+
+	GeneratedClasses.insert(GeneratedClasses.end(), Classes.begin(), Classes.end());
+}
+
+void UnrealFixture::CreateCyclicPackages()
+{
+	/* Each package contains a class deriving from a class of the other package, the PackageManager has to mark one of the Supers as cyclic */
+	uint8* PackageA = CreatePackage("/Script/FixtureCycleA");
+	uint8* PackageB = CreatePackage("/Script/FixtureCycleB");
+
+	uint8* BaseA = CreateClass("CycleBaseA", PackageA, ObjectClass, EClassCastFlags::None, { { .Type = EPropertyType::Int, .Name = "BaseCount" } }, {});
+	uint8* BaseB = CreateClass("CycleBaseB", PackageB, ObjectClass, EClassCastFlags::None, { { .Type = EPropertyType::Float, .Name = "BaseScale" } }, {});
+
+	/* Members of both derived classes are checked by UnrealFixtureTest::TestMemberReflection */
+	CreateClass("CycleDerivedA", PackageA, BaseB, EClassCastFlags::None,
+	{
+		{ .Type = EPropertyType::Int, .Name = "Value" },
+		{ .Type = EPropertyType::Bool, .Name = "bFirstFlag", .FieldMask = 0b00000001 },
+		{ .Type = EPropertyType::Bool, .Name = "bThirdFlag", .FieldMask = 0b00000100 },
+		{ .Type = EPropertyType::Struct, .Name = "Location", .Reference = VectorStruct },
+	}, {});
+
+	CreateClass("CycleDerivedB", PackageB, BaseA, EClassCastFlags::None,
+	{
+		{ .Type = EPropertyType::Bool, .Name = "bIsEnabled" },
+		{ .Type = EPropertyType::Object, .Name = "Owner", .Reference = ActorClass },
+	}, {});
+}
+
+void UnrealFixture::CreateInstances()
+{
+	const int32 TargetNumObjects = std::max(Config.NumObjects, 0x800);
+	const int32 NumTypeObjects = static_cast<int32>(Objects.size()) + 0x1; // + end marker
+
+	/*
+	* OffsetFinder::InitFNameSettings() expects at least 3% of all names to have a Number in the range [1...4], on smaller configs instances are added on top of 'NumObjects'.
+	*
+	* Instances are only as big as UObject, the dumper never reads their members.
+	*/
+	const int32 NumInstances = std::max(TargetNumObjects - NumTypeObjects, NumTypeObjects / 0x8);
+
+	for (int32 i = 0; i < NumInstances; i++)
+	{
+		uint8* Class = !GeneratedClasses.empty() ? GeneratedClasses[i % GeneratedClasses.size()] : ObjectClass;
+
+		CreateObject(Layout.UObjectSize, Class, "FixtureInstance" + std::to_string(i / 0x4), Read<uint8*>(Class, Layout.UObjectOuter), InstanceObjectFlags, (i % 0x4) + 0x1);
+	}
+
+	/* NameArray::PostInit() finds FNameBlockOffsetBits by looking for an object named with an entry in the last block of the FNamePool */
+	if (Config.bUseNamePool)
+		StartNewNameBlock();
+
+	CreateObject(Layout.UObjectSize, ObjectClass, "FixtureEndMarker", CoreUObjectPackage, InstanceObjectFlags);
+}
+
+void UnrealFixture::FinalizeObjectArray()
+{
+	const int32 NumObjects = static_cast<int32>(Objects.size());
+	const int32 ItemSize = Layout.FUObjectItemSize;
+
+	/* FUObjectItem { UObject* Object; int32 Flags; int32 ClusterRootIndex; int32 SerialNumber; } */
+	if (Config.bUseChunkedObjectArray)
+	{
+		const int32 PerChunk = Config.NumElementsPerChunk;
+
+		/* One more chunk than needed, ObjectArray::GetByIndex() accepts 'Index == Num()' */
+		const int32 NumChunks = (NumObjects / PerChunk) + 1;
+
+		uint8** Chunks = reinterpret_cast<uint8**>(Arena.Allocate(NumChunks * sizeof(void*)));
+
+		for (int32 i = 0; i < NumChunks; i++)
+			Chunks[i] = Arena.Allocate(static_cast<uint64>(PerChunk) * ItemSize);
+
+		for (int32 i = 0; i < NumObjects; i++)
+			Write<uint8*>(Chunks[i / PerChunk], (i % PerChunk) * ItemSize, Objects[i]);
+
+		/* FChunkedFixedUObjectArray { FUObjectItem** Objects; FUObjectItem* PreAllocatedObjects; int32 MaxElements; int32 NumElements; int32 MaxChunks; int32 NumChunks; } */
+		GObjects = Arena.Allocate(0x20);
+
+		Write<uint8**>(GObjects, 0x00, Chunks);
+		Write<int32>(GObjects, 0x10, NumChunks * PerChunk);
+		Write<int32>(GObjects, 0x14, NumObjects);
+		Write<int32>(GObjects, 0x18, NumChunks);
+		Write<int32>(GObjects, 0x1C, NumChunks);
+	}
+	else
+	{
+		uint8* Items = Arena.Allocate(static_cast<uint64>(NumObjects + 1) * ItemSize);
+
+		for (int32 i = 0; i < NumObjects; i++)
+			Write<uint8*>(Items, i * ItemSize, Objects[i]);
+
+		/* FFixedUObjectArray { FUObjectItem* Objects; int32 MaxElements; int32 NumElements; } */
+		GObjects = Arena.Allocate(0x10);
+
+		Write<uint8*>(GObjects, 0x0, Items);
+		Write<int32>(GObjects, 0x8, NumObjects + 1);
+		Write<int32>(GObjects, 0xC, NumObjects);
+	}
+}
@@ -0,0 +1,313 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+
+#include "Enums.h"
+
+
+struct UnrealFixtureConfig
+{
+	/* Minimum number of objects in GObjects, everything that isn't needed for types is filled up with instances of the generated classes */
+	int32 NumObjects = 0x4000;
+
+	/* Number of generated packages, in addition to CoreUObject and Engine */
+	int32 NumPackages = 0x40;
+
+	int32 NumEnumsPerPackage = 0x1;
+	int32 NumStructsPerPackage = 0x2;
+	int32 NumClassesPerPackage = 0x4;
+	int32 NumFunctionsPerClass = 0x3;
+	int32 NumMembersPerStruct = 0x6;
+
+	int32 NumElementsPerChunk = 0x10000;
+
+	bool bUseChunkedObjectArray = true; // FChunkedFixedUObjectArray or FFixedUObjectArray
+	bool bUseNamePool = true;           // FNamePool or TNameEntryArray
+	bool bUseFProperty = true;          // FField/FProperty (UE4.25+) or UProperty members
+};
+
+/* Offsets the fixture writes its objects with, the OffsetFinder is expected to find exactly these */
+struct UnrealFixtureLayout
+{
+	int32 UObjectVft = 0x00;
+	int32 UObjectFlags = 0x08;
+	int32 UObjectIndex = 0x0C;
+	int32 UObjectClass = 0x10;
+	int32 UObjectName = 0x18;
+	int32 UObjectOuter = 0x20;
+	int32 UObjectSize = 0x28;
+
+	int32 UFieldNext = 0x28;
+	int32 UFieldSize = 0x30;
+
+	int32 UEnumNames = 0x40;
+	int32 UEnumSize = 0x60;
+
+	int32 UStructSuper = 0x40;
+	int32 UStructChildren = 0x48;
+	int32 UStructChildProperties = 0x50;
+	int32 UStructSize = 0x58;
+	int32 UStructMinAlignment = 0x5C;
+	int32 UStructStructSize = 0xB0;
+
+	int32 UClassCastFlags = 0xD0;
+	int32 UClassDefaultObject = 0x118;
+	int32 UClassSize = 0x230;
+
+	int32 UScriptStructSize = 0xC0;
+
+	int32 UFunctionFunctionFlags = 0xB0;
+	int32 UFunctionNumParms = 0xB4;
+	int32 UFunctionParmsSize = 0xB6;
+	int32 UFunctionReturnValueOffset = 0xB8;
+	int32 UFunctionExecFunction = 0xD8;
+	int32 UFunctionSize = 0xE0;
+
+	int32 FFieldClassName = 0x00;
+	int32 FFieldClassCastFlags = 0x10;
+	int32 FFieldClassSize = 0x30;
+
+	int32 FFieldVft = 0x00;
+	int32 FFieldClass = 0x08;
+	int32 FFieldOwner = 0x10;
+	int32 FFieldNext = 0x20;
+	int32 FFieldName = 0x28;
+	int32 FFieldFlags = 0x30;
+
+	int32 PropertyArrayDim = 0x38;
+	int32 PropertyElementSize = 0x3C;
+	int32 PropertyFlags = 0x40;
+	int32 PropertyOffsetInternal = 0x4C;
+	int32 PropertySize = 0x78;
+
+	int32 FUObjectItemSize = 0x18;
+
+	int32 LevelActors = 0x98;
+	int32 LevelOwningWorld = 0xB8;
+
+	/* UProperty : UField instead of FProperty : FField, everything after UField moves by the size of the FField header */
+	static UnrealFixtureLayout Create(bool bUseFProperty);
+};
+
+
+/*
+* Builds a fake engine in process memory: GObjects, GNames, the CoreUObject/Engine types the OffsetFinder relies on and any number of generated packages.
+*
+* Only standard C++ is used, nothing here depends on the dumper or on Windows. Attaching the fixture to the dumper is done by the caller,
+* see UnrealFixtureTest::AttachFixture. The dumper keeps its engine state in statics, so only one fixture should be attached per process.
+*/
+class UnrealFixture
+{
+public:
+	static constexpr int32 NumVTableEntries = 0x80;
+	static constexpr int32 ProcessEventIndex = 0x44;
+
+	static constexpr int32 NamePoolBlockSize = 0x20000;
+	static constexpr int32 NamePoolMaxBlocks = 0x2000;
+	static constexpr int32 NameArrayElementsPerChunk = 0x4000;
+	static constexpr int32 NameArrayMaxChunks = 0x80;
+
+private:
+	enum class EPropertyType : uint8
+	{
+		Byte,
+		Int,
+		Float,
+		Bool,
+		Name,
+		Str,
+		Text,
+		Object,
+		Class,
+		SoftObject,
+		Struct,
+		Array,
+		Map,
+		Set,
+		Enum,
+		Delegate,
+		FieldPath,
+
+		Num
+	};
+
+	struct MemberInfo
+	{
+		EPropertyType Type;
+		std::string Name;
+		EPropertyFlags Flags = EPropertyFlags::Edit | EPropertyFlags::BlueprintVisible | EPropertyFlags::NativeAccessSpecifierPublic;
+
+		/* UEnum for Byte/Enum, UClass for Object/Class/SoftObject, UScriptStruct for Struct, UFunction for Delegate. Also used for the inner property of containers. */
+		uint8* Reference = nullptr;
+		uint8* MetaClass = nullptr;
+
+		EPropertyType InnerType = EPropertyType::Int; // Array inner, Set element, Map key
+		EPropertyType ValueType = EPropertyType::Int; // Map value
+
+		uint8 FieldMask = 0xFF;
+		int32 Offset = -1;
+	};
+
+	struct FunctionInfo
+	{
+		std::string Name;
+		EFunctionFlags Flags;
+		std::vector<MemberInfo> Params;
+	};
+
+	struct PropertyTypeInfo
+	{
+		const char* Name;
+		EClassCastFlags CastFlags;
+		int32 Size;
+		int32 Alignment;
+	};
+
+	class MemoryArena
+	{
+	private:
+		static constexpr uint64 BlockSize = 0x1000000;
+
+	private:
+		std::vector<std::unique_ptr<uint8[]>> Blocks;
+		uint8* Current = nullptr;
+		uint64 NumBytesLeft = 0x0;
+		uint64 NumBytesAllocated = 0x0;
+
+	public:
+		/* Zero initialized and 0x10 aligned */
+		uint8* Allocate(uint64 Size);
+
+		inline uint64 GetNumBytesAllocated() const { return NumBytesAllocated; }
+	};
+
+private:
+	static inline UnrealFixture* ActiveFixture = nullptr;
+
+	static inline void* VTable[NumVTableEntries] = { nullptr };
+
+public:
+	/* UWorld* GWorld, has to be a variable inside of the image for Off::InSDK::World::InitGWorld to find it */
+	static inline void* GWorld = nullptr;
+
+private:
+	UnrealFixtureConfig Config;
+	UnrealFixtureLayout Layout;
+
+	MemoryArena Arena;
+
+	std::vector<uint8*> Objects;
+
+	uint8* GObjects = nullptr;
+	uint8* GNames = nullptr;
+
+	std::unordered_map<std::string, int32> NameIndices;
+	int32 NumNames = 0x0;
+	int32 CurrentNameBlock = 0x0;
+	int32 CurrentNameByteCursor = 0x0;
+
+	uint8* PropertyClasses[static_cast<int32>(EPropertyType::Num)] = { nullptr };
+
+	/* Core types other types or the ProcessEvent hook refer to */
+	uint8* CoreUObjectPackage = nullptr;
+	uint8* EnginePackage = nullptr;
+	uint8* ObjectClass = nullptr;
+	uint8* ClassClass = nullptr;
+	uint8* ScriptStructClass = nullptr;
+	uint8* FunctionClass = nullptr;
+	uint8* DelegateFunctionClass = nullptr;
+	uint8* EnumClass = nullptr;
+	uint8* PackageClass = nullptr;
+	uint8* ActorClass = nullptr;
+	uint8* VectorStruct = nullptr;
+	uint8* ENetRoleEnum = nullptr;
+	uint8* ConvStringToText = nullptr;
+
+	std::vector<uint8*> GeneratedClasses;
+
+	alignas(0x8) uint8 TextData[0x40] = { 0x0 };
+
+public:
+	explicit UnrealFixture(const UnrealFixtureConfig& FixtureConfig = UnrealFixtureConfig());
+	~UnrealFixture();
+
+	UnrealFixture(const UnrealFixture&) = delete;
+	UnrealFixture& operator=(const UnrealFixture&) = delete;
+
+private:
+	static const PropertyTypeInfo& GetTypeInfo(EPropertyType Type);
+
+	static void ExecFunction(void* Context, void* Stack, void* Result);
+	static void UnusedVirtualFunction();
+	static void ProcessEvent(void* Object, void* Function, void* Params);
+
+private:
+	template<typename T>
+	static inline void Write(uint8* Address, int32 Offset, T Value)
+	{
+		*reinterpret_cast<T*>(Address + Offset) = Value;
+	}
+
+	template<typename T>
+	static inline T Read(const uint8* Address, int32 Offset)
+	{
+		return *reinterpret_cast<const T*>(Address + Offset);
+	}
+
+	static inline void WriteArray(uint8* Address, int32 Offset, void* Data, int32 Num)
+	{
+		Write<void*>(Address, Offset, Data);
+		Write<int32>(Address, Offset + 0x8, Num);
+		Write<int32>(Address, Offset + 0xC, Num);
+	}
+
+private:
+	void InitNameTable();
+	int32 AddName(const std::string& Name);
+	void StartNewNameBlock();
+	void WriteName(uint8* Address, int32 Offset, const std::string& Name, int32 Number = 0x0);
+
+	uint8* CreateObject(int32 Size, uint8* Class, const std::string& Name, uint8* Outer, EObjectFlags Flags, int32 Number = 0x0);
+	uint8* CreatePackage(const std::string& Name);
+	uint8* CreateEnum(const std::string& Name, uint8* Outer, const std::vector<std::string>& ValueNames);
+
+	/* { Size, Alignment } */
+	std::pair<int32, int32> GetSizeAndAlignment(EPropertyType Type, const uint8* Reference) const;
+
+	uint8* CreateProperty(EPropertyType Type, const std::string& Name, uint8* Owner, bool bIsOwnerObject, int32 Offset, EPropertyFlags Flags, int32 ElementSize);
+	uint8* CreateMemberProperty(const MemberInfo& Member, EPropertyType Type, const std::string& Name, uint8* Owner, bool bIsOwnerObject, int32 Offset);
+
+	/* Returns the unaligned end of the last member */
+	int32 CreateMembers(uint8* Struct, int32 StartOffset, const std::vector<MemberInfo>& Members, std::vector<uint8*>& OutProperties, int32& InOutAlignment);
+	void LinkChildren(uint8* Struct, const std::vector<uint8*>& Properties, const std::vector<uint8*>& Functions);
+
+	uint8* CreateClass(const std::string& Name, uint8* Package, uint8* Super, EClassCastFlags CastFlags, const std::vector<MemberInfo>& Members, const std::vector<FunctionInfo>& Functions, int32 ExplicitSize = -1);
+	uint8* CreateScriptStruct(const std::string& Name, uint8* Package, const std::vector<MemberInfo>& Members, int32 ExplicitSize = -1, int32 ExplicitAlignment = -1);
+	uint8* CreateFunction(const std::string& Name, uint8* Outer, EFunctionFlags Flags, const std::vector<MemberInfo>& Params, bool bIsDelegate = false);
+
+	void CreateCoreUObject();
+	void CreateEngine();
+	void CreateGeneratedPackage(int32 PackageIndex);
+	void CreateCyclicPackages();
+	void CreateInstances();
+
+	void FinalizeObjectArray();
+
+public:
+	inline const UnrealFixtureConfig& GetConfig() const { return Config; }
+	inline const UnrealFixtureLayout& GetLayout() const { return Layout; }
+
+	/* FChunkedFixedUObjectArray* or FFixedUObjectArray* */
+	inline void* GetGObjects() const { return GObjects; }
+
+	/* FNamePool* or TNameEntryArray* */
+	inline uint8* GetGNames() const { return GNames; }
+
+	inline int32 GetNumObjects() const { return static_cast<int32>(Objects.size()); }
+	inline int32 GetNumNames() const { return NumNames; }
+	inline uint64 GetNumBytesAllocated() const { return Arena.GetNumBytesAllocated(); }
+};
@@ -0,0 +1,811 @@
+#pragma once
+#include "UnrealFixture.h"
+#include "ObjectArray.h"
+#include "UnrealTypes.h"
+#include "Offsets.h"
+#include "OffsetFinder.h"
+#include "NameArray.h"
+#include "Generator.h"
+#include "PackageManager.h"
+#include "CppGenerator.h"
+#include "HotPathCounters.h"
+#include "TestBase.h"
+
+#include <chrono>
+#include <cstring>
+
+
+/*
+* Runs the dumpers init-steps against an UnrealFixture instead of a running game.
+*
+* The engine-state of the dumper (offsets, managers) is global and can only be initialized once, so all tests share one fixture per process.
+* Don't run these tests from inside of a game, the fixture replaces GObjects and GNames.
+*/
+class UnrealFixtureTest : protected TestBase
+{
+private:
+	static inline UnrealFixture& GetFixture()
+	{
+		static UnrealFixture Fixture;
+
+		return Fixture;
+	}
+
+	/* Points ObjectArray and FName at the fixture, doesn't touch any offsets other than the ones of GObjects and GNames */
+	static inline void AttachObjectsAndNames(const UnrealFixture& Fixture)
+	{
+		const UnrealFixtureConfig& Config = Fixture.GetConfig();
+
+		ObjectArray::InitFromAddress(Fixture.GetGObjects(), Config.NumElementsPerChunk, Config.bUseChunkedObjectArray);
+		FName::InitFromGNamesAddress(Fixture.GetGNames(), Config.bUseNamePool);
+	}
+
+	static inline void AttachFixture(const UnrealFixture& Fixture)
+	{
+		static bool bIsAttached = false;
+
+		if (bIsAttached)
+			return;
+
+		bIsAttached = true;
+
+		AttachObjectsAndNames(Fixture);
+
+		Off::Init();
+		PropertySizes::Init();
+		Off::InSDK::ProcessEvent::InitPE(UnrealFixture::ProcessEventIndex);
+		Off::InSDK::World::InitGWorld();
+		Off::InSDK::Text::InitTextOffsets();
+	}
+
+	/* Each config differs from the shared fixture in exactly one layout switch, and is small enough to be built on every run */
+	static inline std::vector<std::pair<const char*, UnrealFixtureConfig>> GetAlternativeConfigs()
+	{
+		UnrealFixtureConfig BaseConfig;
+		BaseConfig.NumObjects = 0x800;
+		BaseConfig.NumPackages = 0x4;
+
+		std::vector<std::pair<const char*, UnrealFixtureConfig>> Configs = { { "FFixedUObjectArray", BaseConfig }, { "TNameEntryArray", BaseConfig }, { "UProperty", BaseConfig } };
+		Configs[0].second.bUseChunkedObjectArray = false;
+		Configs[1].second.bUseNamePool = false;
+		Configs[2].second.bUseFProperty = false;
+
+		return Configs;
+	}
+
+	/* Iterates every object of the attached fixture and resolves a few names, including ones with a Number */
+	static inline bool CheckObjectsAndNames(const UnrealFixture& Fixture)
+	{
+		bool bSucceeded = ObjectArray::Num() == Fixture.GetNumObjects();
+
+		for (int32 i = 0; i < ObjectArray::Num() && bSucceeded; i++)
+		{
+			UEObject Obj = ObjectArray::GetByIndex(i);
+
+			SetBoolIfFailed(bSucceeded, Obj && Obj.GetIndex() == i);
+		}
+
+		SetBoolIfFailed(bSucceeded, ObjectArray::GetByIndex(0x0).GetName() == "/Script/CoreUObject");
+		SetBoolIfFailed(bSucceeded, static_cast<bool>(ObjectArray::FindObjectFast("PlayerController")));
+
+		UEObject LastInstance = ObjectArray::GetByIndex(ObjectArray::Num() - 0x2);
+		SetBoolIfFailed(bSucceeded, LastInstance.GetName().starts_with("FixtureInstance") && LastInstance.GetFName().GetNumber() > 0x0);
+
+		SetBoolIfFailed(bSucceeded, ObjectArray::GetByIndex(ObjectArray::Num() - 0x1).GetName() == "FixtureEndMarker");
+
+		return bSucceeded;
+	}
+
+	/* Runs the OffsetFinder for everything that moves with UProperty : UField, in the order of Off::Init(). Every offset is used by the following finders. */
+	static inline bool CheckUPropertyOffsets(const UnrealFixtureLayout& Layout)
+	{
+		Settings::Internal::bUseFProperty = false;
+
+		bool bSucceeded = OffsetFinder::FindChildOffset() == Layout.UStructChildren && !Settings::Internal::bUseFProperty;
+
+		Off::UStruct::Size = OffsetFinder::FindStructSizeOffset();
+		Off::UStruct::MinAlignemnt = OffsetFinder::FindMinAlignmentOffset();
+		Off::UClass::CastFlags = OffsetFinder::FindCastFlagsOffset();
+		Off::UClass::ClassDefaultObject = OffsetFinder::FindDefaultObjectOffset();
+		Off::UFunction::FunctionFlags = OffsetFinder::FindFunctionFlagsOffset();
+		Off::UFunction::ExecFunction = OffsetFinder::FindFunctionNativeFuncOffset();
+		Off::Property::ElementSize = OffsetFinder::FindElementSizeOffset();
+		Off::Property::ArrayDim = OffsetFinder::FindArrayDimOffset();
+		Off::Property::Offset_Internal = OffsetFinder::FindOffsetInternalOffset();
+		Off::Property::PropertyFlags = OffsetFinder::FindPropertyFlagsOffset();
+		Off::InSDK::Properties::PropertySize = OffsetFinder::FindBoolPropertyBaseOffset();
+
+		SetBoolIfFailed(bSucceeded, Off::UStruct::Size == Layout.UStructSize);
+		SetBoolIfFailed(bSucceeded, Off::UStruct::MinAlignemnt == Layout.UStructMinAlignment);
+		SetBoolIfFailed(bSucceeded, Off::UClass::CastFlags == Layout.UClassCastFlags);
+		SetBoolIfFailed(bSucceeded, Off::UClass::ClassDefaultObject == Layout.UClassDefaultObject);
+		SetBoolIfFailed(bSucceeded, Off::UFunction::FunctionFlags == Layout.UFunctionFunctionFlags);
+		SetBoolIfFailed(bSucceeded, Off::UFunction::ExecFunction == Layout.UFunctionExecFunction);
+		SetBoolIfFailed(bSucceeded, Off::Property::ElementSize == Layout.PropertyElementSize);
+		SetBoolIfFailed(bSucceeded, Off::Property::ArrayDim == Layout.PropertyArrayDim);
+		SetBoolIfFailed(bSucceeded, Off::Property::Offset_Internal == Layout.PropertyOffsetInternal);
+		SetBoolIfFailed(bSucceeded, Off::Property::PropertyFlags == Layout.PropertyFlags);
+		SetBoolIfFailed(bSucceeded, Off::InSDK::Properties::PropertySize == Layout.PropertySize);
+
+		/* UProperties are UObjects, their names and the bitfield are read through the offsets found above */
+		UEClass EngineClass = ObjectArray::FindClassFast("Engine");
+		UEProperty Bitfield = EngineClass ? EngineClass.FindMember("bEnableOnScreenDebugMessagesDisplay") : UEProperty(nullptr);
+
+		SetBoolIfFailed(bSucceeded, Bitfield && Bitfield.Cast<UEBoolProperty>().GetFieldMask() == 0b00000010);
+
+		return bSucceeded;
+	}
+
+	/*
+	* Memory image of a TSet<ElementType> (or of the TSet inside of a TMap) at the engine's offsets:
+	*
+	* 0x00 TSparseArray::Data, 0x30 FirstFreeIndex, 0x34 NumFreeIndices, 0x38 Hash (inline bucket), 0x40 Hash (allocation), 0x48 HashSize
+	*
+	* Every 'HoleInterval'th slot is left free, the way removed elements are. Elements are inserted at the front of their bucket, like the engine does.
+	*/
+	template<typename ElementType>
+	class SetImage
+	{
+	public:
+		struct FElement
+		{
+			ElementType Value;
+			int32 HashNextId;
+			int32 HashIndex;
+		};
+
+		/* Slots of the sparse array are unions of the element and the free-list link */
+		static constexpr int32 SlotSize = sizeof(FElement) > 0x8 ? sizeof(FElement) : 0x8;
+
+		static constexpr int32 HoleInterval = 0x7;
+
+	private:
+		std::vector<uint64> Slots;
+		std::vector<int32> Buckets;
+		std::vector<int32> SlotIndices;
+
+		alignas(0x8) uint8 Image[0x50] = { 0x0 };
+
+	private:
+		template<typename T>
+		inline void Write(int32 Offset, T Value)
+		{
+			memcpy(Image + Offset, &Value, sizeof(T));
+		}
+
+		/* Same as the engine's TSet::GetNumberOfHashBuckets */
+		static inline int32 GetNumberOfHashBuckets(int32 NumElements)
+		{
+			if (NumElements < 4)
+				return 1;
+
+			int32 NumBuckets = 1;
+
+			while (NumBuckets < (NumElements / 2 + 8))
+				NumBuckets <<= 1;
+
+			return NumBuckets;
+		}
+
+	public:
+		SetImage(const std::vector<ElementType>& Values, const std::vector<uint32>& Hashes)
+		{
+			const int32 NumElements = static_cast<int32>(Values.size());
+			const int32 MaxSlots = NumElements + (NumElements / (HoleInterval - 1)) + 1;
+
+			const int32 HashSize = GetNumberOfHashBuckets(NumElements);
+
+			Slots.resize(((static_cast<size_t>(MaxSlots) * SlotSize) / sizeof(uint64)) + 1, 0x0);
+			Buckets.resize(HashSize, -1);
+			SlotIndices.reserve(NumElements);
+
+			uint8* SlotData = reinterpret_cast<uint8*>(Slots.data());
+
+			int32 NumSlots = 0;
+			int32 NumHoles = 0;
+
+			for (int32 ValueIdx = 0; ValueIdx < NumElements; NumSlots++)
+			{
+				if ((NumSlots % HoleInterval) == (HoleInterval - 1))
+				{
+					NumHoles++;
+					continue;
+				}
+
+				const int32 Bucket = static_cast<int32>(Hashes[ValueIdx] & (HashSize - 1));
+
+				const FElement Element = { Values[ValueIdx], Buckets[Bucket], Bucket };
+				memcpy(SlotData + (static_cast<size_t>(NumSlots) * SlotSize), &Element, sizeof(FElement));
+
+				Buckets[Bucket] = NumSlots;
+				SlotIndices.push_back(NumSlots);
+
+				ValueIdx++;
+			}
+
+			Write<void*>(0x00, SlotData);
+			Write<int32>(0x08, NumSlots);
+			Write<int32>(0x0C, NumSlots);
+			Write<int32>(0x30, NumHoles > 0 ? HoleInterval - 1 : -1);
+			Write<int32>(0x34, NumHoles);
+
+			/* A single bucket uses the inline-allocation */
+			if (HashSize == 1)
+			{
+				Write<int32>(0x38, Buckets[0]);
+			}
+			else
+			{
+				Write<void*>(0x40, Buckets.data());
+			}
+
+			Write<int32>(0x48, HashSize);
+		}
+
+		SetImage(const SetImage&) = delete;
+
+	public:
+		inline const uint8* GetData() const { return Image; }
+
+		inline int32 GetSlotIndex(int32 ValueIndex) const { return SlotIndices[ValueIndex]; }
+	};
+
+	/* Hash functions of the engine, UnrealContainers.hpp is expected to contain the same expressions (see TestContainerLookup) */
+	static inline uint32 GetTypeHash(uint64 Value)
+	{
+		return static_cast<uint32>(Value) + (static_cast<uint32>(Value >> 32) * 23);
+	}
+
+	static inline uint32 HashCombine(uint32 A, uint32 C)
+	{
+		uint32 B = 0x9e3779b9;
+		A += B;
+
+		A -= B; A -= C; A ^= (C >> 13);
+		B -= C; B -= A; B ^= (A << 8);
+		C -= A; C -= B; C ^= (B >> 13);
+		A -= B; A -= C; A ^= (C >> 12);
+		B -= C; B -= A; B ^= (A << 16);
+		C -= A; C -= B; C ^= (B >> 5);
+		A -= B; A -= C; A ^= (C >> 3);
+		B -= C; B -= A; B ^= (A << 10);
+		C -= A; C -= B; C ^= (B >> 15);
+
+		return C;
+	}
+
+	static inline uint32 PointerHash(const void* Key, uint32 C = 0)
+	{
+		return HashCombine(GetTypeHash(static_cast<uint64>(reinterpret_cast<uintptr_t>(Key) >> 4)), C);
+	}
+
+	/* The bucket-walk of TSet::FindIndexByHashImpl in UnrealContainers.hpp, on the raw memory of a TSet */
+	template<typename ElementType, typename KeyType, typename GetKeyFunctionType>
+	static inline int32 FindIndexByHash(const uint8* Set, uint32 KeyHash, const KeyType& Key, GetKeyFunctionType GetKey)
+	{
+		using FElement = typename SetImage<ElementType>::FElement;
+
+		const uint8* SlotData = *reinterpret_cast<const uint8* const*>(Set + 0x00);
+		const int32 NumAllocatedElements = *reinterpret_cast<const int32*>(Set + 0x08);
+		const int32 NumFreeIndices = *reinterpret_cast<const int32*>(Set + 0x34);
+		const int32* SecondaryBuckets = *reinterpret_cast<const int32* const*>(Set + 0x40);
+		const int32 HashSize = *reinterpret_cast<const int32*>(Set + 0x48);
+
+		if ((NumAllocatedElements - NumFreeIndices) <= 0 || HashSize <= 0)
+			return -1;
+
+		const int32* Buckets = SecondaryBuckets ? SecondaryBuckets : reinterpret_cast<const int32*>(Set + 0x38);
+
+		int32 Index = Buckets[KeyHash & (HashSize - 1)];
+
+		for (int32 i = 0; i < NumAllocatedElements && Index >= 0 && Index < NumAllocatedElements; i++)
+		{
+			const FElement& Element = *reinterpret_cast<const FElement*>(SlotData + (static_cast<size_t>(Index) * SetImage<ElementType>::SlotSize));
+
+			if (GetKey(Element.Value) == Key)
+				return Index;
+
+			Index = Element.HashNextId;
+		}
+
+		return -1;
+	}
+
+	/* Looks up every key, and keys that aren't in the set, in a TSet<KeyType> and a TMap<KeyType, int32> image */
+	template<typename KeyType, typename HashFunctionType>
+	static inline bool CheckSetAndMap(const std::vector<KeyType>& Keys, const std::vector<KeyType>& MissingKeys, HashFunctionType Hash)
+	{
+		using PairType = std::pair<KeyType, int32>;
+
+		std::vector<PairType> Pairs;
+		std::vector<uint32> Hashes;
+
+		for (int32 i = 0; i < static_cast<int32>(Keys.size()); i++)
+		{
+			Pairs.emplace_back(Keys[i], i);
+			Hashes.push_back(Hash(Keys[i]));
+		}
+
+		const SetImage<KeyType> Set(Keys, Hashes);
+		const SetImage<PairType> Map(Pairs, Hashes);
+
+		auto GetSetKey = [](const KeyType& Value) -> const KeyType& { return Value; };
+		auto GetMapKey = [](const PairType& Pair) -> const KeyType& { return Pair.first; };
+
+		bool bSucceeded = true;
+
+		for (int32 i = 0; i < static_cast<int32>(Keys.size()); i++)
+		{
+			SetBoolIfFailed(bSucceeded, FindIndexByHash<KeyType>(Set.GetData(), Hashes[i], Keys[i], GetSetKey) == Set.GetSlotIndex(i));
+			SetBoolIfFailed(bSucceeded, FindIndexByHash<PairType>(Map.GetData(), Hashes[i], Keys[i], GetMapKey) == Map.GetSlotIndex(i));
+		}
+
+		for (const KeyType& Key : MissingKeys)
+		{
+			SetBoolIfFailed(bSucceeded, FindIndexByHash<KeyType>(Set.GetData(), Hash(Key), Key, GetSetKey) == -1);
+			SetBoolIfFailed(bSucceeded, FindIndexByHash<PairType>(Map.GetData(), Hash(Key), Key, GetMapKey) == -1);
+		}
+
+		return bSucceeded;
+	}
+
+public:
+	template<bool bDoDebugPrinting = false>
+	static inline void TestAll()
+	{
+		TestObjectArray<bDoDebugPrinting>();
+		TestNames<bDoDebugPrinting>();
+		TestUObjectOffsets<bDoDebugPrinting>();
+		TestStructOffsets<bDoDebugPrinting>();
+		TestPropertyOffsets<bDoDebugPrinting>();
+		TestInSDKOffsets<bDoDebugPrinting>();
+		TestOutParmFunction<bDoDebugPrinting>();
+		TestManagerInit<bDoDebugPrinting>();
+		TestMemberReflection<bDoDebugPrinting>();
+		TestContainerLookup<bDoDebugPrinting>();
+		TestAlternativeLayouts<bDoDebugPrinting>();
+
+		PrintDbgMessage<bDoDebugPrinting>("");
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestObjectArray()
+	{
+		const UnrealFixture& Fixture = GetFixture();
+		AttachFixture(Fixture);
+
+		bool bSuccededTestWithoutError = ObjectArray::Num() == Fixture.GetNumObjects();
+
+		for (int32 i = 0; i < ObjectArray::Num(); i++)
+		{
+			UEObject Obj = ObjectArray::GetByIndex(i);
+
+			if (!Obj || Obj.GetIndex() != i)
+			{
+				PrintDbgMessage<bDoDebugPrinting>("{} --> Invalid object at index {}", __FUNCTION__, i);
+				SetBoolIfFailed(bSuccededTestWithoutError, false);
+				break;
+			}
+		}
+
+		std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestNames()
+	{
+		AttachFixture(GetFixture());
+
+		bool bSuccededTestWithoutError = true;
+
+		SetBoolIfFailed(bSuccededTestWithoutError, ObjectArray::GetByIndex(0x0).GetName() == "/Script/CoreUObject");
+		SetBoolIfFailed(bSuccededTestWithoutError, static_cast<bool>(ObjectArray::FindClassFast("PlayerController")));
+		SetBoolIfFailed(bSuccededTestWithoutError, static_cast<bool>(ObjectArray::FindObjectFast<UEEnum>("ENetRole", EClassCastFlags::Enum)));
+
+		/* Names of instances use the Number part of FName */
+		UEObject LastInstance = ObjectArray::GetByIndex(ObjectArray::Num() - 0x2);
+		SetBoolIfFailed(bSuccededTestWithoutError, LastInstance.GetName().starts_with("FixtureInstance") && LastInstance.GetFName().GetNumber() > 0x0);
+
+		SetBoolIfFailed(bSuccededTestWithoutError, ObjectArray::GetByIndex(ObjectArray::Num() - 0x1).GetName() == "FixtureEndMarker");
+
+		std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestUObjectOffsets()
+	{
+		const UnrealFixture& Fixture = GetFixture();
+		AttachFixture(Fixture);
+
+		const UnrealFixtureLayout& Layout = Fixture.GetLayout();
+
+		bool bSuccededTestWithoutError = true;
+
+		SetBoolIfFailed(bSuccededTestWithoutError, Off::UObject::Vft == Layout.UObjectVft);
+		SetBoolIfFailed(bSuccededTestWithoutError, Off::UObject::Flags == Layout.UObjectFlags);
+		SetBoolIfFailed(bSuccededTestWithoutError, Off::UObject::Index == Layout.UObjectIndex);
+		SetBoolIfFailed(bSuccededTestWithoutError, Off::UObject::Class == Layout.UObjectClass);
+		SetBoolIfFailed(bSuccededTestWithoutError, Off::UObject::Name == Layout.UObjectName);
+		SetBoolIfFailed(bSuccededTestWithoutError, Off::UObject::Outer == Layout.UObjectOuter);
+
+		SetBoolIfFailed(bSuccededTestWithoutError, Off::UField::Next == Layout.UFieldNext);
+		SetBoolIfFailed(bSuccededTestWithoutError, Off::UEnum::Names == Layout.UEnumNames);
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> Outer: 0x{:X}, Next: 0x{:X}, Names: 0x{:X}", __FUNCTION__, Off::UObject::Outer, Off::UField::Next, Off::UEnum::Names);
+		std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestStructOffsets()
+	{
+		const UnrealFixture& Fixture = GetFixture();
+		AttachFixture(Fixture);
+
+		const UnrealFixtureLayout& Layout = Fixture.GetLayout();
+
+		bool bSuccededTestWithoutError = true;
+
+		SetBoolIfFailed(bSuccededTestWithoutError, Off::UStruct::SuperStruct == Layout.UStructSuper);
+		SetBoolIfFailed(bSuccededTestWithoutError, Off::UStruct::Children == Layout.UStructChildren);
+		SetBoolIfFailed(bSuccededTestWithoutError, Off::UStruct::Size == Layout.UStructSize);
+		SetBoolIfFailed(bSuccededTestWithoutError, Off::UStruct::MinAlignemnt == Layout.UStructMinAlignment);
+
+		if (Fixture.GetConfig().bUseFProperty)
+			SetBoolIfFailed(bSuccededTestWithoutError, Off::UStruct::ChildProperties == Layout.UStructChildProperties);
+
+		SetBoolIfFailed(bSuccededTestWithoutError, Off::UClass::CastFlags == Layout.UClassCastFlags);
+		SetBoolIfFailed(bSuccededTestWithoutError, Off::UClass::ClassDefaultObject == Layout.UClassDefaultObject);
+
+		SetBoolIfFailed(bSuccededTestWithoutError, Off::UFunction::FunctionFlags == Layout.UFunctionFunctionFlags);
+		SetBoolIfFailed(bSuccededTestWithoutError, Off::UFunction::ExecFunction == Layout.UFunctionExecFunction);
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> Children: 0x{:X}, CastFlags: 0x{:X}, FunctionFlags: 0x{:X}", __FUNCTION__, Off::UStruct::Children, Off::UClass::CastFlags, Off::UFunction::FunctionFlags);
+		std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestPropertyOffsets()
+	{
+		const UnrealFixture& Fixture = GetFixture();
+		AttachFixture(Fixture);
+
+		const UnrealFixtureLayout& Layout = Fixture.GetLayout();
+
+		bool bSuccededTestWithoutError = Settings::Internal::bUseFProperty == Fixture.GetConfig().bUseFProperty;
+
+		SetBoolIfFailed(bSuccededTestWithoutError, Off::Property::ArrayDim == Layout.PropertyArrayDim);
+		SetBoolIfFailed(bSuccededTestWithoutError, Off::Property::ElementSize == Layout.PropertyElementSize);
+		SetBoolIfFailed(bSuccededTestWithoutError, Off::Property::PropertyFlags == Layout.PropertyFlags);
+		SetBoolIfFailed(bSuccededTestWithoutError, Off::Property::Offset_Internal == Layout.PropertyOffsetInternal);
+		SetBoolIfFailed(bSuccededTestWithoutError, Off::InSDK::Properties::PropertySize == Layout.PropertySize);
+
+		if (Fixture.GetConfig().bUseFProperty)
+		{
+			SetBoolIfFailed(bSuccededTestWithoutError, Off::FField::Next == Layout.FFieldNext);
+			SetBoolIfFailed(bSuccededTestWithoutError, Off::FField::Name == Layout.FFieldName);
+		}
+
+		/* A bitfield member, the second bit of the first byte after 'bIsOverridingSelectedColor' */
+		UEClass EngineClass = ObjectArray::FindClassFast("Engine");
+		UEProperty Bitfield = EngineClass ? EngineClass.FindMember("bEnableOnScreenDebugMessagesDisplay") : UEProperty(nullptr);
+
+		SetBoolIfFailed(bSuccededTestWithoutError, Bitfield && Bitfield.Cast<UEBoolProperty>().GetFieldMask() == 0b00000010);
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> Offset_Internal: 0x{:X}, PropertySize: 0x{:X}", __FUNCTION__, Off::Property::Offset_Internal, Off::InSDK::Properties::PropertySize);
+		std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestInSDKOffsets()
+	{
+		const UnrealFixture& Fixture = GetFixture();
+		AttachFixture(Fixture);
+
+		bool bSuccededTestWithoutError = true;
+
+		SetBoolIfFailed(bSuccededTestWithoutError, Off::InSDK::ProcessEvent::PEIndex == UnrealFixture::ProcessEventIndex);
+		SetBoolIfFailed(bSuccededTestWithoutError, Off::InSDK::ULevel::Actors == Fixture.GetLayout().LevelActors);
+		SetBoolIfFailed(bSuccededTestWithoutError, Off::InSDK::World::GWorld != 0x0);
+
+		/* FText { FTextData* TextData; ... }, the fixtures ProcessEvent stores the FString at offset 0x28 of FTextData */
+		SetBoolIfFailed(bSuccededTestWithoutError, Off::InSDK::Text::TextDatOffset == 0x0);
+		SetBoolIfFailed(bSuccededTestWithoutError, Off::InSDK::Text::InTextDataStringOffset == 0x28);
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> GWorld: 0x{:X}, Actors: 0x{:X}", __FUNCTION__, Off::InSDK::World::GWorld, Off::InSDK::ULevel::Actors);
+		std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	/* KismetMathLibrary::FMod has an out-parameter, wrappers calling it directly through its ExecFunction need FUNC_HasOutParms and CPF_OutParm to build FFrame::OutParms */
+	template<bool bDoDebugPrinting = false>
+	static inline void TestOutParmFunction()
+	{
+		AttachFixture(GetFixture());
+
+		bool bSuccededTestWithoutError = true;
+
+		const UEFunction FMod = ObjectArray::FindObjectFast<UEFunction>("FMod", EClassCastFlags::Function);
+
+		SetBoolIfFailed(bSuccededTestWithoutError, FMod && FMod.HasFlags(EFunctionFlags::HasOutParms));
+
+		int32 NumOutParms = 0x0;
+
+		for (UEProperty Param : (FMod ? FMod.GetProperties() : std::vector<UEProperty>()))
+		{
+			if (!Param.HasPropertyFlags(EPropertyFlags::OutParm))
+				continue;
+
+			NumOutParms++;
+
+			/* Remainder and the return value, in this order. ProcessEvent and NativeCall::Invoke link them in the order of the property chain. */
+			SetBoolIfFailed(bSuccededTestWithoutError, Param.GetName() == (NumOutParms == 0x1 ? "Remainder" : "ReturnValue"));
+		}
+
+		SetBoolIfFailed(bSuccededTestWithoutError, NumOutParms == 0x2);
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> FMod: {}, OutParms: {}", __FUNCTION__, FMod ? FMod.StringifyFlags() : "not found", NumOutParms);
+		std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	/*
+	* Initializes the managers over the fixture.
+	*
+	* With Settings::Debug::bEnableHotPathCounters the counters of the initialization are checked as well, to catch accidental O(n^2) regressions:
+	* every object may only be visited a bounded number of times, and there may only be a few linear FindObject scans.
+	*/
+	template<bool bDoDebugPrinting = false>
+	static inline void TestManagerInit()
+	{
+		constexpr uint64 MaxGetByIndexPerObject = 0x40;
+		constexpr uint64 MaxFindObjectScans = 0x4;
+
+		AttachFixture(GetFixture());
+
+		HotPathCounters::Reset();
+
+		const auto StartTime = std::chrono::high_resolution_clock::now();
+
+		Generator::InitInternal();
+
+		const auto InitDuration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - StartTime);
+
+		const HotPathCounters::CounterValues Counters = HotPathCounters::GetTotals();
+
+		const uint64 NumObjects = static_cast<uint64>(ObjectArray::Num());
+		const uint64 NumGetByIndex = Counters[static_cast<int32>(EHotPathCounter::ObjectArrayGetByIndex)];
+		const uint64 NumScannedObjects = Counters[static_cast<int32>(EHotPathCounter::FindObjectScannedObjects)];
+
+		/* CoreUObject, Engine, the map and every generated package */
+		bool bSuccededTestWithoutError = PackageManager::GetPackageInfos().size() >= (GetFixture().GetConfig().NumPackages + 0x2);
+
+		if constexpr (HotPathCounters::IsEnabled())
+		{
+			SetBoolIfFailed(bSuccededTestWithoutError, NumGetByIndex <= (NumObjects * MaxGetByIndexPerObject));
+			SetBoolIfFailed(bSuccededTestWithoutError, NumScannedObjects <= (NumObjects * MaxFindObjectScans));
+		}
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> Managers: {}ms, Packages: {}, GetByIndex per object: {}, FindObject-scanned objects: {}", __FUNCTION__, InitDuration.count(),
+			PackageManager::GetPackageInfos().size(), NumGetByIndex / NumObjects, NumScannedObjects);
+		std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	/*
+	* Compares the 'ReflectedMembers' tables generated for CycleDerivedA and CycleDerivedB with the expected text.
+	*
+	* CycleDerivedA has two bits of a bit-field in one byte. Both classes derive from a class of the other package, the PackageManager
+	* marks one of these Supers as cyclic, which has to be reflected as 'void' as its members are not visible in that package.
+	*/
+	template<bool bDoDebugPrinting = false>
+	static inline void TestMemberReflection()
+	{
+		AttachFixture(GetFixture());
+
+		/* Cyclic Supers are only known after PackageManager::PostInit */
+		Generator::InitInternal();
+
+		/* The fixture classes don't have predefined members */
+		MemberManager::SetPredefinedMemberLookupPtr(nullptr);
+
+		bool bSuccededTestWithoutError = true;
+
+		const UEClass DerivedA = ObjectArray::FindClassFast("CycleDerivedA");
+		const UEClass DerivedB = ObjectArray::FindClassFast("CycleDerivedB");
+
+		if (!DerivedA || !DerivedB)
+		{
+			std::cout << __FUNCTION__ << ": FAILED! (CycleDerivedA/CycleDerivedB not found)" << std::endl;
+			return;
+		}
+
+		const bool bIsSuperOfACyclic = StructWrapper(DerivedA.GetSuper()).IsCyclicWithPackage(DerivedA.GetPackageIndex());
+		const bool bIsSuperOfBCyclic = StructWrapper(DerivedB.GetSuper()).IsCyclicWithPackage(DerivedB.GetPackageIndex());
+
+		/* Exactly one of the two inheritance-relations is the one that breaks the cycle */
+		SetBoolIfFailed(bSuccededTestWithoutError, bIsSuperOfACyclic != bIsSuperOfBCyclic);
+
+		auto GetGeneratedText = [](UEClass Class) -> std::string
+		{
+			const StructWrapper Struct = Class;
+			const MemberManager Members = Struct.GetMembers();
+
+			std::string Text;
+			CppGenerator::GenerateMemberReflection(Text, Struct, Members, Class.GetPackageIndex());
+
+			return Text;
+		};
+
+		auto GetTypeIdString = [](std::string_view FullName) -> std::string
+		{
+			return std::format("0x{:016X}", CppGenerator::HashReflectedTypeName(FullName));
+		};
+
+		const std::string ExpectedTextA = std::string(R"(
+public:
+	using ReflectedSuper = )") + (bIsSuperOfACyclic ? "void" : "UCycleBaseB") + R"(;
+	static constexpr uint64 ReflectedTypeId = )" + GetTypeIdString("Class /Script/FixtureCycleA.CycleDerivedA") + R"(;
+	static constexpr std::array<MemberReflection::FMemberDescriptor, 0x4> ReflectedMembers =
+	{{
+		MemberReflection::FMemberDescriptor{ "Value", 0x0030, 0x0004, 0x1, MemberReflection::EMemberKind::Int32, 0xFF, 0x0000000000000000 },
+		MemberReflection::FMemberDescriptor{ "bFirstFlag", 0x0034, 0x0001, 0x1, MemberReflection::EMemberKind::Bool, 0x01, 0x0000000000000000 },
+		MemberReflection::FMemberDescriptor{ "bThirdFlag", 0x0034, 0x0001, 0x1, MemberReflection::EMemberKind::Bool, 0x04, 0x0000000000000000 },
+		MemberReflection::FMemberDescriptor{ "Location", 0x0038, 0x000C, 0x1, MemberReflection::EMemberKind::Struct, 0xFF, )" + GetTypeIdString("ScriptStruct /Script/CoreUObject.Vector") + R"( },
+	}};
+)";
+
+		const std::string ExpectedTextB = std::string(R"(
+public:
+	using ReflectedSuper = )") + (bIsSuperOfBCyclic ? "void" : "UCycleBaseA") + R"(;
+	static constexpr uint64 ReflectedTypeId = )" + GetTypeIdString("Class /Script/FixtureCycleB.CycleDerivedB") + R"(;
+	static constexpr std::array<MemberReflection::FMemberDescriptor, 0x2> ReflectedMembers =
+	{{
+		MemberReflection::FMemberDescriptor{ "bIsEnabled", 0x0030, 0x0001, 0x1, MemberReflection::EMemberKind::Bool, 0xFF, 0x0000000000000000 },
+		MemberReflection::FMemberDescriptor{ "Owner", 0x0038, 0x0008, 0x1, MemberReflection::EMemberKind::Object, 0xFF, )" + GetTypeIdString("Class /Script/Engine.Actor") + R"( },
+	}};
+)";
+
+		const std::string GeneratedTextA = GetGeneratedText(DerivedA);
+		const std::string GeneratedTextB = GetGeneratedText(DerivedB);
+
+		SetBoolIfFailed(bSuccededTestWithoutError, GeneratedTextA == ExpectedTextA);
+		SetBoolIfFailed(bSuccededTestWithoutError, GeneratedTextB == ExpectedTextB);
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> Cyclic Super: {}\nCycleDerivedA:{}\nCycleDerivedB:{}", __FUNCTION__, bIsSuperOfACyclic ? "UCycleBaseB" : "UCycleBaseA", GeneratedTextA, GeneratedTextB);
+		std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	/*
+	* Checks the hashed TSet/TMap lookups of the SDK on TSet memory images at the engine's offsets, nothing is read from the fixture.
+	*
+	* The SDK's templates can't be compiled into the dumper, so the test mirrors the hash functions and the bucket-walk of UnrealContainers.hpp
+	* and checks that the generated file still contains these exact expressions.
+	*/
+	template<bool bDoDebugPrinting = false>
+	static inline void TestContainerLookup()
+	{
+		bool bSuccededTestWithoutError = true;
+
+		/* Values of the engine's hash functions */
+		SetBoolIfFailed(bSuccededTestWithoutError, GetTypeHash(static_cast<uint64>(0x100000002)) == 0x19);
+		SetBoolIfFailed(bSuccededTestWithoutError, PointerHash(reinterpret_cast<void*>(0x12345670)) == 0x8FD1902B);
+
+		auto HashInt = [](int32 Value) -> uint32 { return Value; };
+		auto HashWide = [](uint64 Value) -> uint32 { return GetTypeHash(Value); };
+		auto HashPointer = [](void* Value) -> uint32 { return PointerHash(Value); };
+
+		/* Empty, a single bucket (inline allocation), and multiple buckets */
+		for (const int32 NumElements : { 0, 1, 3, 0x20, 0x400 })
+		{
+			std::vector<int32> IntKeys, MissingIntKeys;
+			std::vector<uint64> WideKeys, MissingWideKeys;
+			std::vector<void*> PtrKeys, MissingPtrKeys;
+
+			for (int32 i = 0; i < NumElements; i++)
+			{
+				IntKeys.push_back(i * 0x10);
+				MissingIntKeys.push_back(i * 0x10 + 0x1);
+
+				WideKeys.push_back((static_cast<uint64>(i) << 32) | 0x17);
+				MissingWideKeys.push_back((static_cast<uint64>(i) << 32) | 0x18);
+
+				PtrKeys.push_back(reinterpret_cast<void*>(0x10000 + (static_cast<uintptr_t>(i) * 0x40)));
+				MissingPtrKeys.push_back(reinterpret_cast<void*>(0x10000 + (static_cast<uintptr_t>(i) * 0x40) + 0x20));
+			}
+
+			SetBoolIfFailed(bSuccededTestWithoutError, CheckSetAndMap(IntKeys, MissingIntKeys, HashInt));
+			SetBoolIfFailed(bSuccededTestWithoutError, CheckSetAndMap(WideKeys, MissingWideKeys, HashWide));
+			SetBoolIfFailed(bSuccededTestWithoutError, CheckSetAndMap(PtrKeys, MissingPtrKeys, HashPointer));
+		}
+
+		CppGenerator::StreamType ContainersFile("UnrealContainers.hpp");
+		CppGenerator::GenerateUnrealContainers(ContainersFile);
+
+		const std::string& ContainersText = ContainersFile.GetBuffer();
+
+		/* The hash functions and the bucket-walk mirrored above */
+		for (const char* ExpectedText : {
+			"inline uint32 GetTypeHash(const uint64 Value) { return static_cast<uint32>(Value) + (static_cast<uint32>(Value >> 32) * 23); }",
+			"return HashCombine(GetTypeHash(static_cast<uint64>(reinterpret_cast<uintptr_t>(Key) >> 4)), C);",
+			"int32 Index = Buckets[KeyHash & (HashSize - 1)];",
+			"for (int32 i = 0; i < NumAllocatedElements && Index >= 0 && Index < NumAllocatedElements; i++)",
+			"Index = Element.HashNextId;" })
+		{
+			SetBoolIfFailed(bSuccededTestWithoutError, ContainersText.find(ExpectedText) != std::string::npos);
+		}
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> UnrealContainers.hpp: {} bytes", __FUNCTION__, ContainersText.size());
+
+		ContainersFile.Discard();
+
+		std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	/*
+	* Builds a fixture per alternative layout (FFixedUObjectArray, TNameEntryArray, UProperty), points the dumper at it and checks the code-paths of that layout.
+	*
+	* Off::Init() and the managers can only run once per process, so only GObjects, GNames and the offsets that differ between the layouts are initialized again.
+	* The shared fixture, and every offset changed here, is restored afterwards.
+	*/
+	template<bool bDoDebugPrinting = false>
+	static inline void TestAlternativeLayouts()
+	{
+		const UnrealFixture& SharedFixture = GetFixture();
+		AttachFixture(SharedFixture);
+
+		int32* const ChangedOffsets[] = {
+			&Off::UStruct::Size, &Off::UStruct::MinAlignemnt, &Off::UClass::CastFlags, &Off::UClass::ClassDefaultObject, &Off::UFunction::FunctionFlags, &Off::UFunction::ExecFunction,
+			&Off::Property::ElementSize, &Off::Property::ArrayDim, &Off::Property::Offset_Internal, &Off::Property::PropertyFlags, &Off::InSDK::Properties::PropertySize
+		};
+
+		int32 SavedOffsets[std::size(ChangedOffsets)];
+
+		for (int32 i = 0; i < std::size(ChangedOffsets); i++)
+			SavedOffsets[i] = *ChangedOffsets[i];
+
+		const bool bSavedUseFProperty = Settings::Internal::bUseFProperty;
+
+		for (const auto& [LayoutName, Config] : GetAlternativeConfigs())
+		{
+			const UnrealFixture Fixture(Config);
+
+			AttachObjectsAndNames(Fixture);
+			NameArray::PostInit();
+
+			bool bSuccededTestWithoutError = CheckObjectsAndNames(Fixture);
+
+			if (!Config.bUseFProperty)
+				SetBoolIfFailed(bSuccededTestWithoutError, CheckUPropertyOffsets(Fixture.GetLayout()));
+
+			PrintDbgMessage<bDoDebugPrinting>("{} --> [{}] Objects: {}, Names: {}, ElementSize: 0x{:X}, PropertySize: 0x{:X}", __FUNCTION__, LayoutName, ObjectArray::Num(), Fixture.GetNumNames(),
+				Off::Property::ElementSize, Off::InSDK::Properties::PropertySize);
+
+			std::cout << __FUNCTION__ << " [" << LayoutName << "]: " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
+
+			Settings::Internal::bUseFProperty = bSavedUseFProperty;
+
+			for (int32 i = 0; i < std::size(ChangedOffsets); i++)
+				*ChangedOffsets[i] = SavedOffsets[i];
+		}
+
+		AttachObjectsAndNames(SharedFixture);
+		NameArray::PostInit();
+	}
+
+	/* Not part of TestAll(), builds a second, game-sized, fixture without attaching it */
+	template<bool bDoDebugPrinting = false>
+	static inline void BenchmarkFixtureCreation(int32 NumObjects = 1'000'000, int32 NumPackages = 10'000)
+	{
+		UnrealFixtureConfig Config;
+		Config.NumObjects = NumObjects;
+		Config.NumPackages = NumPackages;
+
+		const auto StartTime = std::chrono::high_resolution_clock::now();
+
+		UnrealFixture Fixture(Config);
+
+		const auto Duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - StartTime);
+
+		const bool bSuccededTestWithoutError = Fixture.GetNumObjects() >= NumObjects;
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> {}ms, Objects: {}, Names: {}, Memory: {}MB", __FUNCTION__, Duration.count(), Fixture.GetNumObjects(), Fixture.GetNumNames(), Fixture.GetNumBytesAllocated() / (1024 * 1024));
+		std::cout << __FUNCTION__ << ": " << (bSuccededTestWithoutError ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+};
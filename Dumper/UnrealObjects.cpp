@@ -1,8 +1,10 @@
 #include <format>
+#include <mutex>
 
 #include "UnrealObjects.h"
 #include "Offsets.h"
 #include "ObjectArray.h"
+#include "HotPathCounters.h"
 
 
 void* UEFFieldClass::GetAddress()
@@ -289,14 +291,8 @@ std::string UEObject::GetValidName() const
 
 std::string UEObject::GetCppName() const
 {
-	static UEClass ActorClass = nullptr;
-	static UEClass InterfaceClass = nullptr;
-
-	if (ActorClass == nullptr)
-		ActorClass = ObjectArray::FindClassFast("Actor");
-
-	if (InterfaceClass == nullptr)
-		InterfaceClass = ObjectArray::FindClassFast("Interface");
+	static const UEClass ActorClass = ObjectArray::FindClassFast("Actor");
+	static const UEClass InterfaceClass = ObjectArray::FindClassFast("Interface");
 
 	std::string Temp = GetValidName();
 
@@ -523,6 +519,8 @@ int32 UEStruct::GetStructSize() const
 
 std::vector<UEProperty> UEStruct::GetProperties() const
 {
+	HotPathCounters::Add(EHotPathCounter::GetPropertiesCalls);
+
 	std::vector<UEProperty> Properties;
 
 	if (Settings::Internal::bUseFProperty)
@@ -533,6 +531,8 @@ std::vector<UEProperty> UEStruct::GetProperties() const
 				Properties.push_back(Field.Cast<UEProperty>());
 		}
 
+		HotPathCounters::Add(EHotPathCounter::GetPropertiesMaterialized, Properties.size());
+
 		return Properties;
 	}
 
@@ -542,6 +542,8 @@ std::vector<UEProperty> UEStruct::GetProperties() const
 			Properties.push_back(Field.Cast<UEProperty>());
 	}
 
+	HotPathCounters::Add(EHotPathCounter::GetPropertiesMaterialized, Properties.size());
+
 	return Properties;
 }
 
@@ -927,6 +929,7 @@ int32 UEProperty::GetAlignment() const
 	if (Settings::Internal::bUseFProperty)
 	{
 		static std::unordered_map<void*, int32> UnknownProperties;
+		static std::mutex UnknownPropertiesLock;
 
 		static auto TryFindPropertyRefInOptionalToGetAlignment = [](std::unordered_map<void*, int32>& OutProperties, void* PropertyClass) -> int32
 		{
@@ -952,6 +955,8 @@ int32 UEProperty::GetAlignment() const
 			return OutProperties.insert({ PropertyClass, 0x1 }).first->second;
 		};
 
+		std::scoped_lock Lock(UnknownPropertiesLock);
+
 		auto It = UnknownProperties.find(GetClass().second.GetAddress());
 
 		/* Safe to use first member, as we're guaranteed to use FProperty */
@@ -2,6 +2,7 @@
 
 #include "UnrealTypes.h"
 #include "NameArray.h"
+#include "HotPathCounters.h"
 
 
 std::string MakeNameValid(std::string&& Name)
@@ -108,19 +109,7 @@ void FName::Init(bool bForceGNames)
 
 		if (bInitializedSuccessfully)
 		{
-			ToStr = [](const void* Name) -> std::string
-			{
-				if (!Settings::Internal::bUseUoutlineNumberName)
-				{
-					const int32 Number = FName(Name).GetNumber();
-
-					if (Number > 0)
-						return NameArray::GetNameEntry(Name).GetString() + "_" + std::to_string(Number - 1);
-				}
-
-				return NameArray::GetNameEntry(Name).GetString();
-			};
-
+			InitGNamesToStr();
 			return;
 		}
 		else /* Attempt to find FName::ToString as a final fallback */
@@ -140,6 +129,8 @@ void FName::Init(bool bForceGNames)
 	{
 		thread_local FFreableString TempString(1024);
 
+		HotPathCounters::Add(EHotPathCounter::FNameAppendString);
+
 		AppendString(Name, TempString);
 
 		std::string OutputString = TempString.ToString();
@@ -156,20 +147,7 @@ void FName::Init(int32 OverrideOffset, EOffsetOverrideType OverrideType, bool bI
 		const bool bInitializedSuccessfully = NameArray::TryInit(OverrideOffset, bIsNamePool);
 
 		if (bInitializedSuccessfully)
-		{
-			ToStr = [](const void* Name) -> std::string
-			{
-				if (!Settings::Internal::bUseUoutlineNumberName)
-				{
-					const int32 Number = FName(Name).GetNumber();
-
-					if (Number > 0)
-						return NameArray::GetNameEntry(Name).GetString() + "_" + std::to_string(Number - 1);
-				}
-
-				return NameArray::GetNameEntry(Name).GetString();
-			};
-		}
+			InitGNamesToStr();
 
 		return;
 	}
@@ -183,6 +161,8 @@ void FName::Init(int32 OverrideOffset, EOffsetOverrideType OverrideType, bool bI
 	{
 		thread_local FFreableString TempString(1024);
 
+		HotPathCounters::Add(EHotPathCounter::FNameAppendString);
+
 		AppendString(Name, TempString);
 
 		std::string OutputString = TempString.ToString();
@@ -194,6 +174,28 @@ void FName::Init(int32 OverrideOffset, EOffsetOverrideType OverrideType, bool bI
 	std::cout << std::format("Manual-Override: FName::{} --> Offset 0x{:X}\n\n", (Off::InSDK::Name::bIsUsingAppendStringOverToString ? "AppendString" : "ToString"), Off::InSDK::Name::AppendNameToString);
 }
 
+void FName::InitFromGNamesAddress(uint8* GNamesAddress, bool bIsNamePool)
+{
+	if (NameArray::TryInitFromAddress(GNamesAddress, bIsNamePool))
+		InitGNamesToStr();
+}
+
+void FName::InitGNamesToStr()
+{
+	ToStr = [](const void* Name) -> std::string
+	{
+		if (!Settings::Internal::bUseUoutlineNumberName)
+		{
+			const int32 Number = FName(Name).GetNumber();
+
+			if (Number > 0)
+				return NameArray::GetNameEntry(Name).GetString() + "_" + std::to_string(Number - 1);
+		}
+
+		return NameArray::GetNameEntry(Name).GetString();
+	};
+}
+
 void FName::InitFallback()
 {
 	Off::InSDK::Name::bIsUsingAppendStringOverToString = false;
@@ -179,6 +179,9 @@ private:
 
 	inline static std::string(*ToStr)(const void* Name) = nullptr;
 
+private:
+	static void InitGNamesToStr();
+
 private:
 	const uint8* Address;
 
@@ -193,6 +196,9 @@ public:
 
 	static void Init(int32 OverrideOffset, EOffsetOverrideType OverrideType = EOffsetOverrideType::AppendString, bool bIsNamePool = false);
 
+	/* Uses GNames at an absolute address, for name tables that don't live inside of the game's image (eg. test fixtures). TNameEntryArray* or FNamePool* */
+	static void InitFromGNamesAddress(uint8* GNamesAddress, bool bIsNamePool);
+
 public:
 	inline const void* GetAddress() const { return Address; }
 
@@ -0,0 +1,79 @@
+#include <cstring>
+
+#include "UsmapNameTable.h"
+
+
+UsmapNameTable::UsmapNameTable(bool bCheckForDuplicates, size_t ReserveNumNames)
+	: bShouldCheckForDuplicates(bCheckForDuplicates)
+{
+	Data.reserve(ReserveNumNames * 0x18);
+
+	if (bShouldCheckForDuplicates)
+	{
+		FNameIndices.reserve(ReserveNumNames);
+		StringIndices.reserve(ReserveNumNames);
+	}
+}
+
+int32 UsmapNameTable::AppendName(const std::string& Name)
+{
+	const uint16 Length = static_cast<uint16>(Name.length());
+
+	Data.append(reinterpret_cast<const char*>(&Length), sizeof(Length));
+	Data.append(Name);
+
+	return NumNames++;
+}
+
+int32 UsmapNameTable::AddName(FName Name)
+{
+	if (!bShouldCheckForDuplicates)
+		return AppendName(Name.ToString());
+
+	auto [It, bInserted] = FNameIndices.try_emplace(GetFNameKey(Name), -1);
+
+	/* FName was added before, no string needs to be created */
+	if (!bInserted)
+		return It->second;
+
+	/* Different FNames can still have the same string (eg. "/Script/Engine" and "Engine" after ToString() strips the path) */
+	It->second = AddName(Name.ToString());
+
+	return It->second;
+}
+
+int32 UsmapNameTable::AddName(const std::string& Name)
+{
+	if (!bShouldCheckForDuplicates)
+		return AppendName(Name);
+
+	auto [It, bInserted] = StringIndices.try_emplace(Name, NumNames);
+
+	/* The name didn't occure yet, write it to the name-table */
+	if (bInserted)
+		AppendName(Name);
+
+	return It->second;
+}
+
+std::vector<int32> UsmapNameTable::MergeInto(UsmapNameTable& Target) const
+{
+	std::vector<int32> TargetIndices;
+	TargetIndices.reserve(NumNames);
+
+	std::string Name;
+
+	/* Walk the serialized names, "[uint16 Length][char Data[Length]]" */
+	for (size_t Offset = 0x0; Offset < Data.size();)
+	{
+		uint16 Length = 0x0;
+		memcpy(&Length, Data.data() + Offset, sizeof(Length));
+
+		Name.assign(Data, Offset + sizeof(Length), Length);
+		TargetIndices.push_back(Target.AddName(Name));
+
+		Offset += sizeof(Length) + Length;
+	}
+
+	return TargetIndices;
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Enums.h"
+#include "UnrealTypes.h"
+
+
+/*
+* Name-table of a single usmap file. Names are appended to one contiguous buffer as "[uint16 Length][char Data[Length]]".
+*
+* Names of objects and properties are looked up by the comparison-index (and number) of their FName, so only the first
+* occurence of every FName is converted to a std::string. Synthesized names (eg. unique enum-member names) use a string lookup.
+* Both lookups share their indices, a string is only ever written once, no matter which lookup added it first.
+*
+* Create one table per generated file, indices are only valid within the table that returned them. Tables of different packages,
+* filled in parallel, are combined with MergeInto().
+*/
+class UsmapNameTable
+{
+private:
+	friend class MappingGeneratorTest;
+
+private:
+	/* Typical games reference ~100k unique names in their mappings */
+	static constexpr size_t DefaultReserveNumNames = 0x20000;
+
+private:
+	std::string Data;
+
+	/* Key: CompIdx in the lower, Number in the upper 32 bits */
+	std::unordered_map<uint64, int32> FNameIndices;
+	std::unordered_map<std::string, int32> StringIndices;
+
+	int32 NumNames = 0x0;
+
+	bool bShouldCheckForDuplicates;
+
+public:
+	UsmapNameTable(bool bCheckForDuplicates = true, size_t ReserveNumNames = DefaultReserveNumNames);
+
+private:
+	static inline uint64 GetFNameKey(FName Name)
+	{
+		return static_cast<uint32>(Name.GetCompIdx()) | (static_cast<uint64>(static_cast<uint32>(Name.GetNumber())) << 32);
+	}
+
+	int32 AppendName(const std::string& Name);
+
+public:
+	/* Adds the string-representation of 'Name' (FName::ToString()), returns its index in the name-table */
+	int32 AddName(FName Name);
+
+	/* Adds a name that doesn't exist as an FName, returns its index in the name-table */
+	int32 AddName(const std::string& Name);
+
+	/* Adds the name of an object/property, or "None" if it is invalid, like UEObject::GetName() */
+	template<typename UnrealType>
+	inline int32 AddNameOf(const UnrealType& Object)
+	{
+		return Object ? AddName(Object.GetFName()) : AddName(std::string("None"));
+	}
+
+public:
+	/*
+	* Adds all names of this table to 'Target', in the order they were added to this table.
+	*
+	* Returns the index in 'Target' for every index of this table. Merging tables in a fixed order always produces the same 'Target',
+	* identical to adding all names to 'Target' directly.
+	*/
+	std::vector<int32> MergeInto(UsmapNameTable& Target) const;
+
+public:
+	inline int32 GetNumNames() const { return NumNames; }
+
+	/* Serialized names, without the leading name-count */
+	inline const std::string& GetData() const { return Data; }
+};
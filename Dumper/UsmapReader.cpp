@@ -0,0 +1,460 @@
+#include <iostream>
+#include <format>
+#include <algorithm>
+
+#include "UsmapReader.h"
+#include "ExternalDependencies/Compression/zstd.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+
+MappedFile::MappedFile(const fs::path& Path)
+{
+#ifdef _WIN32
+	HANDLE File = CreateFileW(Path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+	if (File == INVALID_HANDLE_VALUE)
+		return;
+
+	FileHandle = File;
+
+	LARGE_INTEGER FileSize;
+
+	/* Empty files can't be mapped */
+	if (!GetFileSizeEx(File, &FileSize) || FileSize.QuadPart == 0x0)
+	{
+		Close();
+		return;
+	}
+
+	MappingHandle = CreateFileMappingW(File, nullptr, PAGE_READONLY, 0x0, 0x0, nullptr);
+
+	if (!MappingHandle)
+	{
+		Close();
+		return;
+	}
+
+	Data = static_cast<const uint8*>(MapViewOfFile(MappingHandle, FILE_MAP_READ, 0x0, 0x0, 0x0));
+	Size = static_cast<size_t>(FileSize.QuadPart);
+
+	if (!Data)
+	{
+		Close();
+		return;
+	}
+#else
+	FileHandle = open(Path.c_str(), O_RDONLY);
+
+	if (FileHandle < 0)
+		return;
+
+	struct stat FileStat;
+
+	/* Empty files can't be mapped */
+	if (fstat(FileHandle, &FileStat) != 0 || FileStat.st_size == 0x0)
+	{
+		Close();
+		return;
+	}
+
+	void* Mapping = mmap(nullptr, FileStat.st_size, PROT_READ, MAP_PRIVATE, FileHandle, 0x0);
+
+	if (Mapping == MAP_FAILED)
+	{
+		Close();
+		return;
+	}
+
+	Data = static_cast<const uint8*>(Mapping);
+	Size = static_cast<size_t>(FileStat.st_size);
+#endif
+}
+
+MappedFile::MappedFile(MappedFile&& Other) noexcept
+{
+	*this = std::move(Other);
+}
+
+MappedFile::~MappedFile()
+{
+	Close();
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& Other) noexcept
+{
+	if (this == &Other)
+		return *this;
+
+	Close();
+
+	Data = Other.Data;
+	Size = Other.Size;
+	FileHandle = Other.FileHandle;
+
+#ifdef _WIN32
+	MappingHandle = Other.MappingHandle;
+
+	Other.FileHandle = nullptr;
+	Other.MappingHandle = nullptr;
+#else
+	Other.FileHandle = -1;
+#endif
+
+	Other.Data = nullptr;
+	Other.Size = 0x0;
+
+	return *this;
+}
+
+void MappedFile::Close()
+{
+#ifdef _WIN32
+	if (Data)
+		UnmapViewOfFile(Data);
+
+	if (MappingHandle)
+		CloseHandle(MappingHandle);
+
+	if (FileHandle)
+		CloseHandle(FileHandle);
+
+	MappingHandle = nullptr;
+	FileHandle = nullptr;
+#else
+	if (Data)
+		munmap(const_cast<uint8*>(Data), Size);
+
+	if (FileHandle >= 0)
+		close(FileHandle);
+
+	FileHandle = -1;
+#endif
+
+	Data = nullptr;
+	Size = 0x0;
+}
+
+
+const UsmapEnum* UsmapSchema::FindEnum(std::string_view Name) const
+{
+	auto It = EnumLookup.find(Name);
+
+	return It != EnumLookup.end() ? &Enums[It->second] : nullptr;
+}
+
+const UsmapStruct* UsmapSchema::FindStruct(std::string_view Name) const
+{
+	auto It = StructLookup.find(Name);
+
+	return It != StructLookup.end() ? &Structs[It->second] : nullptr;
+}
+
+std::string_view UsmapSchema::GetName(int32 NameIdx) const
+{
+	if (NameIdx < 0 || NameIdx >= static_cast<int32>(Names.size()))
+		return "";
+
+	return Names[NameIdx];
+}
+
+
+bool UsmapReader::DecompressZStandard(const uint8* Data, size_t CompressedSize, size_t UncompressedSize, std::vector<uint8>& OutData)
+{
+	ZSTD_DCtx* Context = ZSTD_createDCtx();
+
+	if (!Context)
+		return false;
+
+	OutData.resize(UncompressedSize);
+
+	ZSTD_inBuffer Input = { Data, CompressedSize, 0x0 };
+	ZSTD_outBuffer Output = { OutData.data(), OutData.size(), 0x0 };
+
+	bool bSucceeded = true;
+
+	/* Decompress straight into the final buffer, the compressed data is read from the mapped file page by page */
+	while (Input.pos < Input.size)
+	{
+		const size_t Result = ZSTD_decompressStream(Context, &Output, &Input);
+
+		if (ZSTD_isError(Result))
+		{
+			std::cout << std::format("UsmapReader: ZStandard decompression failed! Error: {}\n", ZSTD_getErrorName(Result));
+			bSucceeded = false;
+			break;
+		}
+
+		/* Frame is complete, but there's either trailing data or the output is full */
+		if (Result == 0x0)
+			break;
+
+		/* No progress can be made, the frame claims to be larger than 'UncompressedSize' */
+		if (Output.pos == Output.size)
+		{
+			bSucceeded = false;
+			break;
+		}
+	}
+
+	ZSTD_freeDCtx(Context);
+
+	return bSucceeded && Output.pos == UncompressedSize;
+}
+
+bool UsmapReader::HasValidNameIndices(const UsmapSchema& Schema)
+{
+	const int32 NumNames = static_cast<int32>(Schema.Names.size());
+
+	auto IsValid = [NumNames](int32 Idx) -> bool { return Idx >= 0 && Idx < NumNames; };
+	auto IsValidOrNone = [NumNames](int32 Idx) -> bool { return Idx == -1 || (Idx >= 0 && Idx < NumNames); };
+
+	return std::all_of(Schema.Enums.begin(), Schema.Enums.end(), [&](const UsmapEnum& Enum) { return IsValid(Enum.NameIdx); })
+		&& std::all_of(Schema.EnumMemberNameIndices.begin(), Schema.EnumMemberNameIndices.end(), IsValid)
+		&& std::all_of(Schema.Structs.begin(), Schema.Structs.end(), [&](const UsmapStruct& Struct) { return IsValid(Struct.NameIdx) && IsValidOrNone(Struct.SuperNameIdx); })
+		&& std::all_of(Schema.Properties.begin(), Schema.Properties.end(), [&](const UsmapProperty& Property) { return IsValid(Property.NameIdx); })
+		&& std::all_of(Schema.PropertyTypes.begin(), Schema.PropertyTypes.end(), [&](const UsmapPropertyType& Type) { return IsValidOrNone(Type.NameIdx); });
+}
+
+int32 UsmapReader::ParsePropertyType(Reader& InReader, UsmapSchema& Schema, int32 Depth)
+{
+	if (Depth > MaxPropertyTypeDepth)
+		return -1;
+
+	const int32 TypeIdx = static_cast<int32>(Schema.PropertyTypes.size());
+
+	UsmapPropertyType Type;
+	Type.Type = static_cast<EMappingsTypeFlags>(InReader.Read<uint8>());
+
+	/* Reserve the slot, so types are stored in the same order they appear in the file (parent before its inner types) */
+	Schema.PropertyTypes.push_back(Type);
+
+	/* Inner types return -1 if they're nested too deeply, which fails all outer types as well */
+	switch (Type.Type)
+	{
+	case EMappingsTypeFlags::EnumProperty:
+		if ((Type.InnerTypeIdx = ParsePropertyType(InReader, Schema, Depth + 1)) < 0)
+			return -1;
+
+		Type.NameIdx = InReader.Read<int32>();
+		break;
+	case EMappingsTypeFlags::StructProperty:
+		Type.NameIdx = InReader.Read<int32>();
+		break;
+	case EMappingsTypeFlags::SetProperty:
+	case EMappingsTypeFlags::ArrayProperty:
+	case EMappingsTypeFlags::OptionalProperty:
+		if ((Type.InnerTypeIdx = ParsePropertyType(InReader, Schema, Depth + 1)) < 0)
+			return -1;
+		break;
+	case EMappingsTypeFlags::MapProperty:
+		if ((Type.InnerTypeIdx = ParsePropertyType(InReader, Schema, Depth + 1)) < 0)
+			return -1;
+
+		if ((Type.ValueTypeIdx = ParsePropertyType(InReader, Schema, Depth + 1)) < 0)
+			return -1;
+		break;
+	default:
+		break;
+	}
+
+	Schema.PropertyTypes[TypeIdx] = Type;
+
+	return TypeIdx;
+}
+
+bool UsmapReader::ParsePayload(Reader& InReader, UsmapSchema& Schema)
+{
+	const bool bHasLongNames = Schema.Version >= VersionLongFName;
+	const bool bHasLargeEnums = Schema.Version >= VersionLargeEnums;
+
+	/* Names */
+	const uint32 NameCount = InReader.Read<uint32>();
+
+	/* Every name takes at least one byte, don't trust the count of a malformed file with a huge allocation */
+	Schema.Names.reserve(std::min<size_t>(NameCount, InReader.GetNumBytesLeft()));
+
+	for (uint32 i = 0; i < NameCount && !InReader.HasFailed(); i++)
+	{
+		const size_t Length = bHasLongNames ? InReader.Read<uint16>() : InReader.Read<uint8>();
+		Schema.Names.push_back(InReader.ReadString(Length));
+	}
+
+	/* Enums */
+	const uint32 EnumCount = InReader.Read<uint32>();
+
+	Schema.Enums.reserve(std::min<size_t>(EnumCount, InReader.GetNumBytesLeft()));
+
+	for (uint32 i = 0; i < EnumCount && !InReader.HasFailed(); i++)
+	{
+		UsmapEnum Enum;
+		Enum.NameIdx = InReader.Read<int32>();
+		Enum.NumMembers = bHasLargeEnums ? InReader.Read<uint16>() : InReader.Read<uint8>();
+		Enum.FirstMemberIdx = static_cast<uint32>(Schema.EnumMemberNameIndices.size());
+
+		for (uint16 j = 0; j < Enum.NumMembers && !InReader.HasFailed(); j++)
+			Schema.EnumMemberNameIndices.push_back(InReader.Read<int32>());
+
+		Schema.Enums.push_back(Enum);
+	}
+
+	/* Structs */
+	const uint32 StructCount = InReader.Read<uint32>();
+
+	Schema.Structs.reserve(std::min<size_t>(StructCount, InReader.GetNumBytesLeft()));
+
+	for (uint32 i = 0; i < StructCount && !InReader.HasFailed(); i++)
+	{
+		UsmapStruct Struct;
+		Struct.NameIdx = InReader.Read<int32>();
+		Struct.SuperNameIdx = InReader.Read<int32>();
+		Struct.PropertyCount = InReader.Read<uint16>();
+		Struct.NumSerializableProperties = InReader.Read<uint16>();
+		Struct.FirstPropertyIdx = static_cast<uint32>(Schema.Properties.size());
+
+		for (uint16 j = 0; j < Struct.NumSerializableProperties && !InReader.HasFailed(); j++)
+		{
+			UsmapProperty Property;
+			Property.Index = InReader.Read<uint16>();
+			Property.ArrayDim = InReader.Read<uint8>();
+			Property.NameIdx = InReader.Read<int32>();
+			Property.TypeIdx = ParsePropertyType(InReader, Schema, 0x0);
+
+			if (Property.TypeIdx < 0)
+			{
+				std::cout << "UsmapReader: Property-types are nested too deeply!\n";
+				return false;
+			}
+
+			Schema.Properties.push_back(Property);
+		}
+
+		Schema.Structs.push_back(Struct);
+	}
+
+	if (InReader.HasFailed())
+	{
+		std::cout << "UsmapReader: Unexpected end of the payload!\n";
+		return false;
+	}
+
+	/* Validated once, so users of the schema only need to check for -1 */
+	if (!HasValidNameIndices(Schema))
+	{
+		std::cout << "UsmapReader: Invalid name-index!\n";
+		return false;
+	}
+
+	Schema.EnumLookup.reserve(Schema.Enums.size());
+	Schema.StructLookup.reserve(Schema.Structs.size());
+
+	for (int32 i = 0; i < static_cast<int32>(Schema.Enums.size()); i++)
+		Schema.EnumLookup.try_emplace(Schema.Names[Schema.Enums[i].NameIdx], i);
+
+	for (int32 i = 0; i < static_cast<int32>(Schema.Structs.size()); i++)
+		Schema.StructLookup.try_emplace(Schema.Names[Schema.Structs[i].NameIdx], i);
+
+	return true;
+}
+
+bool UsmapReader::ReadFromMemory(const uint8* Data, size_t Size, UsmapSchema& OutSchema)
+{
+	Reader HeaderReader(Data, Size);
+
+	if (HeaderReader.Read<uint16>() != UsmapFileMagic)
+	{
+		std::cout << "UsmapReader: Invalid file magic!\n";
+		return false;
+	}
+
+	OutSchema.Version = HeaderReader.Read<uint8>();
+
+	if (OutSchema.Version > VersionLargeEnums)
+	{
+		std::cout << std::format("UsmapReader: Unsupported version {}!\n", OutSchema.Version);
+		return false;
+	}
+
+	if (OutSchema.Version >= VersionPackageVersioning && HeaderReader.Read<int32>() != 0x0)
+	{
+		/* FileVersionUE4, FileVersionUE5, NetCL */
+		HeaderReader.Read<int32>();
+		HeaderReader.Read<int32>();
+		HeaderReader.Read<uint32>();
+	}
+
+	OutSchema.CompressionMethod = static_cast<EUsmapCompressionMethod>(HeaderReader.Read<uint8>());
+
+	const uint32 CompressedSize = HeaderReader.Read<uint32>();
+	const uint32 DecompressedSize = HeaderReader.Read<uint32>();
+
+	if (HeaderReader.HasFailed() || HeaderReader.GetNumBytesLeft() < CompressedSize)
+	{
+		std::cout << "UsmapReader: File is smaller than its header claims!\n";
+		return false;
+	}
+
+	const uint8* Payload = HeaderReader.GetCurrent();
+
+	if (OutSchema.CompressionMethod == EUsmapCompressionMethod::None)
+	{
+		if (CompressedSize != DecompressedSize)
+		{
+			std::cout << "UsmapReader: Uncompressed payload with mismatching sizes!\n";
+			return false;
+		}
+	}
+	else if (OutSchema.CompressionMethod == EUsmapCompressionMethod::ZStandard)
+	{
+		if (!DecompressZStandard(Payload, CompressedSize, DecompressedSize, OutSchema.DecompressedPayload))
+		{
+			std::cout << "UsmapReader: Decompression of the payload failed!\n";
+			return false;
+		}
+
+		Payload = OutSchema.DecompressedPayload.data();
+	}
+	else
+	{
+		std::cout << std::format("UsmapReader: Unsupported compression method {}!\n", static_cast<uint8>(OutSchema.CompressionMethod));
+		return false;
+	}
+
+	OutSchema.PayloadSize = DecompressedSize;
+
+	Reader PayloadReader(Payload, DecompressedSize);
+
+	if (!ParsePayload(PayloadReader, OutSchema))
+		return false;
+
+	if (!PayloadReader.IsAtEnd())
+	{
+		std::cout << "UsmapReader: Unexpected data after the last struct!\n";
+		return false;
+	}
+
+	return true;
+}
+
+bool UsmapReader::ReadFromFile(const fs::path& Path, UsmapSchema& OutSchema)
+{
+	MappedFile File(Path);
+
+	if (!File.IsValid())
+	{
+		std::cout << "UsmapReader: Error opening file \"" << Path.string() << "\"\n";
+		return false;
+	}
+
+	/* Names of uncompressed files point into the mapping, the schema keeps it alive */
+	OutSchema.File = std::move(File);
+
+	return ReadFromMemory(OutSchema.File.GetData(), OutSchema.File.GetSize(), OutSchema);
+}
@@ -0,0 +1,245 @@
+#pragma once
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+#include <cstring>
+
+#include "Enums.h"
+
+namespace fs = std::filesystem;
+
+
+/* Read-only view of a file mapped into memory. The file stays mapped until this object is destroyed. */
+class MappedFile
+{
+private:
+	const uint8* Data = nullptr;
+	size_t Size = 0x0;
+
+#ifdef _WIN32
+	void* FileHandle = nullptr;
+	void* MappingHandle = nullptr;
+#else
+	int FileHandle = -1;
+#endif
+
+public:
+	MappedFile() = default;
+	MappedFile(const fs::path& Path);
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile(MappedFile&& Other) noexcept;
+
+	~MappedFile();
+
+public:
+	MappedFile& operator=(const MappedFile&) = delete;
+	MappedFile& operator=(MappedFile&& Other) noexcept;
+
+private:
+	void Close();
+
+public:
+	inline bool IsValid() const { return Data != nullptr; }
+
+	inline const uint8* GetData() const { return Data; }
+	inline size_t GetSize() const { return Size; }
+};
+
+
+struct UsmapPropertyType
+{
+	EMappingsTypeFlags Type = EMappingsTypeFlags::Unknown;
+
+	/* Name of the enum (EnumProperty) or struct (StructProperty), -1 otherwise */
+	int32 NameIdx = -1;
+
+	/* Index into UsmapSchema::PropertyTypes. Underlaying type of an EnumProperty, inner type of Array/Set/Optional, key type of a MapProperty */
+	int32 InnerTypeIdx = -1;
+
+	/* Index into UsmapSchema::PropertyTypes. Value type of a MapProperty */
+	int32 ValueTypeIdx = -1;
+};
+
+struct UsmapProperty
+{
+	uint16 Index;
+	uint8 ArrayDim;
+	int32 NameIdx;
+
+	/* Index into UsmapSchema::PropertyTypes */
+	int32 TypeIdx;
+};
+
+struct UsmapEnum
+{
+	int32 NameIdx;
+
+	/* Range in UsmapSchema::EnumMemberNameIndices */
+	uint32 FirstMemberIdx;
+	uint16 NumMembers;
+};
+
+struct UsmapStruct
+{
+	int32 NameIdx;
+	int32 SuperNameIdx;
+
+	uint16 PropertyCount;
+
+	/* Range in UsmapSchema::Properties */
+	uint32 FirstPropertyIdx;
+	uint16 NumSerializableProperties;
+};
+
+/*
+* In-memory representation of a .usmap file.
+*
+* Names are views into the decompressed payload (or directly into the mapped file, if it isn't compressed), they're never copied.
+* All other data is stored in flat arrays which reference each other by index.
+*/
+class UsmapSchema
+{
+private:
+	friend class UsmapReader;
+
+private:
+	/* Keeps the memory referenced by 'Names' alive. std::vector, unlike std::string, never moves its data when the schema is moved. */
+	MappedFile File;
+	std::vector<uint8> DecompressedPayload;
+
+	size_t PayloadSize = 0x0;
+
+public:
+	uint8 Version = 0x0;
+	EUsmapCompressionMethod CompressionMethod = EUsmapCompressionMethod::None;
+
+	std::vector<std::string_view> Names;
+
+	std::vector<UsmapEnum> Enums;
+	std::vector<int32> EnumMemberNameIndices;
+
+	std::vector<UsmapStruct> Structs;
+	std::vector<UsmapProperty> Properties;
+	std::vector<UsmapPropertyType> PropertyTypes;
+
+private:
+	/* Key: Name of the enum/struct, Value: Index into Enums/Structs */
+	std::unordered_map<std::string_view, int32> EnumLookup;
+	std::unordered_map<std::string_view, int32> StructLookup;
+
+public:
+	UsmapSchema() = default;
+
+	UsmapSchema(const UsmapSchema&) = delete;
+	UsmapSchema(UsmapSchema&&) = default;
+
+public:
+	UsmapSchema& operator=(const UsmapSchema&) = delete;
+	UsmapSchema& operator=(UsmapSchema&&) = default;
+
+public:
+	/* Returns nullptr if there's no enum/struct with this name */
+	const UsmapEnum* FindEnum(std::string_view Name) const;
+	const UsmapStruct* FindStruct(std::string_view Name) const;
+
+	/* Returns "" for invalid indices (eg. SuperNameIdx == -1) */
+	std::string_view GetName(int32 NameIdx) const;
+
+	/* Size, in bytes, of the uncompressed payload */
+	inline size_t GetPayloadSize() const { return PayloadSize; }
+};
+
+
+class UsmapReader
+{
+private:
+	static constexpr uint16 UsmapFileMagic = 0x30C4;
+
+	/* Same values as MappingGenerator::EUsmapVersion */
+	static constexpr uint8 VersionPackageVersioning = 0x1;
+	static constexpr uint8 VersionLongFName = 0x2;
+	static constexpr uint8 VersionLargeEnums = 0x3;
+
+	/* Maximum nesting of property-types (eg. TMap<FName, TArray<TSet<int32>>>), protects against malformed files */
+	static constexpr int32 MaxPropertyTypeDepth = 0x40;
+
+private:
+	/* Bounds-checked cursor over the payload. Once a read failed, all following reads fail as well. */
+	class Reader
+	{
+	private:
+		const uint8* Current;
+		const uint8* End;
+
+		bool bHasFailed = false;
+
+	public:
+		Reader(const uint8* Data, size_t Size)
+			: Current(Data), End(Data + Size)
+		{
+		}
+
+	public:
+		template<typename T>
+		inline T Read()
+		{
+			T Value{};
+
+			if (bHasFailed || static_cast<size_t>(End - Current) < sizeof(T))
+			{
+				bHasFailed = true;
+				return Value;
+			}
+
+			memcpy(&Value, Current, sizeof(T));
+			Current += sizeof(T);
+
+			return Value;
+		}
+
+		inline std::string_view ReadString(size_t Length)
+		{
+			if (bHasFailed || static_cast<size_t>(End - Current) < Length)
+			{
+				bHasFailed = true;
+				return {};
+			}
+
+			std::string_view Str(reinterpret_cast<const char*>(Current), Length);
+			Current += Length;
+
+			return Str;
+		}
+
+	public:
+		inline bool HasFailed() const { return bHasFailed; }
+		inline bool IsAtEnd() const { return Current == End; }
+
+		inline const uint8* GetCurrent() const { return Current; }
+		inline size_t GetNumBytesLeft() const { return End - Current; }
+	};
+
+private:
+	/* Decompresses with the streaming API of zstd, directly into 'OutData' */
+	static bool DecompressZStandard(const uint8* Data, size_t CompressedSize, size_t UncompressedSize, std::vector<uint8>& OutData);
+
+	static bool HasValidNameIndices(const UsmapSchema& Schema);
+
+	/* Returns the index of the type in UsmapSchema::PropertyTypes, or -1 if the type is nested deeper than MaxPropertyTypeDepth */
+	static int32 ParsePropertyType(Reader& InReader, UsmapSchema& Schema, int32 Depth);
+	static bool ParsePayload(Reader& InReader, UsmapSchema& Schema);
+
+public:
+	/*
+	* Parses a complete .usmap file (header and payload). Returns false, and prints the reason, if the file is malformed.
+	*
+	* If the payload isn't compressed, names point directly into 'Data', which then needs to outlive 'OutSchema'.
+	*/
+	static bool ReadFromMemory(const uint8* Data, size_t Size, UsmapSchema& OutSchema);
+
+	/* Maps the file into memory and parses it, 'OutSchema' keeps the file mapped */
+	static bool ReadFromFile(const fs::path& Path, UsmapSchema& OutSchema);
+};
@@ -0,0 +1,279 @@
+#pragma once
+#include "UsmapReader.h"
+#include "MappingGenerator.h"
+#include "TestBase.h"
+
+#include <chrono>
+#include <fstream>
+
+
+class UsmapReaderTest : protected TestBase
+{
+private:
+	static inline void SerializePropertyType(const UsmapSchema& Schema, int32 TypeIdx, std::string& Out)
+	{
+		const UsmapPropertyType& Type = Schema.PropertyTypes[TypeIdx];
+
+		MappingGenerator::WriteToStream(Out, static_cast<uint8>(Type.Type));
+
+		if (Type.InnerTypeIdx != -1)
+			SerializePropertyType(Schema, Type.InnerTypeIdx, Out);
+
+		if (Type.ValueTypeIdx != -1)
+			SerializePropertyType(Schema, Type.ValueTypeIdx, Out);
+
+		if (Type.NameIdx != -1)
+			MappingGenerator::WriteToStream(Out, Type.NameIdx);
+	}
+
+	/* Writes the schema back into the payload-format of the MappingGenerator, a correctly parsed file results in the exact same bytes */
+	static inline std::string SerializePayload(const UsmapSchema& Schema)
+	{
+		std::string Out;
+
+		MappingGenerator::WriteToStream(Out, static_cast<uint32>(Schema.Names.size()));
+
+		for (std::string_view Name : Schema.Names)
+		{
+			MappingGenerator::WriteToStream(Out, static_cast<uint16>(Name.size()));
+			Out += Name;
+		}
+
+		MappingGenerator::WriteToStream(Out, static_cast<uint32>(Schema.Enums.size()));
+
+		for (const UsmapEnum& Enum : Schema.Enums)
+		{
+			MappingGenerator::WriteToStream(Out, Enum.NameIdx);
+			MappingGenerator::WriteToStream(Out, Enum.NumMembers);
+
+			for (uint32 i = 0; i < Enum.NumMembers; i++)
+				MappingGenerator::WriteToStream(Out, Schema.EnumMemberNameIndices[Enum.FirstMemberIdx + i]);
+		}
+
+		MappingGenerator::WriteToStream(Out, static_cast<uint32>(Schema.Structs.size()));
+
+		for (const UsmapStruct& Struct : Schema.Structs)
+		{
+			MappingGenerator::WriteToStream(Out, Struct.NameIdx);
+			MappingGenerator::WriteToStream(Out, Struct.SuperNameIdx);
+			MappingGenerator::WriteToStream(Out, Struct.PropertyCount);
+			MappingGenerator::WriteToStream(Out, Struct.NumSerializableProperties);
+
+			for (uint32 i = 0; i < Struct.NumSerializableProperties; i++)
+			{
+				const UsmapProperty& Property = Schema.Properties[Struct.FirstPropertyIdx + i];
+
+				MappingGenerator::WriteToStream(Out, Property.Index);
+				MappingGenerator::WriteToStream(Out, Property.ArrayDim);
+				MappingGenerator::WriteToStream(Out, Property.NameIdx);
+
+				SerializePropertyType(Schema, Property.TypeIdx, Out);
+			}
+		}
+
+		return Out;
+	}
+
+	/* 'enum EFoo { A, B }', 'struct FVec { float X; }' and 'struct FBar : FVec { TArray<EFoo> Arr; TMap<FName, FVec> Map; }' */
+	static inline std::string CreateSyntheticPayload()
+	{
+		std::string Payload;
+
+		const char* Names[] = { "EFoo", "A", "B", "FVec", "X", "FBar", "Arr", "Map" };
+
+		MappingGenerator::WriteToStream(Payload, static_cast<uint32>(std::size(Names)));
+
+		for (const char* Name : Names)
+		{
+			MappingGenerator::WriteToStream(Payload, static_cast<uint16>(strlen(Name)));
+			Payload += Name;
+		}
+
+		/* Enums */
+		MappingGenerator::WriteToStream(Payload, static_cast<uint32>(1));
+		MappingGenerator::WriteToStream(Payload, static_cast<int32>(0));
+		MappingGenerator::WriteToStream(Payload, static_cast<uint16>(2));
+		MappingGenerator::WriteToStream(Payload, static_cast<int32>(1));
+		MappingGenerator::WriteToStream(Payload, static_cast<int32>(2));
+
+		/* Structs */
+		MappingGenerator::WriteToStream(Payload, static_cast<uint32>(2));
+
+		MappingGenerator::WriteToStream(Payload, static_cast<int32>(3));
+		MappingGenerator::WriteToStream(Payload, static_cast<int32>(-1));
+		MappingGenerator::WriteToStream(Payload, static_cast<uint16>(1));
+		MappingGenerator::WriteToStream(Payload, static_cast<uint16>(1));
+		MappingGenerator::WriteToStream(Payload, static_cast<uint16>(0));
+		MappingGenerator::WriteToStream(Payload, static_cast<uint8>(1));
+		MappingGenerator::WriteToStream(Payload, static_cast<int32>(4));
+		MappingGenerator::WriteToStream(Payload, EMappingsTypeFlags::FloatProperty);
+
+		MappingGenerator::WriteToStream(Payload, static_cast<int32>(5));
+		MappingGenerator::WriteToStream(Payload, static_cast<int32>(3));
+		MappingGenerator::WriteToStream(Payload, static_cast<uint16>(2));
+		MappingGenerator::WriteToStream(Payload, static_cast<uint16>(2));
+		MappingGenerator::WriteToStream(Payload, static_cast<uint16>(0));
+		MappingGenerator::WriteToStream(Payload, static_cast<uint8>(1));
+		MappingGenerator::WriteToStream(Payload, static_cast<int32>(6));
+		MappingGenerator::WriteToStream(Payload, EMappingsTypeFlags::ArrayProperty);
+		MappingGenerator::WriteToStream(Payload, EMappingsTypeFlags::EnumProperty);
+		MappingGenerator::WriteToStream(Payload, EMappingsTypeFlags::ByteProperty);
+		MappingGenerator::WriteToStream(Payload, static_cast<int32>(0));
+		MappingGenerator::WriteToStream(Payload, static_cast<uint16>(1));
+		MappingGenerator::WriteToStream(Payload, static_cast<uint8>(1));
+		MappingGenerator::WriteToStream(Payload, static_cast<int32>(7));
+		MappingGenerator::WriteToStream(Payload, EMappingsTypeFlags::MapProperty);
+		MappingGenerator::WriteToStream(Payload, EMappingsTypeFlags::NameProperty);
+		MappingGenerator::WriteToStream(Payload, EMappingsTypeFlags::StructProperty);
+		MappingGenerator::WriteToStream(Payload, static_cast<int32>(3));
+
+		return Payload;
+	}
+
+	/* Complete usmap file, as written by MappingGenerator::Generate() */
+	static inline std::string CreateUsmapFile(const std::string& Payload)
+	{
+		BufferedFile File(fs::path(), false);
+
+		MappingGenerator::GenerateFileHeader(File, Payload);
+
+		std::string FileData = std::move(File.GetBuffer());
+
+		/* Never hand the in-memory file to the OutputSink */
+		File.Discard();
+
+		return FileData;
+	}
+
+public:
+	template<bool bDoDebugPrinting = false>
+	static inline void TestAll()
+	{
+		TestSyntheticRoundTrip<bDoDebugPrinting>();
+		TestMalformedFiles<bDoDebugPrinting>();
+
+		PrintDbgMessage<bDoDebugPrinting>("");
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestSyntheticRoundTrip()
+	{
+		const std::string Payload = CreateSyntheticPayload();
+		const std::string FileData = CreateUsmapFile(Payload);
+
+		bool bSucceeded = true;
+
+		UsmapSchema Schema;
+		SetBoolIfFailed(bSucceeded, UsmapReader::ReadFromMemory(reinterpret_cast<const uint8*>(FileData.data()), FileData.size(), Schema));
+		SetBoolIfFailed(bSucceeded, SerializePayload(Schema) == Payload);
+
+		const UsmapStruct* Bar = Schema.FindStruct("FBar");
+		SetBoolIfFailed(bSucceeded, Bar && Schema.GetName(Bar->SuperNameIdx) == "FVec" && Bar->NumSerializableProperties == 2);
+
+		if (Bar)
+		{
+			const UsmapPropertyType& ArrayType = Schema.PropertyTypes[Schema.Properties[Bar->FirstPropertyIdx].TypeIdx];
+			const UsmapPropertyType& EnumType = Schema.PropertyTypes[ArrayType.InnerTypeIdx];
+
+			SetBoolIfFailed(bSucceeded, ArrayType.Type == EMappingsTypeFlags::ArrayProperty && EnumType.Type == EMappingsTypeFlags::EnumProperty);
+			SetBoolIfFailed(bSucceeded, Schema.GetName(EnumType.NameIdx) == "EFoo");
+
+			const UsmapPropertyType& MapType = Schema.PropertyTypes[Schema.Properties[Bar->FirstPropertyIdx + 1].TypeIdx];
+
+			SetBoolIfFailed(bSucceeded, Schema.GetName(Schema.PropertyTypes[MapType.ValueTypeIdx].NameIdx) == "FVec");
+		}
+
+		const UsmapEnum* Foo = Schema.FindEnum("EFoo");
+		SetBoolIfFailed(bSucceeded, Foo && Foo->NumMembers == 2 && Schema.GetName(Schema.EnumMemberNameIndices[Foo->FirstMemberIdx + 1]) == "B");
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> Payload: 0x{:X} bytes, File: 0x{:X} bytes", __FUNCTION__, Payload.size(), FileData.size());
+		std::cout << __FUNCTION__ << ": " << (bSucceeded ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	template<bool bDoDebugPrinting = false>
+	static inline void TestMalformedFiles()
+	{
+		const std::string FileData = CreateUsmapFile(CreateSyntheticPayload());
+
+		bool bSucceeded = true;
+
+		/* Truncated files (empty, inside the header, inside the payload) need to be rejected, without reading out of bounds */
+		for (const size_t Size : { size_t(0x0), size_t(0x2), size_t(0x8), FileData.size() / 2, FileData.size() - 1 })
+		{
+			UsmapSchema Schema;
+			SetBoolIfFailed(bSucceeded, !UsmapReader::ReadFromMemory(reinterpret_cast<const uint8*>(FileData.data()), Size, Schema));
+		}
+
+		std::string WrongMagic = FileData;
+		WrongMagic[0] = 0x0;
+
+		UsmapSchema Schema;
+		SetBoolIfFailed(bSucceeded, !UsmapReader::ReadFromMemory(reinterpret_cast<const uint8*>(WrongMagic.data()), WrongMagic.size(), Schema));
+
+		std::cout << __FUNCTION__ << ": " << (bSucceeded ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	/*
+	* Parses the mappings of the current game and writes the schema back into a payload, which has to be identical to the generated one.
+	*
+	* Requires an initialized PackageManager, StructManager and EnumManager.
+	*/
+	template<bool bDoDebugPrinting = false>
+	static inline void TestGeneratorRoundTrip()
+	{
+		const std::string Payload = MappingGenerator::GenerateFileData();
+		const std::string FileData = CreateUsmapFile(Payload);
+
+		UsmapSchema Schema;
+
+		bool bSucceeded = UsmapReader::ReadFromMemory(reinterpret_cast<const uint8*>(FileData.data()), FileData.size(), Schema);
+		SetBoolIfFailed(bSucceeded, SerializePayload(Schema) == Payload);
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> {} names, {} enums, {} structs, {} properties", __FUNCTION__, Schema.Names.size(), Schema.Enums.size(), Schema.Structs.size(), Schema.Properties.size());
+		std::cout << __FUNCTION__ << ": " << (bSucceeded ? "SUCCEEDED!" : "FAILED!") << std::endl;
+	}
+
+	/*
+	* Writes the mappings of the current game to a temporary file and parses it, including mapping and decompressing the file.
+	* Throughput is measured on the uncompressed payload.
+	*
+	* Requires an initialized PackageManager, StructManager and EnumManager.
+	*/
+	template<bool bDoDebugPrinting = true>
+	static inline void BenchmarkParseThroughput(int32 NumIterations = 10)
+	{
+		const fs::path TempFilePath = fs::temp_directory_path() / "Dumper-7_UsmapReaderBenchmark.usmap";
+
+		const std::string FileData = CreateUsmapFile(MappingGenerator::GenerateFileData());
+
+		std::ofstream(TempFilePath, std::ios::binary | std::ios::trunc).write(FileData.data(), FileData.size());
+
+		double TotalTime = 0.0;
+		size_t PayloadSize = 0x0;
+
+		for (int32 i = 0; i < NumIterations; i++)
+		{
+			auto StartTime = std::chrono::high_resolution_clock::now();
+
+			UsmapSchema Schema;
+			const bool bSucceeded = UsmapReader::ReadFromFile(TempFilePath, Schema);
+
+			TotalTime += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - StartTime).count();
+			PayloadSize = Schema.GetPayloadSize();
+
+			if (!bSucceeded)
+			{
+				PrintDbgMessage<bDoDebugPrinting>("{} --> Parsing failed!", __FUNCTION__);
+				break;
+			}
+		}
+
+		std::error_code Error;
+		fs::remove(TempFilePath, Error);
+
+		const double AverageTime = TotalTime / NumIterations;
+
+		PrintDbgMessage<bDoDebugPrinting>("{} --> File: {} bytes, Payload: {} bytes, {:.2f}ms per parse, {:.1f} MB/s", __FUNCTION__,
+			FileData.size(), PayloadSize, AverageTime * 1000.0, (PayloadSize / (1024.0 * 1024.0)) / AverageTime);
+	}
+};
@@ -6,6 +6,8 @@
 #include <algorithm>
 #include <functional>
 
+#include "HotPathCounters.h"
+
 /* Credits: https://en.cppreference.com/w/cpp/string/byte/tolower */
 inline std::string str_tolower(std::string S)
 {
@@ -259,6 +261,8 @@ inline bool IsInProcessRange(const void* Address)
 }
 inline bool IsBadReadPtr(const void* p)
 {
+	HotPathCounters::Add(EHotPathCounter::IsBadReadPtr);
+
 	MEMORY_BASIC_INFORMATION mbi;
 
 	if (VirtualQuery(p, &mbi, sizeof(mbi)))
@@ -12,6 +12,8 @@
 #include "EnumManager.h"
 
 #include "Generator.h"
+#include "Profiler.h"
+#include "HotPathCounters.h"
 
 
 enum class EFortToastType : uint8
@@ -33,8 +35,12 @@ DWORD MainThread(HMODULE Module)
 
 	std::cout << "Started Generation [Dumper-7]!\n";
 
-	Generator::InitEngineCore();
-	Generator::InitInternal();
+	{
+		ProfilerScope InitScope("Generator::Init");
+
+		Generator::InitEngineCore();
+		Generator::InitInternal();
+	}
 
 	if (Settings::Generator::GameName.empty() && Settings::Generator::GameVersion.empty())
 	{
@@ -55,10 +61,29 @@ DWORD MainThread(HMODULE Module)
 	std::cout << "GameName: " << Settings::Generator::GameName << "\n";
 	std::cout << "GameVersion: " << Settings::Generator::GameVersion << "\n\n";
 
-	Generator::Generate<CppGenerator>();
-	Generator::Generate<MappingGenerator>();
-	Generator::Generate<IDAMappingGenerator>();
-	Generator::Generate<DumpspaceGenerator>();
+	{
+		ProfilerScope GenerateScope("Generator::Generate");
+
+		if constexpr (Settings::Generator::bRunGeneratorsConcurrently)
+		{
+			Generator::GenerateConcurrently<CppGenerator, MappingGenerator, IDAMappingGenerator, DumpspaceGenerator>();
+		}
+		else
+		{
+			Generator::Generate<CppGenerator>();
+			Generator::Generate<MappingGenerator>();
+			Generator::Generate<IDAMappingGenerator>();
+			Generator::Generate<DumpspaceGenerator>();
+		}
+
+		OutputSink::Shutdown();
+	}
+
+	Profiler::WriteResults(Generator::GetDumperFolder());
+	HotPathCounters::WriteStatsFile(Generator::GetDumperFolder());
+
+	const OutputSinkStats WriteStats = OutputSink::GetStats();
+	std::cout << std::format("\nWrote {} files ({} bytes, {} write-calls), skipped {} unchanged files\n", WriteStats.NumFiles, WriteStats.NumBytes, WriteStats.NumWriteCalls, WriteStats.NumFilesSkipped);
 
 
 	auto t_C = std::chrono::high_resolution_clock::now();